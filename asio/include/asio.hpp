@@ -15,10 +15,12 @@
 # pragma once
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
+#include "asio/allocation_statistics.hpp"
 #include "asio/any_completion_executor.hpp"
 #include "asio/any_completion_handler.hpp"
 #include "asio/any_io_executor.hpp"
 #include "asio/append.hpp"
+#include "asio/arena_allocator.hpp"
 #include "asio/as_tuple.hpp"
 #include "asio/associated_allocator.hpp"
 #include "asio/associated_cancellation_slot.hpp"
@@ -51,6 +53,7 @@
 #include "asio/bind_executor.hpp"
 #include "asio/bind_immediate_executor.hpp"
 #include "asio/buffer.hpp"
+#include "asio/buffer_pool.hpp"
 #include "asio/buffer_registration.hpp"
 #include "asio/buffered_read_stream_fwd.hpp"
 #include "asio/buffered_read_stream.hpp"
@@ -64,8 +67,10 @@
 #include "asio/cancellation_signal.hpp"
 #include "asio/cancellation_state.hpp"
 #include "asio/cancellation_type.hpp"
+#include "asio/chain_buffer.hpp"
 #include "asio/co_composed.hpp"
 #include "asio/co_spawn.hpp"
+#include "asio/coalescing_write_stream.hpp"
 #include "asio/completion_condition.hpp"
 #include "asio/compose.hpp"
 #include "asio/composed.hpp"
@@ -73,7 +78,9 @@
 #include "asio/connect.hpp"
 #include "asio/connect_pipe.hpp"
 #include "asio/consign.hpp"
+#include "asio/control_buffer.hpp"
 #include "asio/coroutine.hpp"
+#include "asio/datagram_message.hpp"
 #include "asio/deadline_timer.hpp"
 #include "asio/defer.hpp"
 #include "asio/deferred.hpp"
@@ -142,6 +149,7 @@
 #include "asio/local/basic_endpoint.hpp"
 #include "asio/local/connect_pair.hpp"
 #include "asio/local/datagram_protocol.hpp"
+#include "asio/local/fd_passing.hpp"
 #include "asio/local/seq_packet_protocol.hpp"
 #include "asio/local/stream_protocol.hpp"
 #include "asio/multiple_exceptions.hpp"
@@ -166,11 +174,13 @@
 #include "asio/registered_buffer.hpp"
 #include "asio/require.hpp"
 #include "asio/require_concept.hpp"
+#include "asio/ring_buffer.hpp"
 #include "asio/serial_port.hpp"
 #include "asio/serial_port_base.hpp"
 #include "asio/signal_set.hpp"
 #include "asio/signal_set_base.hpp"
 #include "asio/socket_base.hpp"
+#include "asio/splice.hpp"
 #include "asio/static_thread_pool.hpp"
 #include "asio/steady_timer.hpp"
 #include "asio/strand.hpp"
@@ -184,6 +194,7 @@
 #include "asio/thread.hpp"
 #include "asio/thread_pool.hpp"
 #include "asio/time_traits.hpp"
+#include "asio/transfer_file.hpp"
 #include "asio/use_awaitable.hpp"
 #include "asio/use_future.hpp"
 #include "asio/uses_executor.hpp"
@@ -201,5 +212,6 @@
 #include "asio/writable_pipe.hpp"
 #include "asio/write.hpp"
 #include "asio/write_at.hpp"
+#include "asio/write_queue.hpp"
 
 #endif // ASIO_HPP
@@ -0,0 +1,160 @@
+//
+// allocation_statistics.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_ALLOCATION_STATISTICS_HPP
+#define ASIO_ALLOCATION_STATISTICS_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <chrono>
+#include <cstddef>
+#include "asio/detail/allocation_counters.hpp"
+#include "asio/execution_context.hpp"
+
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+# include "asio/detail/allocation_accounting_service.hpp"
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+
+/// Statistics that describe the memory allocated internally on behalf of an
+/// execution context.
+/**
+ * Allocation accounting is enabled by defining the
+ * @c ASIO_ENABLE_ALLOCATION_ACCOUNTING macro. When it is not defined, all of
+ * the counters are zero.
+ *
+ * Memory for handlers, and for other objects allocated using the recycling
+ * allocator, is charged to the execution context that is being run by the
+ * allocating thread. Allocations made by a thread that is not running an
+ * @c io_context or part of a @c thread_pool are not counted. Memory for the
+ * reactor, timer queue, strand and SSL state is charged to the execution
+ * context that owns the corresponding I/O object.
+ */
+struct allocation_statistics
+{
+  /// The categories of internal allocation.
+  enum category
+  {
+    /// Asynchronous operations and their handlers.
+    handler = detail::allocation_counters::handler,
+
+    /// Coroutine frames for @c awaitable functions.
+    awaitable_frame = detail::allocation_counters::awaitable_frame,
+
+    /// Function objects submitted to type-erased executors.
+    executor_function = detail::allocation_counters::executor_function,
+
+    /// Handlers installed into cancellation slots.
+    cancellation_signal = detail::allocation_counters::cancellation_signal,
+
+    /// The shared state of parallel groups.
+    parallel_group = detail::allocation_counters::parallel_group,
+
+    /// The state of operations started with @c cancel_after or
+    /// @c cancel_at.
+    timed_cancel = detail::allocation_counters::timed_cancel,
+
+    /// Per-descriptor state held by the reactor.
+    reactor = detail::allocation_counters::reactor,
+
+    /// The heaps used to order pending timers.
+    timer = detail::allocation_counters::timer,
+
+    /// Strand implementations.
+    strand = detail::allocation_counters::strand,
+
+    /// The input and output buffers used by SSL streams.
+    ssl = detail::allocation_counters::ssl,
+
+    /// The number of categories.
+    category_count = detail::allocation_counters::category_count
+  };
+
+  /// Counters for a category of allocation.
+  struct counters
+  {
+    /// The number of bytes currently allocated.
+    std::size_t bytes_live;
+
+    /// The largest number of bytes that have been allocated at once.
+    std::size_t bytes_peak;
+
+    /// The number of allocations made.
+    std::size_t allocations;
+
+    /// The number of deallocations made.
+    std::size_t deallocations;
+  };
+
+  /// The counters for each category, indexed by @c category.
+  counters categories[category_count];
+
+  /// The counters for all categories combined.
+  counters total;
+
+  /// The time at which the statistics were obtained.
+  std::chrono::steady_clock::time_point time;
+};
+
+/// Get the allocation statistics for an execution context.
+/**
+ * The counters are updated concurrently by the threads using the context, so
+ * the values in the result may not be mutually consistent.
+ */
+inline allocation_statistics get_allocation_statistics(execution_context& ctx)
+{
+  allocation_statistics result = allocation_statistics();
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  detail::allocation_counters& c = detail::get_allocation_counters(ctx);
+  for (int i = 0; i <= allocation_statistics::category_count; ++i)
+  {
+    detail::allocation_counters::values v = c.get(i);
+    allocation_statistics::counters& r =
+      i < allocation_statistics::category_count
+        ? result.categories[i] : result.total;
+    r.bytes_live = v.bytes_live;
+    r.bytes_peak = v.bytes_peak;
+    r.allocations = v.allocations;
+    r.deallocations = v.deallocations;
+  }
+#else // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  (void)ctx;
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  result.time = std::chrono::steady_clock::now();
+  return result;
+}
+
+/// Calculate the rate at which allocations were made between two sets of
+/// statistics obtained from the same execution context.
+/**
+ * @returns The number of allocations per second, across all categories.
+ */
+inline double allocations_per_second(const allocation_statistics& earlier,
+    const allocation_statistics& later)
+{
+  double seconds = std::chrono::duration<double>(
+      later.time - earlier.time).count();
+  if (seconds <= 0)
+    return 0;
+  return static_cast<double>(
+      later.total.allocations - earlier.total.allocations) / seconds;
+}
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_ALLOCATION_STATISTICS_HPP
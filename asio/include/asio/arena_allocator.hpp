@@ -0,0 +1,413 @@
+//
+// arena_allocator.hpp
+// ~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_ARENA_ALLOCATOR_HPP
+#define ASIO_ARENA_ALLOCATOR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+#include "asio/detail/memory.hpp"
+#include "asio/detail/noncopyable.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+
+/// A region of memory from which allocations are made by advancing a pointer.
+/**
+ * The arena class obtains memory from the heap in blocks, and satisfies each
+ * allocation from the current block by advancing a pointer. Deallocating
+ * memory does not make it available for reuse, except that:
+ *
+ * @li Deallocating the most recent allocation makes its memory available
+ * again.
+ *
+ * @li When every allocation has been deallocated, all memory is made available
+ * again and the blocks other than the current one are freed.
+ *
+ * @li Calling reset() discards all allocations at once.
+ *
+ * An arena is intended to hold the memory for the handlers and intermediate
+ * operations of a single connection, through an arena_allocator that is
+ * associated with the connection's completion handlers.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe.
+ */
+class arena
+  : private noncopyable
+{
+public:
+#if defined(GENERATING_DOCUMENTATION)
+  /// The default size of the blocks obtained from the heap.
+  static const std::size_t default_block_size = implementation_defined;
+#else
+  ASIO_STATIC_CONSTANT(std::size_t, default_block_size = 4096);
+#endif
+
+  /// Construct an arena.
+  /**
+   * @param block_size The size of the blocks obtained from the heap.
+   * Allocations that do not fit in a block of this size are given a block of
+   * their own. No memory is allocated until the first allocation is made.
+   */
+  explicit arena(std::size_t block_size = default_block_size) noexcept
+    : block_size_(block_size ? block_size : 1),
+      head_(0),
+      offset_(0),
+      last_(0),
+      allocations_(0),
+      capacity_(0)
+  {
+  }
+
+  /// Destructor frees all memory.
+  ~arena()
+  {
+    while (head_)
+    {
+      block* next = head_->next_;
+      aligned_delete(head_);
+      head_ = next;
+    }
+  }
+
+  /// Allocate memory.
+  /**
+   * @throws std::bad_alloc Thrown if a new block cannot be obtained from the
+   * heap.
+   */
+  void* allocate(std::size_t size, std::size_t align = ASIO_DEFAULT_ALIGN)
+  {
+    align = align ? align : 1;
+    if (head_)
+    {
+      std::size_t start = aligned_offset(head_, offset_, align);
+      if (start <= head_->size_ && head_->size_ - start >= size)
+      {
+        offset_ = start + size;
+        return record(head_->data() + start);
+      }
+    }
+
+    if (size + align > block_size_)
+    {
+      // A large allocation is given a block of its own. The block is placed
+      // behind the current block, which continues to be used for subsequent
+      // allocations.
+      block* b = new_block(size + align);
+      if (head_)
+      {
+        b->next_ = head_->next_;
+        head_->next_ = b;
+      }
+      else
+      {
+        head_ = b;
+        offset_ = b->size_;
+      }
+      char* p = b->data();
+      p += align_up(reinterpret_cast<std::size_t>(p), align)
+        - reinterpret_cast<std::size_t>(p);
+      return record(p);
+    }
+
+    block* b = new_block(block_size_);
+    b->next_ = head_;
+    head_ = b;
+    std::size_t start = aligned_offset(b, 0, align);
+    offset_ = start + size;
+    return record(b->data() + start);
+  }
+
+  /// Deallocate memory.
+  /**
+   * @param p A pointer that was returned by allocate().
+   *
+   * @param size The size that was passed to allocate().
+   */
+  void deallocate(void* p, std::size_t size) noexcept
+  {
+    if (--allocations_ == 0)
+    {
+      // Nothing is in use, so keep the current block and free the rest.
+      reset();
+    }
+    else if (p == last_ && head_
+        && static_cast<char*>(p) + size == head_->data() + offset_)
+    {
+      // The most recent allocation can be undone.
+      offset_ = static_cast<char*>(p) - head_->data();
+      last_ = 0;
+    }
+  }
+
+  /// Discard all allocations.
+  /**
+   * The current block is kept for reuse, and all other blocks are freed. The
+   * memory returned by previous calls to allocate() must no longer be in use.
+   */
+  void reset() noexcept
+  {
+    if (head_)
+    {
+      block* b = head_->next_;
+      while (b)
+      {
+        block* next = b->next_;
+        capacity_ -= b->size_;
+        aligned_delete(b);
+        b = next;
+      }
+      head_->next_ = 0;
+
+      // A block of its own is only kept if it is of the standard size.
+      if (head_->size_ != block_size_)
+      {
+        capacity_ -= head_->size_;
+        aligned_delete(head_);
+        head_ = 0;
+      }
+    }
+
+    offset_ = 0;
+    last_ = 0;
+    allocations_ = 0;
+  }
+
+  /// Get the size of the blocks obtained from the heap.
+  std::size_t block_size() const noexcept
+  {
+    return block_size_;
+  }
+
+  /// Get the total size of the blocks currently held by the arena.
+  std::size_t capacity() const noexcept
+  {
+    return capacity_;
+  }
+
+  /// Get the number of allocations that have not been deallocated.
+  std::size_t allocations() const noexcept
+  {
+    return allocations_;
+  }
+
+private:
+  struct block
+  {
+    block* next_;
+    std::size_t size_;
+
+    char* data()
+    {
+      return reinterpret_cast<char*>(this) + header_size();
+    }
+  };
+
+  static std::size_t header_size()
+  {
+    return align_up(sizeof(block), ASIO_DEFAULT_ALIGN);
+  }
+
+  static std::size_t align_up(std::size_t n, std::size_t align)
+  {
+    return (n + align - 1) / align * align;
+  }
+
+  // Get the first offset at or after the given offset in a block at which the
+  // address is suitably aligned. Only the block header is aligned by the heap,
+  // so the alignment is applied to the address rather than to the offset.
+  static std::size_t aligned_offset(block* b,
+      std::size_t offset, std::size_t align)
+  {
+    std::size_t base = reinterpret_cast<std::size_t>(b->data());
+    return align_up(base + offset, align) - base;
+  }
+
+  block* new_block(std::size_t size)
+  {
+    void* p = aligned_new(ASIO_DEFAULT_ALIGN, header_size() + size);
+    block* b = static_cast<block*>(p);
+    b->next_ = 0;
+    b->size_ = size;
+    capacity_ += size;
+    return b;
+  }
+
+  void* record(void* p)
+  {
+    last_ = p;
+    ++allocations_;
+    return p;
+  }
+
+  const std::size_t block_size_;
+
+  // The list of blocks. Allocations are made from the head of the list.
+  block* head_;
+
+  // The offset of the unused memory in the head block.
+  std::size_t offset_;
+
+  // The most recent allocation from the head block.
+  void* last_;
+
+  std::size_t allocations_;
+  std::size_t capacity_;
+};
+
+/// An allocator that allocates memory from an arena.
+/**
+ * The arena_allocator class stores a pointer to an arena, and copies of an
+ * arena_allocator refer to the same arena. It is intended to be associated
+ * with a connection's completion handlers using bind_allocator(), so that the
+ * memory for all of the connection's intermediate operations and handlers is
+ * obtained from the connection's arena:
+ *
+ * @code asio::arena a;
+ * ...
+ * asio::async_read(socket, buffer,
+ *     asio::bind_allocator(asio::arena_allocator<void>(a),
+ *       [](asio::error_code ec, std::size_t n)
+ *       {
+ *         ...
+ *       })); @endcode
+ *
+ * The arena must remain valid until all memory allocated from it has been
+ * deallocated.
+ */
+template <typename T>
+class arena_allocator
+{
+public:
+  /// The type of object allocated by the arena allocator.
+  typedef T value_type;
+
+  /// Rebind the allocator to another value_type.
+  template <typename U>
+  struct rebind
+  {
+    /// The rebound @c allocator type.
+    typedef arena_allocator<U> other;
+  };
+
+  /// Construct an allocator that allocates from the specified arena.
+  explicit arena_allocator(arena& a) noexcept
+    : arena_(&a)
+  {
+  }
+
+  /// Converting constructor.
+  template <typename U>
+  arena_allocator(const arena_allocator<U>& other) noexcept
+    : arena_(&other.get_arena())
+  {
+  }
+
+  /// Get the arena used by the allocator.
+  arena& get_arena() const noexcept
+  {
+    return *arena_;
+  }
+
+  /// Equality operator. Returns true if both allocators use the same arena.
+  bool operator==(const arena_allocator& other) const noexcept
+  {
+    return arena_ == other.arena_;
+  }
+
+  /// Inequality operator.
+  bool operator!=(const arena_allocator& other) const noexcept
+  {
+    return arena_ != other.arena_;
+  }
+
+  /// Allocate memory for the specified number of values.
+  T* allocate(std::size_t n)
+  {
+    return static_cast<T*>(arena_->allocate(sizeof(T) * n, alignof(T)));
+  }
+
+  /// Deallocate memory for the specified number of values.
+  void deallocate(T* p, std::size_t n)
+  {
+    arena_->deallocate(p, sizeof(T) * n);
+  }
+
+private:
+  arena* arena_;
+};
+
+/// A proto-allocator that allocates memory from an arena.
+/**
+ * The arena must remain valid until all memory allocated from it has been
+ * deallocated.
+ */
+template <>
+class arena_allocator<void>
+{
+public:
+  /// No values are allocated by a proto-allocator.
+  typedef void value_type;
+
+  /// Rebind the allocator to another value_type.
+  template <typename U>
+  struct rebind
+  {
+    /// The rebound @c allocator type.
+    typedef arena_allocator<U> other;
+  };
+
+  /// Construct an allocator that allocates from the specified arena.
+  explicit arena_allocator(arena& a) noexcept
+    : arena_(&a)
+  {
+  }
+
+  /// Converting constructor.
+  template <typename U>
+  arena_allocator(const arena_allocator<U>& other) noexcept
+    : arena_(&other.get_arena())
+  {
+  }
+
+  /// Get the arena used by the allocator.
+  arena& get_arena() const noexcept
+  {
+    return *arena_;
+  }
+
+  /// Equality operator. Returns true if both allocators use the same arena.
+  bool operator==(const arena_allocator& other) const noexcept
+  {
+    return arena_ == other.arena_;
+  }
+
+  /// Inequality operator.
+  bool operator!=(const arena_allocator& other) const noexcept
+  {
+    return arena_ != other.arena_;
+  }
+
+private:
+  arena* arena_;
+};
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_ARENA_ALLOCATOR_HPP
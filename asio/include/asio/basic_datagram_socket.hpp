@@ -18,7 +18,11 @@
 #include "asio/detail/config.hpp"
 #include <cstddef>
 #include "asio/basic_socket.hpp"
+#include "asio/buffer.hpp"
+#include "asio/control_buffer.hpp"
+#include "asio/datagram_message.hpp"
 #include "asio/detail/handler_type_requirements.hpp"
+#include "asio/detail/linked_timeout_handler.hpp"
 #include "asio/detail/non_const_lvalue.hpp"
 #include "asio/detail/throw_error.hpp"
 #include "asio/detail/type_traits.hpp"
@@ -62,6 +66,10 @@ private:
   class initiate_async_send_to;
   class initiate_async_receive;
   class initiate_async_receive_from;
+  class initiate_async_send_batch;
+  class initiate_async_receive_batch;
+  class initiate_async_send_msg;
+  class initiate_async_receive_msg;
 
 public:
   /// The type of the executor associated with the object.
@@ -89,6 +97,12 @@ public:
   /// The endpoint type.
   typedef typename Protocol::endpoint endpoint_type;
 
+  /// The type used to describe a datagram in a batched receive operation.
+  typedef datagram_message<endpoint_type, mutable_buffer> receive_message_type;
+
+  /// The type used to describe a datagram in a batched send operation.
+  typedef datagram_message<endpoint_type, const_buffer> send_message_type;
+
   /// Construct a basic_datagram_socket without opening it.
   /**
    * This constructor creates a datagram socket without opening it. The open()
@@ -1212,6 +1226,315 @@ public:
         buffers, &sender_endpoint, flags);
   }
 
+#if defined(ASIO_HAS_MMSG) \
+  || defined(GENERATING_DOCUMENTATION)
+  /// Start an asynchronous send of a batch of datagrams.
+  /**
+   * This function is used to asynchronously send a number of datagrams, each
+   * to the remote endpoint specified in its message descriptor, or to the
+   * connected peer if the message's endpoint is default-constructed, using as
+   * few system calls as possible. It is an initiating function for an @ref
+   * asynchronous_operation, and always returns immediately.
+   *
+   * The completion handler is invoked once for the whole batch. The operation
+   * may send fewer datagrams than requested, either because the socket's send
+   * buffer is full or because @c count exceeds an implementation-defined
+   * limit. The program may initiate a further operation to send the remaining
+   * datagrams.
+   *
+   * @param messages An array of message descriptors. On completion, the length
+   * of each message that was sent is updated with the number of bytes sent.
+   * Ownership of the array, and of the memory blocks referenced by each
+   * message's buffer, is retained by the caller, which must guarantee that
+   * they remain valid until the completion handler is called.
+   *
+   * @param count The number of elements in the @c messages array.
+   *
+   * @param flags Flags specifying how the send call is to be made.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the send completes. Potential
+   * completion tokens include @ref use_future, @ref use_awaitable, @ref
+   * yield_context, or a function object with the correct completion signature.
+   * The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t messages_transferred // Number of datagrams sent.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @par Example
+   * @code
+   * std::array<asio::ip::udp::socket::send_message_type, 2> messages = {{
+   *   { asio::buffer(data1, size1), destination1 },
+   *   { asio::buffer(data2, size2), destination2 }
+   * }};
+   * socket.async_send_batch(messages.data(), messages.size(), 0, handler);
+   * @endcode
+   *
+   * @par Per-Operation Cancellation
+   * This asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) WriteToken = default_completion_token_t<executor_type>>
+  auto async_send_batch(send_message_type* messages,
+      std::size_t count, socket_base::message_flags flags,
+      WriteToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<WriteToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_send_batch>(), token,
+          messages, count, flags))
+  {
+    return async_initiate<WriteToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_send_batch(this), token,
+        messages, count, flags);
+  }
+
+  /// Start an asynchronous receive of a batch of datagrams.
+  /**
+   * This function is used to asynchronously receive a number of datagrams
+   * using as few system calls as possible. It is an initiating function for an
+   * @ref asynchronous_operation, and always returns immediately.
+   *
+   * The operation completes once at least one datagram has been received, and
+   * the completion handler is invoked once for the whole batch. All datagrams
+   * that are available without blocking are received, up to the smaller of
+   * @c count and an implementation-defined limit.
+   *
+   * @param messages An array of message descriptors, each providing the buffer
+   * into which a datagram will be received. On completion, each message that
+   * was received is updated with the number of bytes received, the endpoint of
+   * the sender, and the flags reported for the datagram. Ownership of the
+   * array, and of the memory blocks referenced by each message's buffer, is
+   * retained by the caller, which must guarantee that they remain valid until
+   * the completion handler is called.
+   *
+   * @param count The number of elements in the @c messages array.
+   *
+   * @param flags Flags specifying how the receive call is to be made.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the receive completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t messages_transferred // Number of datagrams received.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @par Example
+   * @code
+   * std::array<char[1500], 32> data;
+   * std::array<asio::ip::udp::socket::receive_message_type, 32> messages;
+   * for (std::size_t i = 0; i < messages.size(); ++i)
+   *   messages[i].buffer(asio::buffer(data[i]));
+   * socket.async_receive_batch(messages.data(), messages.size(), 0, handler);
+   * @endcode
+   *
+   * @par Per-Operation Cancellation
+   * This asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) ReadToken = default_completion_token_t<executor_type>>
+  auto async_receive_batch(receive_message_type* messages,
+      std::size_t count, socket_base::message_flags flags,
+      ReadToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<ReadToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_receive_batch>(), token,
+          messages, count, flags))
+  {
+    return async_initiate<ReadToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_receive_batch(this), token,
+        messages, count, flags);
+  }
+#endif // defined(ASIO_HAS_MMSG)
+       //   || defined(GENERATING_DOCUMENTATION)
+
+#if defined(ASIO_HAS_ANCILLARY_DATA) \
+  || defined(GENERATING_DOCUMENTATION)
+  /// Start an asynchronous send with ancillary data.
+  /**
+   * This function is used to asynchronously send a datagram to the specified
+   * remote endpoint, together with the control messages held in a control
+   * buffer. It is an initiating function for an @ref asynchronous_operation,
+   * and always returns immediately.
+   *
+   * @param buffers One or more data buffers to be sent to the remote endpoint.
+   * Although the buffers object may be copied as necessary, ownership of the
+   * underlying memory blocks is retained by the caller, which must guarantee
+   * that they remain valid until the completion handler is called.
+   *
+   * @param destination The remote endpoint to which the data will be sent.
+   * Copies will be made of the endpoint as required.
+   *
+   * @param control The control messages to be sent with the datagram. The
+   * control buffer may be copied as necessary, but ownership of the
+   * underlying storage is retained by the caller, which must guarantee that it
+   * remains valid until the completion handler is called.
+   *
+   * @param flags Flags specifying how the send call is to be made.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the send completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred // Number of bytes sent.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * This asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename ConstBufferSequence,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) WriteToken = default_completion_token_t<executor_type>>
+  auto async_send_msg(const ConstBufferSequence& buffers,
+      const endpoint_type& destination, const control_buffer& control,
+      socket_base::message_flags flags,
+      WriteToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<WriteToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_send_msg>(), token,
+          buffers, destination, control, flags))
+  {
+    return async_initiate<WriteToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_send_msg(this), token,
+        buffers, destination, control, flags);
+  }
+
+  /// Start an asynchronous receive with ancillary data.
+  /**
+   * This function is used to asynchronously receive a datagram together with
+   * any control messages delivered with it, such as receive timestamps or
+   * packet information. It is an initiating function for an @ref
+   * asynchronous_operation, and always returns immediately.
+   *
+   * @param buffers One or more buffers into which the data will be received.
+   * Although the buffers object may be copied as necessary, ownership of the
+   * underlying memory blocks is retained by the caller, which must guarantee
+   * that they remain valid until the completion handler is called.
+   *
+   * @param sender_endpoint An endpoint object that receives the endpoint of
+   * the remote sender of the datagram. Ownership of the sender_endpoint object
+   * is retained by the caller, which must guarantee that it is valid until the
+   * completion handler is called.
+   *
+   * @param control A control buffer into which the control messages will be
+   * received. On completion, its size is set to the length of the control data
+   * received. Ownership of the control buffer, and of its underlying storage,
+   * is retained by the caller, which must guarantee that they remain valid
+   * until the completion handler is called.
+   *
+   * @param in_flags Flags specifying how the receive call is to be made.
+   *
+   * @param out_flags Once the asynchronous operation completes, contains flags
+   * associated with the received data. For example, if the
+   * socket_base::message_end_of_record bit is set then the received data
+   * marks the end of a record. The caller must guarantee that the referenced
+   * variable remains valid until the completion handler is called.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the receive completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred // Number of bytes received.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * This asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename MutableBufferSequence,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) ReadToken = default_completion_token_t<executor_type>>
+  auto async_receive_msg(const MutableBufferSequence& buffers,
+      endpoint_type& sender_endpoint, control_buffer& control,
+      socket_base::message_flags in_flags,
+      socket_base::message_flags& out_flags,
+      ReadToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<ReadToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_receive_msg>(), token, buffers,
+          &sender_endpoint, &control, in_flags, &out_flags))
+  {
+    return async_initiate<ReadToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_receive_msg(this), token, buffers,
+        &sender_endpoint, &control, in_flags, &out_flags);
+  }
+#endif // defined(ASIO_HAS_ANCILLARY_DATA)
+       //   || defined(GENERATING_DOCUMENTATION)
+
 private:
   // Disallow copying and assignment.
   basic_datagram_socket(const basic_datagram_socket&) = delete;
@@ -1222,6 +1545,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_send(basic_datagram_socket* self)
       : self_(self)
@@ -1233,6 +1557,13 @@ private:
       return self_->get_executor();
     }
 
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_write);
+    }
+
     template <typename WriteHandler, typename ConstBufferSequence>
     void operator()(WriteHandler&& handler,
         const ConstBufferSequence& buffers,
@@ -1256,6 +1587,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_send_to(basic_datagram_socket* self)
       : self_(self)
@@ -1267,6 +1599,13 @@ private:
       return self_->get_executor();
     }
 
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_write);
+    }
+
     template <typename WriteHandler, typename ConstBufferSequence>
     void operator()(WriteHandler&& handler,
         const ConstBufferSequence& buffers, const endpoint_type& destination,
@@ -1290,6 +1629,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_receive(basic_datagram_socket* self)
       : self_(self)
@@ -1301,6 +1641,13 @@ private:
       return self_->get_executor();
     }
 
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_read);
+    }
+
     template <typename ReadHandler, typename MutableBufferSequence>
     void operator()(ReadHandler&& handler,
         const MutableBufferSequence& buffers,
@@ -1324,6 +1671,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_receive_from(basic_datagram_socket* self)
       : self_(self)
@@ -1335,6 +1683,13 @@ private:
       return self_->get_executor();
     }
 
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_read);
+    }
+
     template <typename ReadHandler, typename MutableBufferSequence>
     void operator()(ReadHandler&& handler,
         const MutableBufferSequence& buffers, endpoint_type* sender_endpoint,
@@ -1353,6 +1708,181 @@ private:
   private:
     basic_datagram_socket* self_;
   };
+
+#if defined(ASIO_HAS_MMSG)
+  class initiate_async_send_batch
+  {
+  public:
+    typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
+
+    explicit initiate_async_send_batch(basic_datagram_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_write);
+    }
+
+    template <typename WriteHandler>
+    void operator()(WriteHandler&& handler,
+        send_message_type* messages, std::size_t count,
+        socket_base::message_flags flags) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a WriteHandler.
+      ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+      detail::non_const_lvalue<WriteHandler> handler2(handler);
+      self_->impl_.get_service().async_send_batch(
+          self_->impl_.get_implementation(), messages, count,
+          flags, handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_datagram_socket* self_;
+  };
+
+  class initiate_async_receive_batch
+  {
+  public:
+    typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
+
+    explicit initiate_async_receive_batch(basic_datagram_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_read);
+    }
+
+    template <typename ReadHandler>
+    void operator()(ReadHandler&& handler,
+        receive_message_type* messages, std::size_t count,
+        socket_base::message_flags flags) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a ReadHandler.
+      ASIO_READ_HANDLER_CHECK(ReadHandler, handler) type_check;
+
+      detail::non_const_lvalue<ReadHandler> handler2(handler);
+      self_->impl_.get_service().async_receive_batch(
+          self_->impl_.get_implementation(), messages, count,
+          flags, handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_datagram_socket* self_;
+  };
+#endif // defined(ASIO_HAS_MMSG)
+
+#if defined(ASIO_HAS_ANCILLARY_DATA)
+  class initiate_async_send_msg
+  {
+  public:
+    typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
+
+    explicit initiate_async_send_msg(basic_datagram_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_write);
+    }
+
+    template <typename WriteHandler, typename ConstBufferSequence>
+    void operator()(WriteHandler&& handler,
+        const ConstBufferSequence& buffers, const endpoint_type& destination,
+        const control_buffer& control,
+        socket_base::message_flags flags) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a WriteHandler.
+      ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+      detail::non_const_lvalue<WriteHandler> handler2(handler);
+      self_->impl_.get_service().async_send_msg(
+          self_->impl_.get_implementation(), buffers, &destination,
+          control, flags, handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_datagram_socket* self_;
+  };
+
+  class initiate_async_receive_msg
+  {
+  public:
+    typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
+
+    explicit initiate_async_receive_msg(basic_datagram_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_read);
+    }
+
+    template <typename ReadHandler, typename MutableBufferSequence>
+    void operator()(ReadHandler&& handler,
+        const MutableBufferSequence& buffers, endpoint_type* sender_endpoint,
+        control_buffer* control, socket_base::message_flags in_flags,
+        socket_base::message_flags* out_flags) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a ReadHandler.
+      ASIO_READ_HANDLER_CHECK(ReadHandler, handler) type_check;
+
+      detail::non_const_lvalue<ReadHandler> handler2(handler);
+      self_->impl_.get_service().async_receive_msg(
+          self_->impl_.get_implementation(), buffers, sender_endpoint,
+          *control, in_flags, *out_flags, handler2.value,
+          self_->impl_.get_executor());
+    }
+
+  private:
+    basic_datagram_socket* self_;
+  };
+#endif // defined(ASIO_HAS_ANCILLARY_DATA)
 };
 
 } // namespace asio
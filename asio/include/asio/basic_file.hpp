@@ -66,6 +66,13 @@ template <typename Executor>
 class basic_file
   : public file_base
 {
+private:
+  class initiate_async_open;
+  class initiate_async_size;
+  class initiate_async_resize;
+  class initiate_async_sync_all;
+  class initiate_async_sync_data;
+
 public:
   /// The type of the executor associated with the object.
   typedef Executor executor_type;
@@ -563,6 +570,64 @@ public:
     ASIO_SYNC_OP_VOID_RETURN(ec);
   }
 
+  /// Start an asynchronous operation to open the file.
+  /**
+   * This function is used to asynchronously open the file using the specified
+   * path. It is an initiating function for an @ref asynchronous_operation,
+   * and always returns immediately.
+   *
+   * @param path The path name identifying the file to be opened. A copy of
+   * the path is made as required.
+   *
+   * @param open_flags A set of flags that determine how the file should be
+   * opened. The same flags as for @c open are supported.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the open completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error // Result of operation.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code) @endcode
+   *
+   * @note No other operation may be performed on the file, and the file
+   * object must not be destroyed, until the completion handler is called.
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX platforms, where the operation is performed using io_uring, this
+   * asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   *
+   * On other platforms the operation is performed by a blocking call on an
+   * internal thread, and cannot be cancelled.
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code))
+        OpenToken = default_completion_token_t<executor_type>>
+  auto async_open(const std::string& path, file_base::flags open_flags,
+      OpenToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<OpenToken, void (asio::error_code)>(
+        declval<initiate_async_open>(), token, path, open_flags))
+  {
+    return async_initiate<OpenToken, void (asio::error_code)>(
+        initiate_async_open(this), token, path, open_flags);
+  }
+
   /// Assign an existing native file to the file.
   /*
    * This function opens the file to hold an existing native file.
@@ -815,6 +880,56 @@ public:
     return impl_.get_service().size(impl_.get_implementation(), ec);
   }
 
+  /// Start an asynchronous operation to get the size of the file.
+  /**
+   * This function is used to asynchronously determine the size of the file,
+   * in bytes. It is an initiating function for an @ref asynchronous_operation,
+   * and always returns immediately.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the operation completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   uint64_t size // The size of the file.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, uint64_t) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX platforms, where the operation is performed using io_uring, this
+   * asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   *
+   * On other platforms the operation is performed by a blocking call on an
+   * internal thread, and cannot be cancelled.
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code, uint64_t))
+        SizeToken = default_completion_token_t<executor_type>>
+  auto async_size(
+      SizeToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<SizeToken, void (asio::error_code, uint64_t)>(
+        declval<initiate_async_size>(), token))
+  {
+    return async_initiate<SizeToken, void (asio::error_code, uint64_t)>(
+        initiate_async_size(this), token);
+  }
+
   /// Alter the size of the file.
   /**
    * This function resizes the file to the specified size, in bytes. If the
@@ -850,6 +965,63 @@ public:
     ASIO_SYNC_OP_VOID_RETURN(ec);
   }
 
+  /// Start an asynchronous operation to alter the size of the file.
+  /**
+   * This function is used to asynchronously resize the file to the specified
+   * size, in bytes, with the same semantics as @c resize. It is an initiating
+   * function for an @ref asynchronous_operation, and always returns
+   * immediately.
+   *
+   * When io_uring is used, the operation is not started until all previously
+   * initiated write operations on the file have completed. Otherwise, the
+   * operation is not ordered with respect to outstanding write operations.
+   *
+   * @param n The new size for the file.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the operation completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error // Result of operation.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * Where the operation is performed using io_uring, this asynchronous
+   * operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   *
+   * Otherwise the operation is performed by a blocking call on an internal
+   * thread, and cannot be cancelled. On Linux, io_uring is used only when
+   * liburing provides IORING_OP_FTRUNCATE.
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code))
+        ResizeToken = default_completion_token_t<executor_type>>
+  auto async_resize(uint64_t n,
+      ResizeToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<ResizeToken, void (asio::error_code)>(
+        declval<initiate_async_resize>(), token, n))
+  {
+    return async_initiate<ResizeToken, void (asio::error_code)>(
+        initiate_async_resize(this), token, n);
+  }
+
   /// Synchronise the file to disk.
   /**
    * This function synchronises the file data and metadata to disk. Note that
@@ -877,6 +1049,59 @@ public:
     ASIO_SYNC_OP_VOID_RETURN(ec);
   }
 
+  /// Start an asynchronous operation to synchronise the file to disk.
+  /**
+   * This function is used to asynchronously synchronise the file data and
+   * metadata to disk. It is an initiating function for an @ref
+   * asynchronous_operation, and always returns immediately.
+   *
+   * When io_uring is used, the operation is not started until all previously
+   * initiated write operations on the file have completed. Otherwise, the
+   * operation is not ordered with respect to outstanding write operations.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the operation completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error // Result of operation.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX platforms, where the operation is performed using io_uring, this
+   * asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   *
+   * On other platforms the operation is performed by a blocking call on an
+   * internal thread, and cannot be cancelled.
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code))
+        SyncToken = default_completion_token_t<executor_type>>
+  auto async_sync_all(
+      SyncToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<SyncToken, void (asio::error_code)>(
+        declval<initiate_async_sync_all>(), token))
+  {
+    return async_initiate<SyncToken, void (asio::error_code)>(
+        initiate_async_sync_all(this), token);
+  }
+
   /// Synchronise the file data to disk.
   /**
    * This function synchronises the file data to disk. Note that the semantics
@@ -904,6 +1129,59 @@ public:
     ASIO_SYNC_OP_VOID_RETURN(ec);
   }
 
+  /// Start an asynchronous operation to synchronise the file data to disk.
+  /**
+   * This function is used to asynchronously synchronise the file data to
+   * disk. It is an initiating function for an @ref asynchronous_operation, and
+   * always returns immediately.
+   *
+   * When io_uring is used, the operation is not started until all previously
+   * initiated write operations on the file have completed. Otherwise, the
+   * operation is not ordered with respect to outstanding write operations.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the operation completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error // Result of operation.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX platforms, where the operation is performed using io_uring, this
+   * asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   *
+   * On other platforms the operation is performed by a blocking call on an
+   * internal thread, and cannot be cancelled.
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code))
+        SyncToken = default_completion_token_t<executor_type>>
+  auto async_sync_data(
+      SyncToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<SyncToken, void (asio::error_code)>(
+        declval<initiate_async_sync_data>(), token))
+  {
+    return async_initiate<SyncToken, void (asio::error_code)>(
+        initiate_async_sync_data(this), token);
+  }
+
 protected:
   /// Protected destructor to prevent deletion through this type.
   /**
@@ -924,6 +1202,147 @@ private:
   // Disallow copying and assignment.
   basic_file(const basic_file&) = delete;
   basic_file& operator=(const basic_file&) = delete;
+
+  class initiate_async_open
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_open(basic_file* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename Handler>
+    void operator()(Handler&& handler,
+        const std::string& path, file_base::flags open_flags) const
+    {
+      detail::non_const_lvalue<Handler> handler2(handler);
+      self_->impl_.get_service().async_open(
+          self_->impl_.get_implementation(), path.c_str(), open_flags,
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_file* self_;
+  };
+
+  class initiate_async_size
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_size(basic_file* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename Handler>
+    void operator()(Handler&& handler) const
+    {
+      detail::non_const_lvalue<Handler> handler2(handler);
+      self_->impl_.get_service().async_size(
+          self_->impl_.get_implementation(),
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_file* self_;
+  };
+
+  class initiate_async_resize
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_resize(basic_file* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename Handler>
+    void operator()(Handler&& handler, uint64_t n) const
+    {
+      detail::non_const_lvalue<Handler> handler2(handler);
+      self_->impl_.get_service().async_resize(
+          self_->impl_.get_implementation(), n,
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_file* self_;
+  };
+
+  class initiate_async_sync_all
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_sync_all(basic_file* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename Handler>
+    void operator()(Handler&& handler) const
+    {
+      detail::non_const_lvalue<Handler> handler2(handler);
+      self_->impl_.get_service().async_sync_all(
+          self_->impl_.get_implementation(),
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_file* self_;
+  };
+
+  class initiate_async_sync_data
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_sync_data(basic_file* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename Handler>
+    void operator()(Handler&& handler) const
+    {
+      detail::non_const_lvalue<Handler> handler2(handler);
+      self_->impl_.get_service().async_sync_data(
+          self_->impl_.get_implementation(),
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_file* self_;
+  };
 };
 
 } // namespace asio
@@ -24,6 +24,7 @@
 #include "asio/async_result.hpp"
 #include "asio/basic_file.hpp"
 #include "asio/detail/handler_type_requirements.hpp"
+#include "asio/detail/linked_timeout_handler.hpp"
 #include "asio/detail/non_const_lvalue.hpp"
 #include "asio/detail/throw_error.hpp"
 #include "asio/error.hpp"
@@ -616,6 +617,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::file_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_write_some_at(basic_random_access_file* self)
       : self_(self)
@@ -627,6 +629,13 @@ private:
       return self_->get_executor();
     }
 
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().write_linked_timeout_available(
+          self_->impl_.get_implementation());
+    }
+
     template <typename WriteHandler, typename ConstBufferSequence>
     void operator()(WriteHandler&& handler,
         uint64_t offset, const ConstBufferSequence& buffers) const
@@ -649,6 +658,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::file_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_read_some_at(basic_random_access_file* self)
       : self_(self)
@@ -660,6 +670,13 @@ private:
       return self_->get_executor();
     }
 
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().read_linked_timeout_available(
+          self_->impl_.get_implementation());
+    }
+
     template <typename ReadHandler, typename MutableBufferSequence>
     void operator()(ReadHandler&& handler,
         uint64_t offset, const MutableBufferSequence& buffers) const
@@ -19,6 +19,7 @@
 #include <cstddef>
 #include "asio/basic_socket.hpp"
 #include "asio/detail/handler_type_requirements.hpp"
+#include "asio/detail/linked_timeout_handler.hpp"
 #include "asio/detail/non_const_lvalue.hpp"
 #include "asio/detail/throw_error.hpp"
 #include "asio/detail/type_traits.hpp"
@@ -1216,6 +1217,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_send(basic_raw_socket* self)
       : self_(self)
@@ -1227,6 +1229,13 @@ private:
       return self_->get_executor();
     }
 
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_write);
+    }
+
     template <typename WriteHandler, typename ConstBufferSequence>
     void operator()(WriteHandler&& handler,
         const ConstBufferSequence& buffers,
@@ -1250,6 +1259,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_send_to(basic_raw_socket* self)
       : self_(self)
@@ -1261,6 +1271,13 @@ private:
       return self_->get_executor();
     }
 
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_write);
+    }
+
     template <typename WriteHandler, typename ConstBufferSequence>
     void operator()(WriteHandler&& handler,
         const ConstBufferSequence& buffers, const endpoint_type& destination,
@@ -1284,6 +1301,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_receive(basic_raw_socket* self)
       : self_(self)
@@ -1295,6 +1313,13 @@ private:
       return self_->get_executor();
     }
 
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_read);
+    }
+
     template <typename ReadHandler, typename MutableBufferSequence>
     void operator()(ReadHandler&& handler,
         const MutableBufferSequence& buffers,
@@ -1318,6 +1343,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_receive_from(basic_raw_socket* self)
       : self_(self)
@@ -1329,6 +1355,13 @@ private:
       return self_->get_executor();
     }
 
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_read);
+    }
+
     template <typename ReadHandler, typename MutableBufferSequence>
     void operator()(ReadHandler&& handler,
         const MutableBufferSequence& buffers, endpoint_type* sender_endpoint,
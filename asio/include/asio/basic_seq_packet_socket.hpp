@@ -19,6 +19,7 @@
 #include <cstddef>
 #include "asio/basic_socket.hpp"
 #include "asio/detail/handler_type_requirements.hpp"
+#include "asio/detail/linked_timeout_handler.hpp"
 #include "asio/detail/throw_error.hpp"
 #include "asio/error.hpp"
 
@@ -750,6 +751,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_send(basic_seq_packet_socket* self)
       : self_(self)
@@ -761,6 +763,13 @@ private:
       return self_->get_executor();
     }
 
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_write);
+    }
+
     template <typename WriteHandler, typename ConstBufferSequence>
     void operator()(WriteHandler&& handler,
         const ConstBufferSequence& buffers,
@@ -784,6 +793,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_receive_with_flags(basic_seq_packet_socket* self)
       : self_(self)
@@ -795,6 +805,13 @@ private:
       return self_->get_executor();
     }
 
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_read);
+    }
+
     template <typename ReadHandler, typename MutableBufferSequence>
     void operator()(ReadHandler&& handler,
         const MutableBufferSequence& buffers,
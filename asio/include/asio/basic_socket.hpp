@@ -21,7 +21,9 @@
 #include "asio/async_result.hpp"
 #include "asio/detail/handler_type_requirements.hpp"
 #include "asio/detail/io_object_impl.hpp"
+#include "asio/detail/linked_timeout_handler.hpp"
 #include "asio/detail/non_const_lvalue.hpp"
+#include "asio/detail/socket_access.hpp"
 #include "asio/detail/throw_error.hpp"
 #include "asio/detail/type_traits.hpp"
 #include "asio/error.hpp"
@@ -1849,6 +1851,8 @@ protected:
 #endif
 
 private:
+  friend class detail::socket_access;
+
   // Disallow copying and assignment.
   basic_socket(const basic_socket&) = delete;
   basic_socket& operator=(const basic_socket&) = delete;
@@ -1857,6 +1861,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_connect(basic_socket* self)
       : self_(self)
@@ -1868,6 +1873,13 @@ private:
       return self_->get_executor();
     }
 
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_write);
+    }
+
     template <typename ConnectHandler>
     void operator()(ConnectHandler&& handler,
         const endpoint_type& peer_endpoint,
@@ -1900,6 +1912,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_wait(basic_socket* self)
       : self_(self)
@@ -1911,6 +1924,12 @@ private:
       return self_->get_executor();
     }
 
+    bool linked_timeout_available(wait_type w) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), w);
+    }
+
     template <typename WaitHandler>
     void operator()(WaitHandler&& handler, wait_type w) const
     {
@@ -21,6 +21,7 @@
 #include "asio/basic_socket.hpp"
 #include "asio/detail/handler_type_requirements.hpp"
 #include "asio/detail/io_object_impl.hpp"
+#include "asio/detail/linked_timeout_handler.hpp"
 #include "asio/detail/non_const_lvalue.hpp"
 #include "asio/detail/throw_error.hpp"
 #include "asio/detail/type_traits.hpp"
@@ -85,6 +86,7 @@ private:
   class initiate_async_wait;
   class initiate_async_accept;
   class initiate_async_move_accept;
+  class initiate_async_accept_batch;
 
 public:
   /// The type of the executor associated with the object.
@@ -911,6 +913,81 @@ public:
     ASIO_SYNC_OP_VOID_RETURN(ec);
   }
 
+#if defined(ASIO_HAS_INCOMING_CPU) \
+  || defined(GENERATING_DOCUMENTATION)
+  /// Steer incoming connections to acceptors by the receiving CPU.
+  /**
+   * This function attaches a program to the SO_REUSEPORT group to which the
+   * acceptor belongs. For each new connection, the program selects the
+   * acceptor whose index within the group is equal to the number of the CPU
+   * that received the connection request, modulo @c group_size. When each
+   * acceptor is serviced by a thread pinned to the corresponding CPU, a
+   * connection is then accepted and handled on the core where its packets
+   * arrive.
+   *
+   * The index of an acceptor within the group is determined by the order in
+   * which the acceptors were bound. The program applies to the whole group, so
+   * it need only be attached using one of its acceptors, after all acceptors
+   * have been bound.
+   *
+   * @param group_size The number of acceptors in the group.
+   *
+   * @throws asio::system_error Thrown on failure.
+   *
+   * @sa asio::socket_base::reuse_port @n
+   * asio::socket_base::incoming_cpu
+   *
+   * @par Example
+   * @code
+   * std::vector<asio::ip::tcp::acceptor> acceptors;
+   * for (int cpu = 0; cpu < num_cpus; ++cpu)
+   * {
+   *   asio::ip::tcp::acceptor a(contexts[cpu]);
+   *   a.open(endpoint.protocol());
+   *   a.set_option(asio::socket_base::reuse_port(true));
+   *   a.bind(endpoint);
+   *   a.listen();
+   *   acceptors.push_back(std::move(a));
+   * }
+   * acceptors[0].attach_cpu_steering(num_cpus);
+   * @endcode
+   */
+  void attach_cpu_steering(std::size_t group_size)
+  {
+    asio::error_code ec;
+    attach_cpu_steering(group_size, ec);
+    asio::detail::throw_error(ec, "attach_cpu_steering");
+  }
+
+  /// Steer incoming connections to acceptors by the receiving CPU.
+  /**
+   * This function attaches a program to the SO_REUSEPORT group to which the
+   * acceptor belongs. For each new connection, the program selects the
+   * acceptor whose index within the group is equal to the number of the CPU
+   * that received the connection request, modulo @c group_size.
+   *
+   * @param group_size The number of acceptors in the group.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   */
+  ASIO_SYNC_OP_VOID attach_cpu_steering(std::size_t group_size,
+      asio::error_code& ec)
+  {
+    if (group_size == 0)
+    {
+      ec = asio::error::invalid_argument;
+      ASIO_SYNC_OP_VOID_RETURN(ec);
+    }
+
+    impl_.get_service().set_option(impl_.get_implementation(),
+        asio::detail::socket_option::reuseport_cpu_program<
+          ASIO_OS_DEF(SOL_SOCKET), ASIO_OS_DEF(SO_ATTACH_REUSEPORT_CBPF)>(
+            group_size), ec);
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+#endif // defined(ASIO_HAS_INCOMING_CPU)
+       //   || defined(GENERATING_DOCUMENTATION)
+
   /// Perform an IO control command on the acceptor.
   /**
    * This function is used to execute an IO control command on the acceptor.
@@ -1526,6 +1603,96 @@ public:
   }
 #endif // !defined(ASIO_NO_EXTENSIONS)
 
+#if (!defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME)) \
+  || defined(GENERATING_DOCUMENTATION)
+  /// Start an asynchronous accept of multiple connections.
+  /**
+   * This function is used to asynchronously accept up to @c count new
+   * connections into the supplied array of sockets. It is an initiating
+   * function for an @ref asynchronous_operation, and always returns
+   * immediately.
+   *
+   * The operation waits until at least one connection is pending, and then
+   * accepts as many queued connections as are immediately available, without
+   * waiting again. This allows a burst of connection attempts to be serviced
+   * with a single readiness notification. Connections are placed into the
+   * sockets in order, starting with @c peers[0].
+   *
+   * @param peers An array of sockets into which new connections will be
+   * accepted. The sockets must not be open. Ownership of the array is retained
+   * by the caller, which must guarantee that it is valid until the completion
+   * handler is called.
+   *
+   * @param count The number of sockets in the array. At most 64 connections
+   * are accepted by a single operation.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the accept completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t accepted // Number of connections accepted.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @note An error is reported only if it prevents any connection from being
+   * accepted. Otherwise, the operation completes successfully with the number
+   * of connections accepted so far, and the error is reported by a subsequent
+   * operation. If an accepted connection cannot be assigned to its socket,
+   * that connection is closed and the remaining connections are assigned to
+   * the following sockets. The operation then completes with the assignment
+   * error and the number of connections that were assigned, so the first
+   * @c accepted sockets are valid even when @c error is set.
+   *
+   * @par Example
+   * @code
+   * std::array<asio::ip::tcp::socket, 16> sockets = ...;
+   * ...
+   * acceptor.async_accept_batch(sockets.data(), sockets.size(),
+   *     [&](asio::error_code ec, std::size_t n)
+   *     {
+   *       for (std::size_t i = 0; i < n; ++i)
+   *         start_session(std::move(sockets[i]));
+   *     });
+   * @endcode
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX operating systems, this asynchronous operation supports
+   * cancellation for the following asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename Socket,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) AcceptToken = default_completion_token_t<executor_type>>
+  auto async_accept_batch(Socket* peers, std::size_t count,
+      AcceptToken&& token = default_completion_token_t<executor_type>(),
+      constraint_t<
+        is_convertible<Protocol, typename Socket::protocol_type>::value
+      > = 0)
+    -> decltype(
+      async_initiate<AcceptToken, void (asio::error_code, std::size_t)>(
+        declval<initiate_async_accept_batch>(), token, peers, count))
+  {
+    return async_initiate<AcceptToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_accept_batch(this), token, peers, count);
+  }
+#endif // (!defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME))
+       //   || defined(GENERATING_DOCUMENTATION)
+
   /// Accept a new connection.
   /**
    * This function is used to accept a new connection from a peer. The function
@@ -2590,6 +2757,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_wait(basic_socket_acceptor* self)
       : self_(self)
@@ -2601,6 +2769,12 @@ private:
       return self_->get_executor();
     }
 
+    bool linked_timeout_available(wait_type w) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), w);
+    }
+
     template <typename WaitHandler>
     void operator()(WaitHandler&& handler, wait_type w) const
     {
@@ -2622,6 +2796,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_accept(basic_socket_acceptor* self)
       : self_(self)
@@ -2633,6 +2808,13 @@ private:
       return self_->get_executor();
     }
 
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_read);
+    }
+
     template <typename AcceptHandler, typename Protocol1, typename Executor1>
     void operator()(AcceptHandler&& handler,
         basic_socket<Protocol1, Executor1>* peer,
@@ -2656,6 +2838,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_move_accept(basic_socket_acceptor* self)
       : self_(self)
@@ -2667,6 +2850,13 @@ private:
       return self_->get_executor();
     }
 
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_read);
+    }
+
     template <typename MoveAcceptHandler, typename Executor1, typename Socket>
     void operator()(MoveAcceptHandler&& handler,
         const Executor1& peer_ex, endpoint_type* peer_endpoint, Socket*) const
@@ -2686,6 +2876,49 @@ private:
     basic_socket_acceptor* self_;
   };
 
+#if !defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME)
+  class initiate_async_accept_batch
+  {
+  public:
+    typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
+
+    explicit initiate_async_accept_batch(basic_socket_acceptor* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_read);
+    }
+
+    template <typename AcceptHandler, typename Socket>
+    void operator()(AcceptHandler&& handler,
+        Socket* peers, std::size_t count) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a ReadHandler.
+      ASIO_READ_HANDLER_CHECK(AcceptHandler, handler) type_check;
+
+      detail::non_const_lvalue<AcceptHandler> handler2(handler);
+      self_->impl_.get_service().async_accept_batch(
+          self_->impl_.get_implementation(), peers, count,
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_socket_acceptor* self_;
+  };
+#endif // !defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME)
+
 #if defined(ASIO_WINDOWS_RUNTIME)
   detail::io_object_impl<
     detail::null_socket_service<Protocol>, Executor> impl_;
@@ -24,6 +24,7 @@
 #include "asio/async_result.hpp"
 #include "asio/basic_file.hpp"
 #include "asio/detail/handler_type_requirements.hpp"
+#include "asio/detail/linked_timeout_handler.hpp"
 #include "asio/detail/non_const_lvalue.hpp"
 #include "asio/detail/throw_error.hpp"
 #include "asio/error.hpp"
@@ -671,6 +672,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::file_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_write_some(basic_stream_file* self)
       : self_(self)
@@ -704,6 +706,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::file_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_read_some(basic_stream_file* self)
       : self_(self)
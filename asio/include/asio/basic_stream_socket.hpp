@@ -19,7 +19,10 @@
 #include <cstddef>
 #include "asio/async_result.hpp"
 #include "asio/basic_socket.hpp"
+#include "asio/control_buffer.hpp"
+#include "asio/detail/cstdint.hpp"
 #include "asio/detail/handler_type_requirements.hpp"
+#include "asio/detail/linked_timeout_handler.hpp"
 #include "asio/detail/non_const_lvalue.hpp"
 #include "asio/detail/throw_error.hpp"
 #include "asio/error.hpp"
@@ -37,6 +40,22 @@ class basic_stream_socket;
 
 #endif // !defined(ASIO_BASIC_STREAM_SOCKET_FWD_DECL)
 
+#if defined(ASIO_HAS_SENDFILE)
+#if !defined(ASIO_BASIC_RANDOM_ACCESS_FILE_FWD_DECL)
+#define ASIO_BASIC_RANDOM_ACCESS_FILE_FWD_DECL
+
+// Forward declaration with defaulted arguments.
+template <typename Executor = any_io_executor>
+class basic_random_access_file;
+
+#endif // !defined(ASIO_BASIC_RANDOM_ACCESS_FILE_FWD_DECL)
+#endif // defined(ASIO_HAS_SENDFILE)
+
+#if defined(ASIO_HAS_SPLICE)
+template <typename Executor> class basic_readable_pipe;
+template <typename Executor> class basic_writable_pipe;
+#endif // defined(ASIO_HAS_SPLICE)
+
 /// Provides stream-oriented socket functionality.
 /**
  * The basic_stream_socket class template provides asynchronous and blocking
@@ -63,6 +82,20 @@ class basic_stream_socket
 private:
   class initiate_async_send;
   class initiate_async_receive;
+#if defined(ASIO_HAS_SENDFILE)
+  class initiate_async_send_file;
+#endif // defined(ASIO_HAS_SENDFILE)
+#if defined(ASIO_HAS_SPLICE)
+  class initiate_async_splice_to_pipe;
+  class initiate_async_splice_from_pipe;
+#endif // defined(ASIO_HAS_SPLICE)
+#if defined(ASIO_HAS_ANCILLARY_DATA)
+  class initiate_async_send_msg;
+  class initiate_async_receive_msg;
+#endif // defined(ASIO_HAS_ANCILLARY_DATA)
+#if defined(ASIO_HAS_TCP_FASTOPEN)
+  class initiate_async_connect_with_data;
+#endif // defined(ASIO_HAS_TCP_FASTOPEN)
 
 public:
   /// The type of the executor associated with the object.
@@ -339,6 +372,105 @@ public:
   {
   }
 
+#if defined(ASIO_HAS_TCP_FASTOPEN) || defined(GENERATING_DOCUMENTATION)
+  using basic_socket<Protocol, Executor>::async_connect;
+
+  /// Start an asynchronous connect that sends initial data.
+  /**
+   * This function is used to asynchronously connect a socket to the specified
+   * remote endpoint and send an initial block of data to the peer. It is an
+   * initiating function for an @ref asynchronous_operation, and always returns
+   * immediately.
+   *
+   * Where supported, TCP Fast Open is used so that the data may be carried in
+   * the connection's SYN segment, saving a round trip when the peer has
+   * previously issued a Fast Open cookie. Otherwise, the data is sent once the
+   * connection has been established. If Fast Open is disabled on the host, a
+   * regular connect is performed before sending the data.
+   *
+   * The socket is automatically opened if it is not already open. If the
+   * connect fails, and the socket was automatically opened, the socket is
+   * not returned to the closed state.
+   *
+   * @param peer_endpoint The remote endpoint to which the socket will be
+   * connected. Copies will be made of the endpoint object as required.
+   *
+   * @param initial_data One or more data buffers to be sent to the peer.
+   * Although the buffers object may be copied as necessary, ownership of the
+   * underlying memory blocks is retained by the caller, which must guarantee
+   * that they remain valid until the completion handler is called.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the connect completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred // Number of bytes of data sent.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @note The operation may not transmit all of the initial data to the peer.
+   * Consider using the @ref async_write function if you need to ensure that
+   * all data is written before proceeding.
+   *
+   * @par Example
+   * @code
+   * asio::ip::tcp::socket socket(my_context);
+   * socket.async_connect(endpoint, asio::buffer(request),
+   *     [](asio::error_code ec, std::size_t n)
+   *     {
+   *       ...
+   *     });
+   * @endcode
+   *
+   * @par Per-Operation Cancellation
+   * This asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename ConstBufferSequence,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) ConnectToken = default_completion_token_t<executor_type>>
+  auto async_connect(const endpoint_type& peer_endpoint,
+      const ConstBufferSequence& initial_data,
+      ConnectToken&& token = default_completion_token_t<executor_type>(),
+      constraint_t<
+        is_const_buffer_sequence<ConstBufferSequence>::value
+      > = 0)
+    -> decltype(
+      async_initiate<ConnectToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_connect_with_data>(), token, peer_endpoint,
+          initial_data, declval<asio::error_code&>()))
+  {
+    asio::error_code open_ec;
+    if (!this->is_open())
+    {
+      const protocol_type protocol = peer_endpoint.protocol();
+      this->impl_.get_service().open(
+          this->impl_.get_implementation(), protocol, open_ec);
+    }
+
+    return async_initiate<ConnectToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_connect_with_data(this), token,
+        peer_endpoint, initial_data, open_ec);
+  }
+#endif // defined(ASIO_HAS_TCP_FASTOPEN) || defined(GENERATING_DOCUMENTATION)
+
   /// Send some data on the socket.
   /**
    * This function is used to send data on the stream socket. The function
@@ -950,6 +1082,349 @@ public:
         buffers, socket_base::message_flags(0));
   }
 
+#if defined(ASIO_HAS_SENDFILE) || defined(GENERATING_DOCUMENTATION)
+  /// Start an asynchronous operation to write data from a file to the socket.
+  /**
+   * This function is used to asynchronously write data from a file to the
+   * stream socket, without copying the data through user space. It is an
+   * initiating function for an @ref asynchronous_operation, and always returns
+   * immediately.
+   *
+   * When the socket uses a reactor-based backend, the data is written using
+   * @c sendfile once the socket is ready for writing. When the socket uses
+   * io_uring, the data is spliced from the file into an internal pipe and from
+   * the pipe to the socket.
+   *
+   * @param file The file from which the data will be read. Ownership of the
+   * file object is retained by the caller, which must guarantee that it remains
+   * open until the completion handler is called.
+   *
+   * @param offset The offset in the file at which the data will be read.
+   *
+   * @param length The maximum number of bytes to be written.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the write completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred // Number of bytes written.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @note The operation may not transmit all of the requested data to the
+   * peer, and completes with zero bytes transferred if @c offset is at or
+   * beyond the end of the file. Consider using the @ref async_transfer_file
+   * function if you need to ensure that all data is written before the
+   * asynchronous operation completes.
+   *
+   * @note Unlike the socket's other send operations, writing to a socket that
+   * has been shut down may raise @c SIGPIPE. Programs that use this operation
+   * should ignore that signal.
+   *
+   * @par Per-Operation Cancellation
+   * This asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename FileExecutor,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) WriteToken = default_completion_token_t<executor_type>>
+  auto async_send_file(basic_random_access_file<FileExecutor>& file,
+      uint64_t offset, std::size_t length,
+      WriteToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<WriteToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_send_file>(), token,
+          file.native_handle(), offset, length))
+  {
+    return async_initiate<WriteToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_send_file(this), token,
+        file.native_handle(), offset, length);
+  }
+#endif // defined(ASIO_HAS_SENDFILE) || defined(GENERATING_DOCUMENTATION)
+
+#if defined(ASIO_HAS_SPLICE) || defined(GENERATING_DOCUMENTATION)
+  /// Start an asynchronous operation to move data from the socket into a pipe.
+  /**
+   * This function is used to asynchronously move data that has been received
+   * on the socket into a pipe, without copying the data through user space.
+   * It is an initiating function for an @ref asynchronous_operation, and
+   * always returns immediately.
+   *
+   * @param pipe The pipe into which the data will be moved. Ownership of
+   * the pipe object is retained by the caller, which must guarantee that it
+   * remains open until the completion handler is called.
+   *
+   * @param max_bytes The maximum number of bytes to be moved.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the operation completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred // Number of bytes moved.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @note The operation completes with zero bytes transferred when the peer has
+   * closed the connection. It waits for the socket to become readable, and so
+   * the pipe should have room for the data when the operation is started.
+   *
+   * @par Per-Operation Cancellation
+   * This asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename PipeExecutor,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) ReadToken = default_completion_token_t<executor_type>>
+  auto async_splice_to_pipe(basic_writable_pipe<PipeExecutor>& pipe,
+      std::size_t max_bytes,
+      ReadToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<ReadToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_splice_to_pipe>(), token,
+          pipe.native_handle(), max_bytes))
+  {
+    return async_initiate<ReadToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_splice_to_pipe(this), token,
+        pipe.native_handle(), max_bytes);
+  }
+
+  /// Start an asynchronous operation to move data from a pipe to the socket.
+  /**
+   * This function is used to asynchronously write data held in a pipe to the
+   * socket, without copying the data through user space.
+   * It is an initiating function for an @ref asynchronous_operation, and
+   * always returns immediately.
+   *
+   * @param pipe The pipe from which the data will be moved. Ownership of
+   * the pipe object is retained by the caller, which must guarantee that it
+   * remains open until the completion handler is called.
+   *
+   * @param max_bytes The maximum number of bytes to be moved.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the operation completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred // Number of bytes moved.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @note The operation may not move all of the requested data to the socket.
+   * Writing to a socket that has been shut down may raise @c SIGPIPE.
+   *
+   * @par Per-Operation Cancellation
+   * This asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename PipeExecutor,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) WriteToken = default_completion_token_t<executor_type>>
+  auto async_splice_from_pipe(basic_readable_pipe<PipeExecutor>& pipe,
+      std::size_t max_bytes,
+      WriteToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<WriteToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_splice_from_pipe>(), token,
+          pipe.native_handle(), max_bytes))
+  {
+    return async_initiate<WriteToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_splice_from_pipe(this), token,
+        pipe.native_handle(), max_bytes);
+  }
+#endif // defined(ASIO_HAS_SPLICE) || defined(GENERATING_DOCUMENTATION)
+
+#if defined(ASIO_HAS_ANCILLARY_DATA) || defined(GENERATING_DOCUMENTATION)
+  /// Start an asynchronous send with ancillary data.
+  /**
+   * This function is used to asynchronously send data on the stream socket,
+   * together with the control messages held in a control buffer. It is an
+   * initiating function for an @ref asynchronous_operation, and always returns
+   * immediately.
+   *
+   * @param buffers One or more data buffers to be sent on the socket. Although
+   * the buffers object may be copied as necessary, ownership of the underlying
+   * memory blocks is retained by the caller, which must guarantee that they
+   * remain valid until the completion handler is called.
+   *
+   * @param control The control messages to be sent with the data. The control
+   * buffer may be copied as necessary, but ownership of the underlying storage
+   * is retained by the caller, which must guarantee that it remains valid until
+   * the completion handler is called.
+   *
+   * @param flags Flags specifying how the send call is to be made.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the send completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred // Number of bytes sent.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @note The send operation may not transmit all of the data to the peer.
+   * The control messages are delivered with the first byte that is sent.
+   *
+   * @par Per-Operation Cancellation
+   * This asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename ConstBufferSequence,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) WriteToken = default_completion_token_t<executor_type>>
+  auto async_send_msg(const ConstBufferSequence& buffers,
+      const control_buffer& control, socket_base::message_flags flags,
+      WriteToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<WriteToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_send_msg>(), token,
+          buffers, control, flags))
+  {
+    return async_initiate<WriteToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_send_msg(this), token,
+        buffers, control, flags);
+  }
+
+  /// Start an asynchronous receive with ancillary data.
+  /**
+   * This function is used to asynchronously receive data from the stream
+   * socket, together with any control messages delivered with it. It is an
+   * initiating function for an @ref asynchronous_operation, and always returns
+   * immediately.
+   *
+   * @param buffers One or more buffers into which the data will be received.
+   * Although the buffers object may be copied as necessary, ownership of the
+   * underlying memory blocks is retained by the caller, which must guarantee
+   * that they remain valid until the completion handler is called.
+   *
+   * @param control A control buffer into which the control messages will be
+   * received. On completion, its size is set to the length of the control data
+   * received. Ownership of the control buffer, and of its underlying storage,
+   * is retained by the caller, which must guarantee that they remain valid
+   * until the completion handler is called.
+   *
+   * @param in_flags Flags specifying how the receive call is to be made.
+   *
+   * @param out_flags Once the asynchronous operation completes, contains flags
+   * associated with the received data. For example, the @c MSG_CTRUNC bit
+   * indicates that some control data was discarded due to lack of space in the
+   * control buffer. The caller must guarantee that the referenced variable
+   * remains valid until the completion handler is called.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the receive completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred // Number of bytes received.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * This asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename MutableBufferSequence,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) ReadToken = default_completion_token_t<executor_type>>
+  auto async_receive_msg(const MutableBufferSequence& buffers,
+      control_buffer& control, socket_base::message_flags in_flags,
+      socket_base::message_flags& out_flags,
+      ReadToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<ReadToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_receive_msg>(), token,
+          buffers, &control, in_flags, &out_flags))
+  {
+    return async_initiate<ReadToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_receive_msg(this), token,
+        buffers, &control, in_flags, &out_flags);
+  }
+#endif // defined(ASIO_HAS_ANCILLARY_DATA) || defined(GENERATING_DOCUMENTATION)
+
   /// Read some data from the socket.
   /**
    * This function is used to read data from the stream socket. The function
@@ -1091,6 +1566,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_send(basic_stream_socket* self)
       : self_(self)
@@ -1102,6 +1578,13 @@ private:
       return self_->get_executor();
     }
 
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_write);
+    }
+
     template <typename WriteHandler, typename ConstBufferSequence>
     void operator()(WriteHandler&& handler,
         const ConstBufferSequence& buffers,
@@ -1125,6 +1608,7 @@ private:
   {
   public:
     typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
 
     explicit initiate_async_receive(basic_stream_socket* self)
       : self_(self)
@@ -1136,6 +1620,13 @@ private:
       return self_->get_executor();
     }
 
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_read);
+    }
+
     template <typename ReadHandler, typename MutableBufferSequence>
     void operator()(ReadHandler&& handler,
         const MutableBufferSequence& buffers,
@@ -1154,6 +1645,277 @@ private:
   private:
     basic_stream_socket* self_;
   };
+
+#if defined(ASIO_HAS_SENDFILE)
+  class initiate_async_send_file
+  {
+  public:
+    typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
+
+    explicit initiate_async_send_file(basic_stream_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_write);
+    }
+
+    template <typename WriteHandler>
+    void operator()(WriteHandler&& handler,
+        int fd, uint64_t offset, std::size_t length) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a WriteHandler.
+      ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+      detail::non_const_lvalue<WriteHandler> handler2(handler);
+      self_->impl_.get_service().async_send_file(
+          self_->impl_.get_implementation(), fd, offset, length,
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_stream_socket* self_;
+  };
+#endif // defined(ASIO_HAS_SENDFILE)
+
+#if defined(ASIO_HAS_SPLICE)
+  class initiate_async_splice_to_pipe
+  {
+  public:
+    typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
+
+    explicit initiate_async_splice_to_pipe(basic_stream_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_read);
+    }
+
+    template <typename ReadHandler>
+    void operator()(ReadHandler&& handler,
+        int pipe_fd, std::size_t max_bytes) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a ReadHandler.
+      ASIO_READ_HANDLER_CHECK(ReadHandler, handler) type_check;
+
+      detail::non_const_lvalue<ReadHandler> handler2(handler);
+      self_->impl_.get_service().async_splice_to_pipe(
+          self_->impl_.get_implementation(), pipe_fd, max_bytes,
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_stream_socket* self_;
+  };
+
+  class initiate_async_splice_from_pipe
+  {
+  public:
+    typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
+
+    explicit initiate_async_splice_from_pipe(basic_stream_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_write);
+    }
+
+    template <typename WriteHandler>
+    void operator()(WriteHandler&& handler,
+        int pipe_fd, std::size_t max_bytes) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a WriteHandler.
+      ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+      detail::non_const_lvalue<WriteHandler> handler2(handler);
+      self_->impl_.get_service().async_splice_from_pipe(
+          self_->impl_.get_implementation(), pipe_fd, max_bytes,
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_stream_socket* self_;
+  };
+#endif // defined(ASIO_HAS_SPLICE)
+
+#if defined(ASIO_HAS_ANCILLARY_DATA)
+  class initiate_async_send_msg
+  {
+  public:
+    typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
+
+    explicit initiate_async_send_msg(basic_stream_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_write);
+    }
+
+    template <typename WriteHandler, typename ConstBufferSequence>
+    void operator()(WriteHandler&& handler,
+        const ConstBufferSequence& buffers, const control_buffer& control,
+        socket_base::message_flags flags) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a WriteHandler.
+      ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+      detail::non_const_lvalue<WriteHandler> handler2(handler);
+      self_->impl_.get_service().async_send_msg(
+          self_->impl_.get_implementation(), buffers,
+          static_cast<const endpoint_type*>(0), control, flags,
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_stream_socket* self_;
+  };
+
+  class initiate_async_receive_msg
+  {
+  public:
+    typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
+
+    explicit initiate_async_receive_msg(basic_stream_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_read);
+    }
+
+    template <typename ReadHandler, typename MutableBufferSequence>
+    void operator()(ReadHandler&& handler,
+        const MutableBufferSequence& buffers, control_buffer* control,
+        socket_base::message_flags in_flags,
+        socket_base::message_flags* out_flags) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a ReadHandler.
+      ASIO_READ_HANDLER_CHECK(ReadHandler, handler) type_check;
+
+      detail::non_const_lvalue<ReadHandler> handler2(handler);
+      self_->impl_.get_service().async_receive_msg(
+          self_->impl_.get_implementation(), buffers,
+          static_cast<endpoint_type*>(0), *control, in_flags, *out_flags,
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_stream_socket* self_;
+  };
+#endif // defined(ASIO_HAS_ANCILLARY_DATA)
+
+#if defined(ASIO_HAS_TCP_FASTOPEN)
+  class initiate_async_connect_with_data
+  {
+  public:
+    typedef Executor executor_type;
+    typedef detail::socket_linked_timeout_support linked_timeout_support;
+
+    explicit initiate_async_connect_with_data(basic_stream_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename... Args>
+    bool linked_timeout_available(const Args&...) const
+    {
+      return self_->impl_.get_service().linked_timeout_available(
+          self_->impl_.get_implementation(), socket_base::wait_write);
+    }
+
+    template <typename ConnectHandler, typename ConstBufferSequence>
+    void operator()(ConnectHandler&& handler,
+        const endpoint_type& peer_endpoint,
+        const ConstBufferSequence& initial_data,
+        const asio::error_code& open_ec) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a WriteHandler.
+      ASIO_WRITE_HANDLER_CHECK(ConnectHandler, handler) type_check;
+
+      if (open_ec)
+      {
+        asio::post(self_->impl_.get_executor(),
+            asio::detail::bind_handler(
+              static_cast<ConnectHandler&&>(handler),
+              open_ec, std::size_t(0)));
+      }
+      else
+      {
+        detail::non_const_lvalue<ConnectHandler> handler2(handler);
+        self_->impl_.get_service().async_connect(
+            self_->impl_.get_implementation(), peer_endpoint, initial_data,
+            handler2.value, self_->impl_.get_executor());
+      }
+    }
+
+  private:
+    basic_stream_socket* self_;
+  };
+#endif // defined(ASIO_HAS_TCP_FASTOPEN)
 };
 
 } // namespace asio
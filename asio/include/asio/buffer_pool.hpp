@@ -0,0 +1,418 @@
+//
+// buffer_pool.hpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_BUFFER_POOL_HPP
+#define ASIO_BUFFER_POOL_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+#include <vector>
+#include "asio/async_result.hpp"
+#include "asio/buffer.hpp"
+#include "asio/detail/memory.hpp"
+#include "asio/detail/mutex.hpp"
+#include "asio/detail/noncopyable.hpp"
+#include "asio/detail/thread_context.hpp"
+#include "asio/error.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+
+class buffer_pool;
+
+/// A handle to a block of memory owned by a buffer_pool.
+/**
+ * A pooled_buffer object owns a single block of memory allocated from a
+ * buffer_pool, and returns the block to the pool when it is destroyed. The
+ * pool must outlive all of the pooled_buffer objects that refer to it.
+ *
+ * In addition to the block itself, the object records the number of bytes in
+ * the block that hold valid data.
+ */
+class pooled_buffer
+{
+public:
+  /// Construct an empty handle.
+  pooled_buffer() noexcept
+    : pool_(0),
+      data_(0),
+      size_(0)
+  {
+  }
+
+  /// Move construct a handle, transferring ownership of the block.
+  pooled_buffer(pooled_buffer&& other) noexcept
+    : pool_(other.pool_),
+      data_(other.data_),
+      size_(other.size_)
+  {
+    other.pool_ = 0;
+    other.data_ = 0;
+    other.size_ = 0;
+  }
+
+  /// Move assign a handle, transferring ownership of the block.
+  pooled_buffer& operator=(pooled_buffer&& other) noexcept
+  {
+    if (this != &other)
+    {
+      reset();
+      pool_ = other.pool_;
+      data_ = other.data_;
+      size_ = other.size_;
+      other.pool_ = 0;
+      other.data_ = 0;
+      other.size_ = 0;
+    }
+    return *this;
+  }
+
+  /// Destructor returns the block to the pool.
+  ~pooled_buffer()
+  {
+    reset();
+  }
+
+  /// Determine whether the handle owns a block.
+  explicit operator bool() const noexcept
+  {
+    return data_ != 0;
+  }
+
+  /// Get a pointer to the beginning of the block.
+  void* data() const noexcept
+  {
+    return data_;
+  }
+
+  /// Get the number of bytes in the block that hold valid data.
+  std::size_t size() const noexcept
+  {
+    return size_;
+  }
+
+  /// Set the number of bytes in the block that hold valid data.
+  /**
+   * @param n The new size. Must not be greater than capacity().
+   */
+  void resize(std::size_t n) noexcept
+  {
+    size_ = n;
+  }
+
+  /// Get the size of the block.
+  inline std::size_t capacity() const noexcept;
+
+  /// Get a buffer that represents the whole block.
+  mutable_buffer block() const noexcept
+  {
+    return mutable_buffer(data_, capacity());
+  }
+
+  /// Get a buffer that represents the valid data in the block.
+  const_buffer contents() const noexcept
+  {
+    return const_buffer(data_, size_);
+  }
+
+  /// Return the block to the pool, leaving the handle empty.
+  inline void reset() noexcept;
+
+private:
+  friend class buffer_pool;
+
+  pooled_buffer(buffer_pool* pool, void* data) noexcept
+    : pool_(pool),
+      data_(data),
+      size_(0)
+  {
+  }
+
+  buffer_pool* pool_;
+  void* data_;
+  std::size_t size_;
+};
+
+/// A pool of fixed-size, cache-line aligned blocks of memory.
+/**
+ * The buffer_pool class allocates blocks of memory of a single size, and
+ * keeps the blocks that are returned to it for reuse. It is intended for
+ * receive buffers, so that a connection holds a block only while there is
+ * data to be processed, rather than owning a buffer sized for the largest
+ * possible message for its whole lifetime.
+ *
+ * Each block is aligned to, and its size is rounded up to a multiple of,
+ * @c cache_line_size bytes.
+ *
+ * Returned blocks are kept on several free lists, each protected by its own
+ * lock. A thread that is running an io_context uses the free list selected by
+ * its per-thread state, so that threads running the same io_context will
+ * usually use different free lists. Other threads share a single free list.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Safe.
+ */
+class buffer_pool
+  : private noncopyable
+{
+public:
+#if defined(GENERATING_DOCUMENTATION)
+  /// The alignment of each block, and the granularity of the block size.
+  static const std::size_t cache_line_size = implementation_defined;
+#else
+  ASIO_STATIC_CONSTANT(std::size_t, cache_line_size = 64);
+#endif
+
+  /// Construct a buffer pool.
+  /**
+   * @param block_size The minimum size of each block, in bytes. The size is
+   * rounded up to a multiple of @c cache_line_size.
+   *
+   * @param max_free_blocks The maximum number of returned blocks that each
+   * free list keeps for reuse. Blocks that are returned to a full free list
+   * are freed.
+   */
+  explicit buffer_pool(std::size_t block_size,
+      std::size_t max_free_blocks = 128)
+    : block_size_(round_up(block_size)),
+      max_free_per_list_(max_free_blocks)
+  {
+  }
+
+  /// Destructor frees all blocks held for reuse.
+  /**
+   * All pooled_buffer objects allocated from the pool must have been
+   * destroyed.
+   */
+  ~buffer_pool()
+  {
+    release();
+  }
+
+  /// Get the size of each block.
+  std::size_t block_size() const noexcept
+  {
+    return block_size_;
+  }
+
+  /// Allocate a block.
+  /**
+   * Reuses a block that has been returned to the pool, if one is available.
+   * Otherwise a new block is allocated.
+   *
+   * @throws std::bad_alloc Thrown if a new block cannot be allocated.
+   */
+  pooled_buffer allocate()
+  {
+    free_list& list = current_list();
+    {
+      detail::mutex::scoped_lock lock(list.mutex_);
+      if (!list.blocks_.empty())
+      {
+        void* p = list.blocks_.back();
+        list.blocks_.pop_back();
+        return pooled_buffer(this, p);
+      }
+    }
+
+    return pooled_buffer(this,
+        aligned_new(cache_line_size, block_size_));
+  }
+
+  /// Get the number of blocks held for reuse.
+  std::size_t free_blocks() const
+  {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < list_count; ++i)
+    {
+      detail::mutex::scoped_lock lock(lists_[i].mutex_);
+      count += lists_[i].blocks_.size();
+    }
+    return count;
+  }
+
+  /// Free all blocks held for reuse.
+  void release()
+  {
+    for (std::size_t i = 0; i < list_count; ++i)
+    {
+      std::vector<void*> blocks;
+      {
+        detail::mutex::scoped_lock lock(lists_[i].mutex_);
+        blocks.swap(lists_[i].blocks_);
+      }
+      for (std::size_t j = 0; j < blocks.size(); ++j)
+        aligned_delete(blocks[j]);
+    }
+  }
+
+private:
+  friend class pooled_buffer;
+
+  // The number of free lists.
+  ASIO_STATIC_CONSTANT(std::size_t, list_count = 8);
+
+  // A free list, padded so that adjacent lists do not share a cache line.
+  struct free_list
+  {
+    mutable detail::mutex mutex_;
+    std::vector<void*> blocks_;
+    char padding_[cache_line_size];
+  };
+
+  static std::size_t round_up(std::size_t n)
+  {
+    n = n ? n : 1;
+    return (n + cache_line_size - 1) / cache_line_size * cache_line_size;
+  }
+
+  // Select the free list for the calling thread.
+  free_list& current_list()
+  {
+    std::size_t index = 0;
+    if (detail::thread_info_base* this_thread =
+        detail::thread_context::top_of_thread_call_stack())
+    {
+      std::size_t key = reinterpret_cast<std::size_t>(this_thread);
+      index = (key / cache_line_size) % list_count;
+    }
+    return lists_[index];
+  }
+
+  void deallocate(void* p)
+  {
+    free_list& list = current_list();
+    {
+      detail::mutex::scoped_lock lock(list.mutex_);
+      if (list.blocks_.size() < max_free_per_list_)
+      {
+        list.blocks_.push_back(p);
+        return;
+      }
+    }
+
+    aligned_delete(p);
+  }
+
+  const std::size_t block_size_;
+  const std::size_t max_free_per_list_;
+  free_list lists_[list_count];
+};
+
+inline std::size_t pooled_buffer::capacity() const noexcept
+{
+  return pool_ ? pool_->block_size() : 0;
+}
+
+inline void pooled_buffer::reset() noexcept
+{
+  if (pool_)
+  {
+    pool_->deallocate(data_);
+    pool_ = 0;
+    data_ = 0;
+    size_ = 0;
+  }
+}
+
+namespace detail {
+
+template <typename> class initiate_async_read_some_pooled;
+
+} // namespace detail
+
+/// Start an asynchronous operation to read data into a block from a pool,
+/// once data is available.
+/**
+ * This function waits until the stream is ready to read, and only then
+ * allocates a block from the pool and reads into it. A connection that is
+ * waiting for data therefore holds no receive memory. It is an initiating
+ * function for an @ref asynchronous_operation, and always returns
+ * immediately.
+ *
+ * @param s The stream from which the data is to be read. The type must support
+ * the AsyncReadStream requirements, and provide an @c async_wait member
+ * function, as asio::basic_stream_socket does.
+ *
+ * @param pool The pool from which the block is allocated. Ownership of the
+ * pool is retained by the caller, which must guarantee that it remains valid
+ * until the block has been returned to it.
+ *
+ * @param token The @ref completion_token that will be used to produce a
+ * completion handler, which will be called when the read completes.
+ * Potential completion tokens include @ref use_future, @ref use_awaitable,
+ * @ref yield_context, or a function object with the correct completion
+ * signature. The function signature of the completion handler must be:
+ * @code void handler(
+ *   // Result of operation.
+ *   const asio::error_code& error,
+ *
+ *   // The block containing the data that was read. Its size() is the
+ *   // number of bytes read. If an error occurred, the handle is empty.
+ *   asio::pooled_buffer buffer
+ * ); @endcode
+ * Regardless of whether the asynchronous operation completes immediately or
+ * not, the completion handler will not be invoked from within this function.
+ * On immediate completion, invocation of the handler will be performed in a
+ * manner equivalent to using asio::post().
+ *
+ * @par Completion Signature
+ * @code void(asio::error_code, asio::pooled_buffer) @endcode
+ *
+ * @par Example
+ * @code
+ * asio::buffer_pool pool(65536);
+ * ...
+ * asio::async_read_some_pooled(socket, pool,
+ *     [](asio::error_code ec, asio::pooled_buffer b)
+ *     {
+ *       if (!ec)
+ *         process(b.contents());
+ *     }); @endcode
+ *
+ * @par Per-Operation Cancellation
+ * This asynchronous operation supports cancellation for the following
+ * asio::cancellation_type values:
+ *
+ * @li @c cancellation_type::terminal
+ *
+ * @li @c cancellation_type::partial
+ *
+ * @li @c cancellation_type::total
+ *
+ * if they are also supported by the stream's @c async_wait and
+ * @c async_read_some operations.
+ */
+template <typename AsyncReadStream,
+    ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+      pooled_buffer)) ReadToken = default_completion_token_t<
+        typename AsyncReadStream::executor_type>>
+inline auto async_read_some_pooled(AsyncReadStream& s, buffer_pool& pool,
+    ReadToken&& token = default_completion_token_t<
+      typename AsyncReadStream::executor_type>())
+  -> decltype(
+    async_initiate<ReadToken,
+      void (asio::error_code, pooled_buffer)>(
+        declval<detail::initiate_async_read_some_pooled<AsyncReadStream>>(),
+        token, declval<buffer_pool*>()));
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#include "asio/impl/buffer_pool.hpp"
+
+#endif // ASIO_BUFFER_POOL_HPP
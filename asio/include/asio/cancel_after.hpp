@@ -172,6 +172,14 @@ public:
  * async_wait completes first, a cancellation request is emitted to cancel the
  * main operation. Consequently, the application must ensure that the
  * asynchronous operation is performed within an implicit or explicit strand.
+ *
+ * @par Linked Timeouts
+ * When io_uring is used to perform socket or file operations, and the
+ * operation can be submitted to the kernel immediately, the timeout is instead
+ * submitted as a timeout linked to the operation and no timer is used. The
+ * deadline is absolute and is computed when the operation is initiated. An
+ * operation that must wait behind other operations on the same object uses a
+ * timer as described above.
  */
 template <typename Rep, typename Period>
 ASIO_NODISCARD inline partial_cancel_after<chrono::steady_clock>
@@ -212,6 +220,14 @@ cancel_after(basic_waitable_timer<Clock, WaitTraits, Executor>& timer,
  * async_wait completes first, a cancellation request is emitted to cancel the
  * main operation. Consequently, the application must ensure that the
  * asynchronous operation is performed within an implicit or explicit strand.
+ *
+ * @par Linked Timeouts
+ * When io_uring is used to perform socket or file operations, and the
+ * operation can be submitted to the kernel immediately, the timeout is instead
+ * submitted as a timeout linked to the operation and no timer is used. The
+ * deadline is absolute and is computed when the operation is initiated. An
+ * operation that must wait behind other operations on the same object uses a
+ * timer as described above.
  */
 template <typename Rep, typename Period, typename CompletionToken>
 ASIO_NODISCARD inline
@@ -233,6 +249,14 @@ cancel_after(const chrono::duration<Rep, Period>& timeout,
  * async_wait completes first, a cancellation request is emitted to cancel the
  * main operation. Consequently, the application must ensure that the
  * asynchronous operation is performed within an implicit or explicit strand.
+ *
+ * @par Linked Timeouts
+ * When io_uring is used to perform socket or file operations, and the
+ * operation can be submitted to the kernel immediately, the timeout is instead
+ * submitted as a timeout linked to the operation and no timer is used. The
+ * deadline is absolute and is computed when the operation is initiated. An
+ * operation that must wait behind other operations on the same object uses a
+ * timer as described above.
  */
 template <typename Rep, typename Period, typename CompletionToken>
 ASIO_NODISCARD inline
@@ -170,6 +170,14 @@ public:
  * async_wait completes first, a cancellation request is emitted to cancel the
  * main operation. Consequently, the application must ensure that the
  * asynchronous operation is performed within an implicit or explicit strand.
+ *
+ * @par Linked Timeouts
+ * When io_uring is used to perform socket or file operations, and the
+ * operation can be submitted to the kernel immediately, the timeout is instead
+ * submitted as a timeout linked to the operation and no timer is used. The
+ * deadline is absolute and is computed when the operation is initiated. An
+ * operation that must wait behind other operations on the same object uses a
+ * timer as described above.
  */
 template <typename Clock, typename Duration>
 ASIO_NODISCARD inline partial_cancel_at<Clock>
@@ -209,6 +217,14 @@ cancel_at(basic_waitable_timer<Clock, WaitTraits, Executor>& timer,
  * async_wait completes first, a cancellation request is emitted to cancel the
  * main operation. Consequently, the application must ensure that the
  * asynchronous operation is performed within an implicit or explicit strand.
+ *
+ * @par Linked Timeouts
+ * When io_uring is used to perform socket or file operations, and the
+ * operation can be submitted to the kernel immediately, the timeout is instead
+ * submitted as a timeout linked to the operation and no timer is used. The
+ * deadline is absolute and is computed when the operation is initiated. An
+ * operation that must wait behind other operations on the same object uses a
+ * timer as described above.
  */
 template <typename CompletionToken, typename Clock, typename Duration>
 ASIO_NODISCARD inline cancel_at_t<decay_t<CompletionToken>, Clock>
@@ -229,6 +245,14 @@ cancel_at(const chrono::time_point<Clock, Duration>& expiry,
  * async_wait completes first, a cancellation request is emitted to cancel the
  * main operation. Consequently, the application must ensure that the
  * asynchronous operation is performed within an implicit or explicit strand.
+ *
+ * @par Linked Timeouts
+ * When io_uring is used to perform socket or file operations, and the
+ * operation can be submitted to the kernel immediately, the timeout is instead
+ * submitted as a timeout linked to the operation and no timer is used. The
+ * deadline is absolute and is computed when the operation is initiated. An
+ * operation that must wait behind other operations on the same object uses a
+ * timer as described above.
  */
 template <typename CompletionToken, typename Clock, typename Duration>
 ASIO_NODISCARD inline cancel_at_t<decay_t<CompletionToken>, Clock>
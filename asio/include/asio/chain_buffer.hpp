@@ -0,0 +1,657 @@
+//
+// chain_buffer.hpp
+// ~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_CHAIN_BUFFER_HPP
+#define ASIO_CHAIN_BUFFER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "asio/buffer.hpp"
+#include "asio/detail/noncopyable.hpp"
+#include "asio/detail/throw_exception.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+
+namespace detail {
+
+// A range of bytes in a chain of fixed-size blocks.
+struct chain_buffer_range
+{
+  // The blocks in the chain.
+  const std::deque<char*>* blocks;
+
+  // The index of the block that holds the first byte of the range.
+  std::size_t first;
+
+  // The offset of the first byte of the range in its block.
+  std::size_t offset;
+
+  // The size of the range.
+  std::size_t size;
+
+  // The size of each block.
+  std::size_t block_size;
+
+  // The number of blocks spanned by the range.
+  std::size_t count() const noexcept
+  {
+    return size == 0 ? 0 : (offset + size - 1) / block_size + 1;
+  }
+
+  // Get the part of the range held by the specified block in the range.
+  std::pair<char*, std::size_t> at(std::size_t index) const noexcept
+  {
+    std::size_t start = index == 0 ? offset : 0;
+    std::size_t end = offset + size - index * block_size;
+    if (end > block_size)
+      end = block_size;
+    return std::make_pair((*blocks)[first + index] + start, end - start);
+  }
+};
+
+} // namespace detail
+
+/// A sequence of buffers that refers to a range of bytes in a chain of
+/// blocks.
+/**
+ * The chain_buffer_sequence class template is the buffer sequence type used
+ * by basic_chain_buffer and dynamic_chain_buffer. It contains one buffer for
+ * each block that holds part of the range.
+ */
+template <typename Buffer>
+class chain_buffer_sequence
+{
+public:
+  /// The type for each element in the list of buffers.
+  typedef Buffer value_type;
+
+#if defined(GENERATING_DOCUMENTATION)
+  /// A bidirectional iterator type that may be used to read elements.
+  typedef implementation_defined const_iterator;
+#else // defined(GENERATING_DOCUMENTATION)
+  class const_iterator
+  {
+  public:
+    typedef std::bidirectional_iterator_tag iterator_category;
+    typedef Buffer value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const Buffer* pointer;
+    typedef Buffer reference;
+
+    const_iterator() noexcept
+      : range_(),
+        index_(0)
+    {
+    }
+
+    const_iterator(const detail::chain_buffer_range& range,
+        std::size_t index) noexcept
+      : range_(range),
+        index_(index)
+    {
+    }
+
+    Buffer operator*() const noexcept
+    {
+      std::pair<char*, std::size_t> block = range_.at(index_);
+      return Buffer(block.first, block.second);
+    }
+
+    const_iterator& operator++() noexcept
+    {
+      ++index_;
+      return *this;
+    }
+
+    const_iterator operator++(int) noexcept
+    {
+      const_iterator tmp(*this);
+      ++index_;
+      return tmp;
+    }
+
+    const_iterator& operator--() noexcept
+    {
+      --index_;
+      return *this;
+    }
+
+    const_iterator operator--(int) noexcept
+    {
+      const_iterator tmp(*this);
+      --index_;
+      return tmp;
+    }
+
+    friend bool operator==(const const_iterator& a,
+        const const_iterator& b) noexcept
+    {
+      return a.index_ == b.index_;
+    }
+
+    friend bool operator!=(const const_iterator& a,
+        const const_iterator& b) noexcept
+    {
+      return a.index_ != b.index_;
+    }
+
+  private:
+    detail::chain_buffer_range range_;
+    std::size_t index_;
+  };
+
+  // Construct a sequence that refers to a range of bytes.
+  explicit chain_buffer_sequence(
+      const detail::chain_buffer_range& range) noexcept
+    : range_(range)
+  {
+  }
+#endif // defined(GENERATING_DOCUMENTATION)
+
+  /// Get a bidirectional iterator to the first element.
+  const_iterator begin() const noexcept
+  {
+    return const_iterator(range_, 0);
+  }
+
+  /// Get a bidirectional iterator for one past the last element.
+  const_iterator end() const noexcept
+  {
+    return const_iterator(range_, range_.count());
+  }
+
+private:
+  detail::chain_buffer_range range_;
+};
+
+/// Dynamically sized storage made up of a chain of fixed-size blocks.
+/**
+ * The @c basic_chain_buffer class stores its data in a chain of blocks of
+ * equal size. Unlike @c basic_streambuf or a @c std::vector used with
+ * dynamic_vector_buffer, growing the storage never reallocates or copies the
+ * existing data, and consuming data from the front never moves the remaining
+ * data. Blocks that are released from either end of the chain are kept for
+ * reuse, so that a long-lived buffer reaches a steady state in which no
+ * memory is allocated.
+ *
+ * The data is represented as a sequence of buffers, one for each block. A
+ * basic_chain_buffer object is used with the DynamicBuffer_v2 requirements
+ * through the dynamic_chain_buffer class, which is created by calling
+ * asio::dynamic_buffer().
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe.
+ *
+ * @par Example
+ * Reading a message header, and then consuming it, without moving the data
+ * that follows it:
+ * @code asio::chain_buffer b;
+ * std::size_t n = asio::read_until(sock, asio::dynamic_buffer(b), "\r\n\r\n");
+ * // ... parse the header using b.data(0, n) ...
+ * b.consume(n); @endcode
+ */
+template <typename Allocator = std::allocator<char>>
+class basic_chain_buffer
+  : private noncopyable
+{
+public:
+  /// The type of the allocator used to allocate blocks.
+  typedef Allocator allocator_type;
+
+  /// The type used to represent a sequence of constant buffers that refers to
+  /// the stored data.
+  typedef chain_buffer_sequence<const_buffer> const_buffers_type;
+
+  /// The type used to represent a sequence of mutable buffers that refers to
+  /// the stored data.
+  typedef chain_buffer_sequence<mutable_buffer> mutable_buffers_type;
+
+#if defined(GENERATING_DOCUMENTATION)
+  /// The default size of each block, in bytes.
+  static const std::size_t default_block_size = implementation_defined;
+#else
+  ASIO_STATIC_CONSTANT(std::size_t, default_block_size = 4096);
+#endif
+
+  /// Construct a chain buffer.
+  /**
+   * @param block_size The size of each block, in bytes. If zero, the default
+   * block size is used.
+   *
+   * @param maximum_size Specifies a maximum size for the buffer, in bytes.
+   *
+   * @param allocator The allocator used to allocate blocks.
+   */
+  explicit basic_chain_buffer(
+      std::size_t block_size = default_block_size,
+      std::size_t maximum_size = (std::numeric_limits<std::size_t>::max)(),
+      const Allocator& allocator = Allocator())
+    : allocator_(allocator),
+      block_size_(block_size ? block_size
+          : static_cast<std::size_t>(default_block_size)),
+      max_size_(maximum_size),
+      offset_(0),
+      size_(0)
+  {
+  }
+
+  /// Destructor releases all blocks.
+  ~basic_chain_buffer()
+  {
+    for (std::size_t i = 0; i < blocks_.size(); ++i)
+      deallocate_block(blocks_[i]);
+    for (std::size_t i = 0; i < spare_.size(); ++i)
+      deallocate_block(spare_[i]);
+  }
+
+  /// Get the allocator used to allocate blocks.
+  allocator_type get_allocator() const noexcept
+  {
+    return allocator_;
+  }
+
+  /// Get the size of each block.
+  std::size_t block_size() const noexcept
+  {
+    return block_size_;
+  }
+
+  /// Get the size of the stored data.
+  std::size_t size() const noexcept
+  {
+    return size_;
+  }
+
+  /// Get the maximum size of the stored data.
+  std::size_t max_size() const noexcept
+  {
+    return max_size_;
+  }
+
+  /// Get the number of bytes that the data may grow to without allocating
+  /// memory.
+  std::size_t capacity() const noexcept
+  {
+    return (blocks_.size() + spare_.size()) * block_size_ - offset_;
+  }
+
+  /// Get a sequence of buffers that represents the stored data.
+  /**
+   * @param pos Position of the first byte to represent in the buffer
+   * sequence.
+   *
+   * @param n The number of bytes to return in the buffer sequence. If the
+   * stored data is shorter, the buffer sequence represents as many bytes as
+   * are available.
+   *
+   * @note The returned object is invalidated by any basic_chain_buffer member
+   * function that modifies the stored data.
+   */
+  mutable_buffers_type data(std::size_t pos, std::size_t n) noexcept
+  {
+    return range<mutable_buffers_type>(pos, n);
+  }
+
+  /// Get a sequence of buffers that represents the stored data.
+  /**
+   * @param pos Position of the first byte to represent in the buffer
+   * sequence.
+   *
+   * @param n The number of bytes to return in the buffer sequence. If the
+   * stored data is shorter, the buffer sequence represents as many bytes as
+   * are available.
+   *
+   * @note The returned object is invalidated by any basic_chain_buffer member
+   * function that modifies the stored data.
+   */
+  const_buffers_type data(std::size_t pos, std::size_t n) const noexcept
+  {
+    return range<const_buffers_type>(pos, n);
+  }
+
+  /// Grow the stored data by the specified number of bytes.
+  /**
+   * Blocks are added to the end of the chain as required. The existing data
+   * is not moved.
+   *
+   * @throws std::length_error If <tt>size() + n > max_size()</tt>.
+   */
+  void grow(std::size_t n)
+  {
+    if (size_ > max_size_ || max_size_ - size_ < n)
+    {
+      std::length_error ex("basic_chain_buffer too long");
+      asio::detail::throw_exception(ex);
+    }
+
+    std::size_t required = offset_ + size_ + n;
+    while (blocks_.size() * block_size_ < required)
+    {
+      if (spare_.empty())
+      {
+        char* block = allocate_block();
+#if !defined(ASIO_NO_EXCEPTIONS)
+        try
+#endif // !defined(ASIO_NO_EXCEPTIONS)
+        {
+          blocks_.push_back(block);
+        }
+#if !defined(ASIO_NO_EXCEPTIONS)
+        catch (...)
+        {
+          deallocate_block(block);
+          throw;
+        }
+#endif // !defined(ASIO_NO_EXCEPTIONS)
+      }
+      else
+      {
+        blocks_.push_back(spare_.back());
+        spare_.pop_back();
+      }
+    }
+
+    size_ += n;
+  }
+
+  /// Shrink the stored data by the specified number of bytes.
+  /**
+   * Removes @c n bytes from the end of the stored data. If @c n is greater
+   * than the size of the stored data, the data is emptied. Blocks that no
+   * longer hold any data are kept for reuse.
+   */
+  void shrink(std::size_t n) noexcept
+  {
+    size_ -= (std::min)(n, size_);
+    trim();
+  }
+
+  /// Consume the specified number of bytes from the beginning of the stored
+  /// data.
+  /**
+   * Removes @c n bytes from the beginning of the stored data. If @c n is
+   * greater than the size of the stored data, the data is emptied. The
+   * remaining data is not moved, and blocks that no longer hold any data are
+   * kept for reuse.
+   */
+  void consume(std::size_t n) noexcept
+  {
+    n = (std::min)(n, size_);
+    offset_ += n;
+    size_ -= n;
+    while (offset_ >= block_size_ && !blocks_.empty())
+    {
+      spare_.push_back(blocks_.front());
+      blocks_.pop_front();
+      offset_ -= block_size_;
+    }
+    trim();
+  }
+
+  /// Release the memory held by blocks that are being kept for reuse.
+  void shrink_to_fit() noexcept
+  {
+    for (std::size_t i = 0; i < spare_.size(); ++i)
+      deallocate_block(spare_[i]);
+    spare_.clear();
+  }
+
+private:
+  typedef typename std::allocator_traits<Allocator>::template
+    rebind_alloc<char> block_allocator_type;
+
+  // Move the blocks that hold no data from the end of the chain to the spare
+  // list. An empty chain starts again from the beginning of a block.
+  void trim() noexcept
+  {
+    if (size_ == 0)
+      offset_ = 0;
+    while (blocks_.size() * block_size_ >= offset_ + size_ + block_size_)
+    {
+      spare_.push_back(blocks_.back());
+      blocks_.pop_back();
+    }
+  }
+
+  template <typename Buffers>
+  Buffers range(std::size_t pos, std::size_t n) const noexcept
+  {
+    pos = (std::min)(pos, size_);
+    n = (std::min)(n, size_ - pos);
+    std::size_t start = offset_ + pos;
+    detail::chain_buffer_range r = { &blocks_,
+      start / block_size_, start % block_size_, n, block_size_ };
+    return Buffers(r);
+  }
+
+  char* allocate_block()
+  {
+    block_allocator_type allocator(allocator_);
+    return std::allocator_traits<block_allocator_type>::allocate(
+        allocator, block_size_);
+  }
+
+  void deallocate_block(char* block) noexcept
+  {
+    block_allocator_type allocator(allocator_);
+    std::allocator_traits<block_allocator_type>::deallocate(
+        allocator, block, block_size_);
+  }
+
+  Allocator allocator_;
+  const std::size_t block_size_;
+  const std::size_t max_size_;
+
+  // The blocks that hold the data.
+  std::deque<char*> blocks_;
+
+  // The blocks that are kept for reuse.
+  std::vector<char*> spare_;
+
+  // The offset of the first byte of data in the first block.
+  std::size_t offset_;
+
+  // The size of the data.
+  std::size_t size_;
+};
+
+/// Typedef for the typical usage of basic_chain_buffer.
+typedef basic_chain_buffer<> chain_buffer;
+
+/// Adapt a basic_chain_buffer to the DynamicBuffer_v2 requirements.
+/**
+ * The dynamic_chain_buffer class template stores a reference to a
+ * basic_chain_buffer. Copies of a dynamic_chain_buffer object refer to the
+ * same underlying storage.
+ */
+template <typename Allocator>
+class dynamic_chain_buffer
+{
+public:
+  /// The type used to represent a sequence of constant buffers that refers to
+  /// the underlying memory.
+  typedef typename basic_chain_buffer<Allocator>::const_buffers_type
+    const_buffers_type;
+
+  /// The type used to represent a sequence of mutable buffers that refers to
+  /// the underlying memory.
+  typedef typename basic_chain_buffer<Allocator>::mutable_buffers_type
+    mutable_buffers_type;
+
+  /// Construct a dynamic buffer from a basic_chain_buffer.
+  /**
+   * @param b The chain buffer to be used as backing storage for the dynamic
+   * buffer. The object stores a reference to the chain buffer and the user is
+   * responsible for ensuring that the chain buffer object remains valid while
+   * the dynamic_chain_buffer object, and copies of the object, are in use.
+   *
+   * @param maximum_size Specifies a maximum size for the buffer, in bytes.
+   * The smaller of this value and the chain buffer's own maximum size is
+   * used.
+   */
+  explicit dynamic_chain_buffer(basic_chain_buffer<Allocator>& b,
+      std::size_t maximum_size =
+        (std::numeric_limits<std::size_t>::max)()) noexcept
+    : chain_(b),
+      max_size_((std::min)(maximum_size, b.max_size()))
+  {
+  }
+
+  /// Copy construct a dynamic buffer.
+  dynamic_chain_buffer(const dynamic_chain_buffer& other) noexcept
+    : chain_(other.chain_),
+      max_size_(other.max_size_)
+  {
+  }
+
+  /// Get the current size of the underlying memory.
+  std::size_t size() const noexcept
+  {
+    return chain_.size();
+  }
+
+  /// Get the maximum size of the dynamic buffer.
+  std::size_t max_size() const noexcept
+  {
+    return max_size_;
+  }
+
+  /// Get the maximum size that the buffer may grow to without allocating
+  /// memory.
+  std::size_t capacity() const noexcept
+  {
+    return (std::min)(chain_.capacity(), max_size_);
+  }
+
+  /// Get a sequence of buffers that represents the underlying memory.
+  /**
+   * @param pos Position of the first byte to represent in the buffer
+   * sequence.
+   *
+   * @param n The number of bytes to return in the buffer sequence. If the
+   * underlying memory is shorter, the buffer sequence represents as many bytes
+   * as are available.
+   *
+   * @note The returned object is invalidated by any dynamic_chain_buffer or
+   * basic_chain_buffer member function that modifies the underlying memory.
+   */
+  mutable_buffers_type data(std::size_t pos, std::size_t n) noexcept
+  {
+    return chain_.data(pos, n);
+  }
+
+  /// Get a sequence of buffers that represents the underlying memory.
+  /**
+   * @param pos Position of the first byte to represent in the buffer
+   * sequence.
+   *
+   * @param n The number of bytes to return in the buffer sequence. If the
+   * underlying memory is shorter, the buffer sequence represents as many bytes
+   * as are available.
+   *
+   * @note The returned object is invalidated by any dynamic_chain_buffer or
+   * basic_chain_buffer member function that modifies the underlying memory.
+   */
+  const_buffers_type data(std::size_t pos, std::size_t n) const noexcept
+  {
+    return const_cast<const basic_chain_buffer<Allocator>&>(
+        chain_).data(pos, n);
+  }
+
+  /// Grow the underlying memory by the specified number of bytes.
+  /**
+   * @throws std::length_error If <tt>size() + n > max_size()</tt>.
+   */
+  void grow(std::size_t n)
+  {
+    if (size() > max_size_ || max_size_ - size() < n)
+    {
+      std::length_error ex("dynamic_chain_buffer too long");
+      asio::detail::throw_exception(ex);
+    }
+
+    chain_.grow(n);
+  }
+
+  /// Shrink the underlying memory by the specified number of bytes.
+  /**
+   * Erases @c n bytes from the end of the underlying memory. If @c n is
+   * greater than the current size, the underlying memory is emptied.
+   */
+  void shrink(std::size_t n) noexcept
+  {
+    chain_.shrink(n);
+  }
+
+  /// Consume the specified number of bytes from the beginning of the
+  /// underlying memory.
+  /**
+   * Erases @c n bytes from the beginning of the underlying memory. If @c n is
+   * greater than the current size, the underlying memory is emptied.
+   */
+  void consume(std::size_t n) noexcept
+  {
+    chain_.consume(n);
+  }
+
+private:
+  basic_chain_buffer<Allocator>& chain_;
+  const std::size_t max_size_;
+};
+
+/** @addtogroup dynamic_buffer */
+/*@{*/
+
+/// Create a new dynamic buffer that represents the given chain buffer.
+/**
+ * @returns <tt>dynamic_chain_buffer<Allocator>(data)</tt>.
+ */
+template <typename Allocator>
+ASIO_NODISCARD inline
+dynamic_chain_buffer<Allocator> dynamic_buffer(
+    basic_chain_buffer<Allocator>& data) noexcept
+{
+  return dynamic_chain_buffer<Allocator>(data);
+}
+
+/// Create a new dynamic buffer that represents the given chain buffer.
+/**
+ * @returns <tt>dynamic_chain_buffer<Allocator>(data, max_size)</tt>.
+ */
+template <typename Allocator>
+ASIO_NODISCARD inline
+dynamic_chain_buffer<Allocator> dynamic_buffer(
+    basic_chain_buffer<Allocator>& data, std::size_t max_size) noexcept
+{
+  return dynamic_chain_buffer<Allocator>(data, max_size);
+}
+
+/*@}*/
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_CHAIN_BUFFER_HPP
@@ -0,0 +1,406 @@
+//
+// coalescing_write_stream.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_COALESCING_WRITE_STREAM_HPP
+#define ASIO_COALESCING_WRITE_STREAM_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <vector>
+#include "asio/any_completion_handler.hpp"
+#include "asio/async_result.hpp"
+#include "asio/basic_waitable_timer.hpp"
+#include "asio/buffer.hpp"
+#include "asio/detail/chrono.hpp"
+#include "asio/detail/cstdint.hpp"
+#include "asio/detail/noncopyable.hpp"
+#include "asio/detail/type_traits.hpp"
+#include "asio/error.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+template <typename> class initiate_async_coalescing_flush;
+template <typename> class initiate_async_coalescing_write_some;
+template <typename> class coalescing_flush_op;
+template <typename, typename> class coalescing_write_some_op;
+template <typename> class coalescing_timer_handler;
+template <typename> class coalescing_write_handler;
+
+} // namespace detail
+
+/// Adds write buffering with a bounded flush latency to a stream.
+/**
+ * The coalescing_write_stream class template copies the data passed to
+ * asynchronous write operations into an internal buffer, and writes the
+ * buffered data to the next layer when either:
+ *
+ * @li the number of bytes buffered reaches the flush threshold; or
+ *
+ * @li the oldest buffered byte has waited for the maximum flush latency; or
+ *
+ * @li a flush is requested using async_flush().
+ *
+ * This allows many small writes, such as those produced by a protocol that
+ * sends a message per event, to be combined into fewer and larger writes to
+ * the next layer, while placing an upper bound on the delay that is added to
+ * any byte. A single timer per stream is used to enforce the latency bound.
+ *
+ * The data is double buffered: while the buffered data is being written to
+ * the next layer, further writes are copied into a second buffer, which is
+ * written when the first write completes. A write operation completes as
+ * soon as its data has been copied. When both buffers are full, write
+ * operations wait for the write in progress to complete.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe.
+ *
+ * The operations on the stream, and the stream's internal writes and timer,
+ * must be performed in the context of an implicit or explicit strand.
+ *
+ * @par Concepts:
+ * AsyncReadStream, AsyncWriteStream.
+ */
+template <typename Stream>
+class coalescing_write_stream
+  : private noncopyable
+{
+public:
+  /// The type of the next layer.
+  typedef remove_reference_t<Stream> next_layer_type;
+
+  /// The type of the executor associated with the object.
+  typedef typename next_layer_type::executor_type executor_type;
+
+  /// The clock type used to measure the flush latency.
+  typedef chrono::steady_clock clock_type;
+
+  /// The duration type used to specify the maximum flush latency.
+  typedef clock_type::duration duration;
+
+#if defined(GENERATING_DOCUMENTATION)
+  /// The default flush threshold, in bytes.
+  static const std::size_t default_flush_threshold = implementation_defined;
+
+  /// The default maximum flush latency, in microseconds.
+  static const long default_max_latency_us = implementation_defined;
+#else
+  ASIO_STATIC_CONSTANT(std::size_t, default_flush_threshold = 16384);
+  ASIO_STATIC_CONSTANT(long, default_max_latency_us = 200);
+#endif
+
+  /// Construct, passing the specified argument to initialise the next layer.
+  /**
+   * The stream uses the default flush threshold and maximum flush latency.
+   */
+  template <typename Arg>
+  explicit coalescing_write_stream(Arg&& a)
+    : next_layer_(static_cast<Arg&&>(a)),
+      flush_threshold_(default_flush_threshold),
+      max_latency_(chrono::microseconds(
+            static_cast<long>(default_max_latency_us))),
+      timer_(next_layer_.get_executor()),
+      writing_buffer_(std::make_shared<std::vector<unsigned char>>()),
+      writing_(false),
+      timer_active_(false),
+      bytes_buffered_(0),
+      bytes_written_(0),
+      self_(std::make_shared<coalescing_write_stream*>(this))
+  {
+  }
+
+  /// Construct, passing the specified argument to initialise the next layer.
+  /**
+   * @param a The argument used to initialise the next layer.
+   *
+   * @param flush_threshold The number of buffered bytes at which the buffer
+   * is written to the next layer without waiting for the latency bound. This
+   * is also the maximum number of bytes that are buffered while a write to
+   * the next layer is in progress.
+   *
+   * @param max_latency The maximum time that a byte is buffered before it is
+   * written to the next layer, not counting any time spent waiting for an
+   * earlier write to complete.
+   */
+  template <typename Arg>
+  coalescing_write_stream(Arg&& a, std::size_t flush_threshold,
+      const duration& max_latency)
+    : next_layer_(static_cast<Arg&&>(a)),
+      flush_threshold_(flush_threshold > 0 ? flush_threshold : 1),
+      max_latency_(max_latency),
+      timer_(next_layer_.get_executor()),
+      writing_buffer_(std::make_shared<std::vector<unsigned char>>()),
+      writing_(false),
+      timer_active_(false),
+      bytes_buffered_(0),
+      bytes_written_(0),
+      self_(std::make_shared<coalescing_write_stream*>(this))
+  {
+  }
+
+  /// Destructor.
+  /**
+   * Any buffered data that has not been written is discarded. A write to the
+   * next layer that is in progress keeps the data it is writing alive until
+   * it completes, but its completion is not reported. To ensure that all
+   * buffered data is written, wait for async_flush() to complete.
+   */
+  ~coalescing_write_stream()
+  {
+    *self_ = 0;
+  }
+
+  /// Get a reference to the next layer.
+  next_layer_type& next_layer()
+  {
+    return next_layer_;
+  }
+
+  /// Get the executor associated with the object.
+  executor_type get_executor() noexcept
+  {
+    return next_layer_.get_executor();
+  }
+
+  /// Close the stream.
+  void close()
+  {
+    timer_.cancel();
+    next_layer_.close();
+  }
+
+  /// Close the stream.
+  ASIO_SYNC_OP_VOID close(asio::error_code& ec)
+  {
+    timer_.cancel();
+    next_layer_.close(ec);
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  /// Get the number of buffered bytes at which the buffer is written.
+  std::size_t flush_threshold() const
+  {
+    return flush_threshold_;
+  }
+
+  /// Get the maximum time that a byte is buffered before it is written.
+  duration max_latency() const
+  {
+    return max_latency_;
+  }
+
+  /// Get the number of bytes that have been buffered but not yet written to
+  /// the next layer.
+  std::size_t pending() const
+  {
+    return pending_.size() + writing_buffer_->size();
+  }
+
+  /// Start an asynchronous flush.
+  /**
+   * This function is used to write all data buffered at the time of the call
+   * to the next layer, without waiting for the flush threshold or latency
+   * bound to be reached.
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * The number of bytes passed to the completion handler is the number of
+   * bytes that were buffered when the flush was started.
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) WriteToken = default_completion_token_t<executor_type>>
+  auto async_flush(
+      WriteToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<WriteToken,
+        void (asio::error_code, std::size_t)>(
+          declval<detail::initiate_async_coalescing_flush<Stream>>(),
+          token));
+
+  /// Start an asynchronous write.
+  /**
+   * This function copies as much of the data as fits into the internal buffer
+   * and completes. The data is written to the next layer later, according to
+   * the flush threshold and latency bound. If an earlier write to the next
+   * layer failed, the operation completes with that error.
+   *
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   */
+  template <typename ConstBufferSequence,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) WriteToken = default_completion_token_t<executor_type>>
+  auto async_write_some(const ConstBufferSequence& buffers,
+      WriteToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<WriteToken,
+        void (asio::error_code, std::size_t)>(
+          declval<detail::initiate_async_coalescing_write_some<Stream>>(),
+          token, buffers));
+
+  /// Read some data from the stream. Returns the number of bytes read. Throws
+  /// an exception on failure.
+  template <typename MutableBufferSequence>
+  std::size_t read_some(const MutableBufferSequence& buffers)
+  {
+    return next_layer_.read_some(buffers);
+  }
+
+  /// Read some data from the stream. Returns the number of bytes read or 0 if
+  /// an error occurred.
+  template <typename MutableBufferSequence>
+  std::size_t read_some(const MutableBufferSequence& buffers,
+      asio::error_code& ec)
+  {
+    return next_layer_.read_some(buffers, ec);
+  }
+
+  /// Start an asynchronous read. The buffer into which the data will be read
+  /// must be valid for the lifetime of the asynchronous operation.
+  /**
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   */
+  template <typename MutableBufferSequence,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) ReadToken = default_completion_token_t<executor_type>>
+  auto async_read_some(const MutableBufferSequence& buffers,
+      ReadToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      declval<conditional_t<true, Stream&, ReadToken>>().async_read_some(
+        buffers, static_cast<ReadToken&&>(token)))
+  {
+    return next_layer_.async_read_some(buffers,
+        static_cast<ReadToken&&>(token));
+  }
+
+private:
+  template <typename> friend class detail::initiate_async_coalescing_flush;
+  template <typename>
+    friend class detail::initiate_async_coalescing_write_some;
+  template <typename> friend class detail::coalescing_flush_op;
+  template <typename, typename> friend class detail::coalescing_write_some_op;
+  template <typename> friend class detail::coalescing_timer_handler;
+  template <typename> friend class detail::coalescing_write_handler;
+
+  typedef any_completion_handler<
+    void (asio::error_code, std::size_t)> handler_type;
+
+  typedef basic_waitable_timer<clock_type,
+    wait_traits<clock_type>, executor_type> timer_type;
+
+  // A flush that is waiting for the bytes buffered before it to be written.
+  // The flush is complete once the total number of bytes written reaches the
+  // total number of bytes that had been buffered when it started.
+  struct flush_waiter
+  {
+    flush_waiter(std::size_t n, uint64_t t, handler_type&& h)
+      : size(n),
+        target(t),
+        handler(static_cast<handler_type&&>(h))
+    {
+    }
+
+    std::size_t size;
+    uint64_t target;
+    handler_type handler;
+  };
+
+  // Copy data into the buffer, or wait for space to become available.
+  template <typename ConstBufferSequence, typename Handler>
+  void write_some(const ConstBufferSequence& buffers, Handler& handler);
+
+  // Wait for the buffered data to be written.
+  template <typename Handler>
+  void flush(Handler& handler);
+
+  // Start writing the buffered data to the next layer, if no write is in
+  // progress.
+  void start_write();
+
+  // Arm the timer for the oldest buffered byte, if it is not already armed.
+  void start_timer();
+
+  // Flush the buffered data if the oldest byte has reached the latency bound.
+  void handle_timer(const asio::error_code& ec);
+
+  // Complete flushes, wake waiting writes and continue writing.
+  void handle_write(const asio::error_code& ec, std::size_t n);
+
+  // The next layer.
+  Stream next_layer_;
+
+  // The number of buffered bytes at which the buffer is written.
+  std::size_t flush_threshold_;
+
+  // The maximum time that a byte is buffered before it is written.
+  duration max_latency_;
+
+  // The timer used to enforce the latency bound.
+  timer_type timer_;
+
+  // The time by which the oldest byte in pending_ must be written.
+  clock_type::time_point deadline_;
+
+  // Data that has been buffered but not yet passed to the next layer.
+  std::vector<unsigned char> pending_;
+
+  // Data that is being written to the next layer. It is shared with the write
+  // handler, so that it outlives a write that is in progress when this object
+  // is destroyed.
+  std::shared_ptr<std::vector<unsigned char>> writing_buffer_;
+
+  // Whether a write to the next layer is in progress.
+  bool writing_;
+
+  // Whether the timer has been armed.
+  bool timer_active_;
+
+  // The total number of bytes that have been buffered.
+  uint64_t bytes_buffered_;
+
+  // The total number of bytes that have been written to the next layer.
+  uint64_t bytes_written_;
+
+  // The error from a failed write to the next layer.
+  asio::error_code error_;
+
+  // Writes that are waiting for space in the buffer.
+  std::deque<any_completion_handler<void (asio::error_code)>> write_waiters_;
+
+  // Flushes that are waiting for data to be written, in order.
+  std::deque<flush_waiter> flush_waiters_;
+
+  // A reference to this object that is cleared on destruction, so that the
+  // timer and write handlers do not use the object after it has gone.
+  std::shared_ptr<coalescing_write_stream*> self_;
+};
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#include "asio/impl/coalescing_write_stream.hpp"
+
+#endif // ASIO_COALESCING_WRITE_STREAM_HPP
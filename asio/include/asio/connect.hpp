@@ -18,6 +18,7 @@
 #include "asio/detail/config.hpp"
 #include "asio/async_result.hpp"
 #include "asio/basic_socket.hpp"
+#include "asio/buffer.hpp"
 #include "asio/detail/type_traits.hpp"
 #include "asio/error.hpp"
 
@@ -25,11 +26,25 @@
 
 namespace asio {
 
+#if defined(ASIO_HAS_TCP_FASTOPEN)
+#if !defined(ASIO_BASIC_STREAM_SOCKET_FWD_DECL)
+#define ASIO_BASIC_STREAM_SOCKET_FWD_DECL
+
+// Forward declaration with defaulted arguments.
+template <typename Protocol, typename Executor = any_io_executor>
+class basic_stream_socket;
+
+#endif // !defined(ASIO_BASIC_STREAM_SOCKET_FWD_DECL)
+#endif // defined(ASIO_HAS_TCP_FASTOPEN)
+
 namespace detail
 {
   struct default_connect_condition;
   template <typename, typename> class initiate_async_range_connect;
   template <typename, typename> class initiate_async_iterator_connect;
+#if defined(ASIO_HAS_TCP_FASTOPEN)
+  template <typename, typename> class initiate_async_range_connect_with_data;
+#endif // defined(ASIO_HAS_TCP_FASTOPEN)
 
   template <typename T, typename = void, typename = void>
   struct is_endpoint_sequence_helper : false_type
@@ -636,6 +651,9 @@ inline auto async_connect(basic_socket<Protocol, Executor>& s,
     constraint_t<
       !is_connect_condition<RangeConnectToken,
         decltype(declval<const EndpointSequence&>().begin())>::value
+    > = 0,
+    constraint_t<
+      !is_const_buffer_sequence<decay_t<RangeConnectToken>>::value
     > = 0)
   -> decltype(
     async_initiate<RangeConnectToken,
@@ -1009,6 +1027,97 @@ inline auto async_connect(basic_socket<Protocol, Executor>& s,
       token, begin, end, connect_condition);
 }
 
+#if defined(ASIO_HAS_TCP_FASTOPEN) || defined(GENERATING_DOCUMENTATION)
+
+/// Asynchronously establishes a stream socket connection by trying each
+/// endpoint in a sequence, sending initial data with the connection.
+/**
+ * This function attempts to connect a socket to one of a sequence of
+ * endpoints, sending the specified initial data as part of the connection. It
+ * does this by repeated calls to the socket's @c async_connect member function
+ * that accepts initial data, once for each endpoint in the sequence, until a
+ * connection is successfully established. Where supported, TCP Fast Open is
+ * used to carry the data in the connection's SYN segment. It is an initiating
+ * function for an @ref asynchronous_operation, and always returns immediately.
+ *
+ * @param s The socket to be connected. If the socket is already open, it will
+ * be closed.
+ *
+ * @param endpoints A sequence of endpoints.
+ *
+ * @param initial_data One or more data buffers to be sent to the peer once a
+ * connection attempt is made. Although the buffers object may be copied as
+ * necessary, ownership of the underlying memory blocks is retained by the
+ * caller, which must guarantee that they remain valid until the completion
+ * handler is called.
+ *
+ * @param token The @ref completion_token that will be used to produce a
+ * completion handler, which will be called when the connect completes.
+ * Potential completion tokens include @ref use_future, @ref use_awaitable,
+ * @ref yield_context, or a function object with the correct completion
+ * signature. The function signature of the completion handler must be:
+ * @code void handler(
+ *   // Result of operation. if the sequence is empty, set to
+ *   // asio::error::not_found. Otherwise, contains the
+ *   // error from the last connection attempt.
+ *   const asio::error_code& error,
+ *
+ *   // On success, the successfully connected endpoint.
+ *   // Otherwise, a default-constructed endpoint.
+ *   const typename Protocol::endpoint& endpoint,
+ *
+ *   // On success, the number of bytes of initial data sent.
+ *   std::size_t bytes_transferred
+ * ); @endcode
+ * Regardless of whether the asynchronous operation completes immediately or
+ * not, the completion handler will not be invoked from within this function.
+ * On immediate completion, invocation of the handler will be performed in a
+ * manner equivalent to using asio::async_immediate().
+ *
+ * @par Completion Signature
+ * @code void(asio::error_code, typename Protocol::endpoint,
+ *   std::size_t) @endcode
+ *
+ * @note The operation may not transmit all of the initial data to the peer.
+ *
+ * @par Per-Operation Cancellation
+ * This asynchronous operation supports cancellation for the following
+ * asio::cancellation_type values:
+ *
+ * @li @c cancellation_type::terminal
+ *
+ * @li @c cancellation_type::partial
+ *
+ * if they are also supported by the socket's @c async_connect operation.
+ */
+template <typename Protocol, typename Executor,
+    typename EndpointSequence, typename ConstBufferSequence,
+    ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+      typename Protocol::endpoint, std::size_t)) RangeConnectToken
+        = default_completion_token_t<Executor>>
+inline auto async_connect(basic_stream_socket<Protocol, Executor>& s,
+    const EndpointSequence& endpoints, const ConstBufferSequence& initial_data,
+    RangeConnectToken&& token = default_completion_token_t<Executor>(),
+    constraint_t<
+      is_endpoint_sequence<EndpointSequence>::value
+    > = 0,
+    constraint_t<
+      is_const_buffer_sequence<ConstBufferSequence>::value
+    > = 0)
+  -> decltype(
+    async_initiate<RangeConnectToken,
+      void (asio::error_code, typename Protocol::endpoint, std::size_t)>(
+        declval<detail::initiate_async_range_connect_with_data<
+          Protocol, Executor>>(), token, endpoints, initial_data))
+{
+  return async_initiate<RangeConnectToken,
+    void (asio::error_code, typename Protocol::endpoint, std::size_t)>(
+      detail::initiate_async_range_connect_with_data<Protocol, Executor>(s),
+      token, endpoints, initial_data);
+}
+
+#endif // defined(ASIO_HAS_TCP_FASTOPEN) || defined(GENERATING_DOCUMENTATION)
+
 /*@}*/
 
 } // namespace asio
@@ -0,0 +1,369 @@
+//
+// control_buffer.hpp
+// ~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_CONTROL_BUFFER_HPP
+#define ASIO_CONTROL_BUFFER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_ANCILLARY_DATA) \
+  || defined(GENERATING_DOCUMENTATION)
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include "asio/detail/cstdint.hpp"
+#include "asio/detail/socket_types.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+
+/// A view of a single control message held in a control_buffer.
+/**
+ * The asio::control_message class provides access to the level, type and
+ * payload of an ancillary data item, such as a receive timestamp or packet
+ * information, without copying it out of the underlying control buffer.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Safe.
+ */
+class control_message
+{
+public:
+  /// Construct a view of a native control message header.
+  explicit control_message(const void* header = 0) noexcept
+    : header_(static_cast<const cmsghdr*>(header))
+  {
+  }
+
+  /// Get the protocol level of the control message, e.g. @c SOL_SOCKET.
+  int level() const noexcept
+  {
+    return header_->cmsg_level;
+  }
+
+  /// Get the protocol-specific type of the control message.
+  int type() const noexcept
+  {
+    return header_->cmsg_type;
+  }
+
+  /// Get a pointer to the control message payload.
+  const void* data() const noexcept
+  {
+    return CMSG_DATA(const_cast<cmsghdr*>(header_));
+  }
+
+  /// Get the size of the control message payload, in bytes.
+  std::size_t size() const noexcept
+  {
+    return header_->cmsg_len - CMSG_LEN(0);
+  }
+
+  /// Determine whether the message has the specified level and type.
+  bool is(int level, int type) const noexcept
+  {
+    return header_->cmsg_level == level && header_->cmsg_type == type;
+  }
+
+  /// Copy the payload into an object of type @c T.
+  /**
+   * The payload is copied rather than accessed in place, as it is not
+   * guaranteed to be suitably aligned for @c T. If the payload is shorter than
+   * @c T, the remaining bytes are value-initialised.
+   */
+  template <typename T>
+  T value() const noexcept
+  {
+    T result = T();
+    std::size_t n = size();
+    std::memcpy(&result, data(), n < sizeof(T) ? n : sizeof(T));
+    return result;
+  }
+
+private:
+  const cmsghdr* header_;
+};
+
+/// Adapts caller-provided storage for use as an ancillary data buffer.
+/**
+ * The asio::control_buffer class wraps memory owned by the caller so that it
+ * may be used to receive or send control messages (ancillary data) with the
+ * @c async_receive_msg and @c async_send_msg socket member functions. No
+ * memory is allocated by the control buffer itself.
+ *
+ * For receive operations, the whole capacity of the storage is made available
+ * to the kernel and, on completion, the size is set to the length of the
+ * control data actually received. For send operations, control messages are
+ * appended using @c push_back and the first @c size() bytes are passed to the
+ * kernel.
+ *
+ * @par Example
+ * Receiving a datagram together with its destination address:
+ * @code union
+ * {
+ *   cmsghdr align;
+ *   char buf[CMSG_SPACE(sizeof(in_pktinfo))];
+ * } storage;
+ * asio::control_buffer control(&storage, sizeof(storage));
+ * ...
+ * socket.async_receive_msg(asio::buffer(data), sender, control,
+ *     0, out_flags,
+ *     [&](asio::error_code ec, std::size_t n)
+ *     {
+ *       for (asio::control_message m : control)
+ *         if (m.is(IPPROTO_IP, IP_PKTINFO))
+ *           handle_pktinfo(m.value<in_pktinfo>());
+ *     }); @endcode
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe.
+ */
+class control_buffer
+{
+public:
+  class const_iterator;
+
+  /// Construct an empty control buffer with no storage.
+  control_buffer() noexcept
+    : data_(0),
+      size_(0),
+      capacity_(0)
+  {
+  }
+
+  /// Construct a control buffer that uses the specified storage.
+  /**
+   * The start of the storage is rounded up to the alignment required for a
+   * control message header, and the capacity reduced accordingly.
+   */
+  control_buffer(void* data, std::size_t capacity) noexcept
+    : data_(static_cast<char*>(data)),
+      size_(0),
+      capacity_(capacity)
+  {
+    std::size_t misalignment = reinterpret_cast<uintptr_t>(data_)
+      % alignof(cmsghdr);
+    std::size_t adjustment = misalignment
+      ? alignof(cmsghdr) - misalignment : 0;
+    if (adjustment > capacity_)
+      adjustment = capacity_;
+    data_ += adjustment;
+    capacity_ -= adjustment;
+  }
+
+  /// Get a pointer to the start of the control data.
+  void* data() noexcept
+  {
+    return data_;
+  }
+
+  /// Get a pointer to the start of the control data.
+  const void* data() const noexcept
+  {
+    return data_;
+  }
+
+  /// Get the number of bytes of control data held in the buffer.
+  std::size_t size() const noexcept
+  {
+    return size_;
+  }
+
+  /// Get the total number of bytes available for control data.
+  std::size_t capacity() const noexcept
+  {
+    return capacity_;
+  }
+
+  /// Set the number of bytes of control data held in the buffer.
+  /**
+   * The size is limited to the capacity of the buffer.
+   */
+  void resize(std::size_t n) noexcept
+  {
+    size_ = n < capacity_ ? n : capacity_;
+  }
+
+  /// Remove all control messages from the buffer.
+  void clear() noexcept
+  {
+    size_ = 0;
+  }
+
+  /// Append a control message to the buffer.
+  /**
+   * @returns @c true if the message was added, or @c false if there was
+   * insufficient space remaining in the buffer.
+   */
+  bool push_back(int level, int type,
+      const void* data, std::size_t size) noexcept
+  {
+    std::size_t space = CMSG_SPACE(size);
+    if (space > capacity_ - size_)
+      return false;
+
+    cmsghdr* header = static_cast<cmsghdr*>(
+        static_cast<void*>(data_ + size_));
+    std::memset(header, 0, space);
+    header->cmsg_level = level;
+    header->cmsg_type = type;
+    header->cmsg_len = CMSG_LEN(size);
+    if (size > 0)
+      std::memcpy(CMSG_DATA(header), data, size);
+    size_ += space;
+    return true;
+  }
+
+  /// Append a control message holding a copy of the specified value.
+  /**
+   * @returns @c true if the message was added, or @c false if there was
+   * insufficient space remaining in the buffer.
+   */
+  template <typename T>
+  bool push_back(int level, int type, const T& value) noexcept
+  {
+    return push_back(level, type, &value, sizeof(T));
+  }
+
+  /// Get an iterator to the first control message in the buffer.
+  const_iterator begin() const noexcept;
+
+  /// Get an iterator to one past the last control message in the buffer.
+  const_iterator end() const noexcept;
+
+  /// Get the number of bytes needed to hold a control message.
+  /**
+   * @param size The size of the control message payload, in bytes.
+   */
+  static std::size_t space(std::size_t size) noexcept
+  {
+    return CMSG_SPACE(size);
+  }
+
+private:
+  char* data_;
+  std::size_t size_;
+  std::size_t capacity_;
+};
+
+/// A forward iterator over the control messages held in a control_buffer.
+class control_buffer::const_iterator
+{
+public:
+  /// The type of the value pointed to by the iterator.
+  typedef control_message value_type;
+
+  /// The type of the result of applying operator->() to the iterator.
+  typedef const control_message* pointer;
+
+  /// The type of the result of applying operator*() to the iterator.
+  typedef const control_message& reference;
+
+  /// Distance between two iterators.
+  typedef std::ptrdiff_t difference_type;
+
+  /// The iterator category.
+  typedef std::forward_iterator_tag iterator_category;
+
+  /// Default constructor creates an end iterator.
+  const_iterator() noexcept
+    : msg_(),
+      header_(0),
+      current_()
+  {
+  }
+
+  /// Dereference an iterator.
+  reference operator*() const noexcept
+  {
+    return current_;
+  }
+
+  /// Dereference an iterator.
+  pointer operator->() const noexcept
+  {
+    return &current_;
+  }
+
+  /// Increment operator (prefix).
+  const_iterator& operator++() noexcept
+  {
+    header_ = CMSG_NXTHDR(&msg_, header_);
+    current_ = control_message(header_);
+    return *this;
+  }
+
+  /// Increment operator (postfix).
+  const_iterator operator++(int) noexcept
+  {
+    const_iterator tmp(*this);
+    ++*this;
+    return tmp;
+  }
+
+  /// Test two iterators for equality.
+  friend bool operator==(const const_iterator& a,
+      const const_iterator& b) noexcept
+  {
+    return a.header_ == b.header_;
+  }
+
+  /// Test two iterators for inequality.
+  friend bool operator!=(const const_iterator& a,
+      const const_iterator& b) noexcept
+  {
+    return a.header_ != b.header_;
+  }
+
+private:
+  friend class control_buffer;
+
+  explicit const_iterator(const control_buffer& b) noexcept
+    : msg_(),
+      header_(0),
+      current_()
+  {
+    msg_.msg_control = const_cast<void*>(b.data());
+    msg_.msg_controllen = b.size();
+    header_ = b.size() >= sizeof(cmsghdr) ? CMSG_FIRSTHDR(&msg_) : 0;
+    current_ = control_message(header_);
+  }
+
+  msghdr msg_;
+  cmsghdr* header_;
+  control_message current_;
+};
+
+inline control_buffer::const_iterator control_buffer::begin() const noexcept
+{
+  return const_iterator(*this);
+}
+
+inline control_buffer::const_iterator control_buffer::end() const noexcept
+{
+  return const_iterator();
+}
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_ANCILLARY_DATA)
+       //   || defined(GENERATING_DOCUMENTATION)
+
+#endif // ASIO_CONTROL_BUFFER_HPP
@@ -0,0 +1,184 @@
+//
+// datagram_message.hpp
+// ~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DATAGRAM_MESSAGE_HPP
+#define ASIO_DATAGRAM_MESSAGE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+#include "asio/socket_base.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+
+/// Describes a single datagram in a batched send or receive operation.
+/**
+ * The asio::datagram_message class template associates a buffer with the
+ * endpoint to which a datagram is sent, or from which it was received. On
+ * completion of a batched operation, each message transferred is updated with
+ * the number of bytes actually sent or received and, for receive operations,
+ * the flags reported for the datagram.
+ *
+ * Where UDP segmentation offload is supported, a message may also carry a
+ * segment size. On send, a non-zero segment size asks the kernel to split the
+ * buffer into datagrams of that size. On receive, it reports the size of the
+ * datagrams that were coalesced into the buffer by generic receive offload.
+ *
+ * Datagram sockets provide the typedefs @c receive_message_type and
+ * @c send_message_type for use with the @c async_receive_batch and
+ * @c async_send_batch member functions.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe.
+ */
+template <typename Endpoint, typename Buffer>
+class datagram_message
+{
+public:
+  /// The endpoint type associated with the message.
+  typedef Endpoint endpoint_type;
+
+  /// The buffer type associated with the message.
+  typedef Buffer buffer_type;
+
+  /// Default constructor.
+  datagram_message()
+    : buffer_(),
+      endpoint_(),
+      length_(0),
+      flags_(0),
+      segment_size_(0)
+  {
+  }
+
+  /// Construct with a specified buffer.
+  explicit datagram_message(const buffer_type& buffer)
+    : buffer_(buffer),
+      endpoint_(),
+      length_(0),
+      flags_(0),
+      segment_size_(0)
+  {
+  }
+
+  /// Construct with a specified buffer and endpoint.
+  datagram_message(const buffer_type& buffer, const endpoint_type& endpoint)
+    : buffer_(buffer),
+      endpoint_(endpoint),
+      length_(0),
+      flags_(0),
+      segment_size_(0)
+  {
+  }
+
+  /// Get the buffer associated with the message.
+  const buffer_type& buffer() const noexcept
+  {
+    return buffer_;
+  }
+
+  /// Set the buffer associated with the message.
+  void buffer(const buffer_type& b) noexcept
+  {
+    buffer_ = b;
+  }
+
+  /// Get the endpoint associated with the message.
+  /**
+   * For a send operation, this is the destination of the datagram. If the
+   * endpoint is default-constructed, the datagram is sent to the peer to which
+   * the socket is connected. For a receive operation, this is populated with
+   * the sender of the datagram.
+   */
+  endpoint_type& endpoint() noexcept
+  {
+    return endpoint_;
+  }
+
+  /// Get the endpoint associated with the message.
+  const endpoint_type& endpoint() const noexcept
+  {
+    return endpoint_;
+  }
+
+  /// Set the endpoint associated with the message.
+  void endpoint(const endpoint_type& e)
+  {
+    endpoint_ = e;
+  }
+
+  /// Get the number of bytes transferred for the message.
+  std::size_t length() const noexcept
+  {
+    return length_;
+  }
+
+  /// Set the number of bytes transferred for the message.
+  void length(std::size_t n) noexcept
+  {
+    length_ = n;
+  }
+
+  /// Get the flags reported for a received message.
+  /**
+   * For example, the value includes @c MSG_TRUNC if the datagram was larger
+   * than the supplied buffer and has been truncated. It includes
+   * @c MSG_CTRUNC if the datagram's ancillary data was truncated, in which
+   * case the segment size may not have been reported.
+   */
+  socket_base::message_flags flags() const noexcept
+  {
+    return flags_;
+  }
+
+  /// Set the flags reported for a received message.
+  void flags(socket_base::message_flags f) noexcept
+  {
+    flags_ = f;
+  }
+
+  /// Get the segment size associated with the message.
+  /**
+   * For a received message, a non-zero value indicates that the buffer holds
+   * a train of coalesced datagrams of this size, where only the last datagram
+   * may be shorter. For a message to be sent, a non-zero value requests that
+   * the buffer be split into datagrams of this size. A send operation fails
+   * with asio::error::invalid_argument if the value exceeds 65535.
+   */
+  std::size_t segment_size() const noexcept
+  {
+    return segment_size_;
+  }
+
+  /// Set the segment size associated with the message.
+  void segment_size(std::size_t n) noexcept
+  {
+    segment_size_ = n;
+  }
+
+private:
+  buffer_type buffer_;
+  endpoint_type endpoint_;
+  std::size_t length_;
+  socket_base::message_flags flags_;
+  std::size_t segment_size_;
+};
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_DATAGRAM_MESSAGE_HPP
@@ -0,0 +1,90 @@
+//
+// detail/allocation_accounting_service.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_ALLOCATION_ACCOUNTING_SERVICE_HPP
+#define ASIO_DETAIL_ALLOCATION_ACCOUNTING_SERVICE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include "asio/detail/allocation_counters.hpp"
+#include "asio/detail/type_traits.hpp"
+#include "asio/execution/context.hpp"
+#include "asio/execution/executor.hpp"
+#include "asio/execution_context.hpp"
+#include "asio/query.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+// Owns a reference to the allocation counters for an execution context.
+// Services that allocate memory on behalf of the context obtain the counters
+// when they are constructed, so that this service outlives them and they need
+// not hold references of their own.
+class allocation_accounting_service
+  : public execution_context_service_base<allocation_accounting_service>
+{
+public:
+  explicit allocation_accounting_service(execution_context& ctx)
+    : execution_context_service_base<allocation_accounting_service>(ctx),
+      counters_(new allocation_counters)
+  {
+  }
+
+  ~allocation_accounting_service()
+  {
+    counters_->release();
+  }
+
+  void shutdown()
+  {
+  }
+
+  allocation_counters& counters()
+  {
+    return *counters_;
+  }
+
+private:
+  allocation_counters* counters_;
+};
+
+// Get the allocation counters for an execution context.
+inline allocation_counters& get_allocation_counters(execution_context& ctx)
+{
+  return use_service<allocation_accounting_service>(ctx).counters();
+}
+
+// Get the allocation counters for an executor's context.
+template <typename Executor>
+inline allocation_counters& get_allocation_counters(const Executor& ex,
+    enable_if_t<execution::is_executor<Executor>::value>* = 0)
+{
+  return get_allocation_counters(asio::query(ex, execution::context));
+}
+
+// Get the allocation counters for an executor's context.
+template <typename Executor>
+inline allocation_counters& get_allocation_counters(const Executor& ex,
+    enable_if_t<!execution::is_executor<Executor>::value>* = 0)
+{
+  return get_allocation_counters(ex.context());
+}
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_DETAIL_ALLOCATION_ACCOUNTING_SERVICE_HPP
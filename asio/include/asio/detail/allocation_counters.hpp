@@ -0,0 +1,236 @@
+//
+// detail/allocation_counters.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_ALLOCATION_COUNTERS_HPP
+#define ASIO_DETAIL_ALLOCATION_COUNTERS_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <atomic>
+#include <cstddef>
+#include "asio/detail/noncopyable.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+// Counters for the memory allocated on behalf of an execution context, used
+// when ASIO_ENABLE_ALLOCATION_ACCOUNTING is defined. The counters may be
+// updated concurrently by any thread. They are reference counted, so that a
+// block allocated on behalf of one context can be freed after the context has
+// been destroyed.
+class allocation_counters
+  : private noncopyable
+{
+public:
+  // The categories of internal allocation.
+  enum category
+  {
+    handler,
+    awaitable_frame,
+    executor_function,
+    cancellation_signal,
+    parallel_group,
+    timed_cancel,
+    reactor,
+    timer,
+    strand,
+    ssl,
+    category_count
+  };
+
+  // A snapshot of the counters for a single category.
+  struct values
+  {
+    std::size_t bytes_live;
+    std::size_t bytes_peak;
+    std::size_t allocations;
+    std::size_t deallocations;
+  };
+
+  allocation_counters() noexcept
+    : ref_count_(1)
+  {
+    for (int i = 0; i <= category_count; ++i)
+    {
+      counters_[i].bytes_live_ = 0;
+      counters_[i].bytes_peak_ = 0;
+      counters_[i].allocations_ = 0;
+      counters_[i].deallocations_ = 0;
+    }
+  }
+
+  // Add a reference to the counters.
+  void add_ref() noexcept
+  {
+    ref_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // Release a reference to the counters, destroying them if it was the last.
+  void release() noexcept
+  {
+    if (ref_count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      delete this;
+  }
+
+  // Record an allocation in the specified category.
+  void record_allocation(int c, std::size_t bytes) noexcept
+  {
+    add(counters_[c], bytes);
+    add(counters_[category_count], bytes);
+  }
+
+  // Record a deallocation in the specified category.
+  void record_deallocation(int c, std::size_t bytes) noexcept
+  {
+    subtract(counters_[c], bytes);
+    subtract(counters_[category_count], bytes);
+  }
+
+  // Get the counters for a category, or for all categories combined if c is
+  // category_count.
+  values get(int c) const noexcept
+  {
+    values v;
+    v.bytes_live = counters_[c].bytes_live_.load(std::memory_order_relaxed);
+    v.bytes_peak = counters_[c].bytes_peak_.load(std::memory_order_relaxed);
+    v.allocations = counters_[c].allocations_.load(std::memory_order_relaxed);
+    v.deallocations =
+      counters_[c].deallocations_.load(std::memory_order_relaxed);
+    return v;
+  }
+
+private:
+  ~allocation_counters()
+  {
+  }
+
+  struct counters
+  {
+    std::atomic<std::size_t> bytes_live_;
+    std::atomic<std::size_t> bytes_peak_;
+    std::atomic<std::size_t> allocations_;
+    std::atomic<std::size_t> deallocations_;
+  };
+
+  static void add(counters& c, std::size_t bytes) noexcept
+  {
+    c.allocations_.fetch_add(1, std::memory_order_relaxed);
+    std::size_t live = c.bytes_live_.fetch_add(
+        bytes, std::memory_order_relaxed) + bytes;
+    std::size_t peak = c.bytes_peak_.load(std::memory_order_relaxed);
+    while (live > peak && !c.bytes_peak_.compare_exchange_weak(
+          peak, live, std::memory_order_relaxed))
+    {
+    }
+  }
+
+  static void subtract(counters& c, std::size_t bytes) noexcept
+  {
+    c.deallocations_.fetch_add(1, std::memory_order_relaxed);
+    c.bytes_live_.fetch_sub(bytes, std::memory_order_relaxed);
+  }
+
+  // One set of counters per category, followed by the combined totals.
+  counters counters_[category_count + 1];
+
+  // The number of references to the counters.
+  std::atomic<long> ref_count_;
+};
+
+// Records a single long-lived allocation, such as a buffer owned by an I/O
+// object, for as long as the tracker exists. The tracker holds a reference to
+// the counters.
+class allocation_tracker
+{
+public:
+  allocation_tracker() noexcept
+    : counters_(0),
+      category_(0),
+      bytes_(0)
+  {
+  }
+
+  allocation_tracker(allocation_counters* counters,
+      int c, std::size_t bytes) noexcept
+    : counters_(counters),
+      category_(c),
+      bytes_(bytes)
+  {
+    if (counters_)
+    {
+      counters_->add_ref();
+      counters_->record_allocation(category_, bytes_);
+    }
+  }
+
+  allocation_tracker(allocation_tracker&& other) noexcept
+    : counters_(other.counters_),
+      category_(other.category_),
+      bytes_(other.bytes_)
+  {
+    other.counters_ = 0;
+  }
+
+  allocation_tracker& operator=(allocation_tracker&& other) noexcept
+  {
+    if (this != &other)
+    {
+      release();
+      counters_ = other.counters_;
+      category_ = other.category_;
+      bytes_ = other.bytes_;
+      other.counters_ = 0;
+    }
+    return *this;
+  }
+
+  ~allocation_tracker()
+  {
+    release();
+  }
+
+  // Record that the tracked allocation has changed size.
+  void resize(std::size_t bytes) noexcept
+  {
+    if (counters_ && bytes != bytes_)
+    {
+      counters_->record_deallocation(category_, bytes_);
+      counters_->record_allocation(category_, bytes);
+    }
+    bytes_ = bytes;
+  }
+
+private:
+  void release() noexcept
+  {
+    if (counters_)
+    {
+      counters_->record_deallocation(category_, bytes_);
+      counters_->release();
+    }
+    counters_ = 0;
+  }
+
+  allocation_counters* counters_;
+  int category_;
+  std::size_t bytes_;
+};
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_DETAIL_ALLOCATION_COUNTERS_HPP
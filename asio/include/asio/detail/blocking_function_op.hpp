@@ -0,0 +1,160 @@
+//
+// detail/blocking_function_op.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_BLOCKING_FUNCTION_OP_HPP
+#define ASIO_DETAIL_BLOCKING_FUNCTION_OP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/blocking_op.hpp"
+#include "asio/detail/fenced_block.hpp"
+#include "asio/detail/handler_alloc_helpers.hpp"
+#include "asio/detail/handler_work.hpp"
+#include "asio/detail/memory.hpp"
+#include "asio/detail/type_traits.hpp"
+
+#if defined(ASIO_HAS_IOCP)
+# include "asio/detail/win_iocp_io_context.hpp"
+#else // defined(ASIO_HAS_IOCP)
+# include "asio/detail/scheduler.hpp"
+#endif // defined(ASIO_HAS_IOCP)
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+// Runs a function object of the form:
+//
+//   uint64_t f(asio::error_code& ec);
+//
+// on a worker thread, and then delivers the result to the completion handler.
+// If HasResult is true, the handler's signature is void(error_code, uint64_t),
+// otherwise it is void(error_code).
+template <typename Function, bool HasResult,
+    typename Handler, typename IoExecutor>
+class blocking_function_op : public blocking_op
+{
+public:
+  ASIO_DEFINE_HANDLER_PTR(blocking_function_op);
+
+#if defined(ASIO_HAS_IOCP)
+  typedef class win_iocp_io_context scheduler_impl;
+#else
+  typedef class scheduler scheduler_impl;
+#endif
+
+  template <typename F>
+  blocking_function_op(F&& f, scheduler_impl& sched,
+      Handler& handler, const IoExecutor& io_ex)
+    : blocking_op(&blocking_function_op::do_complete),
+      function_(static_cast<F&&>(f)),
+      scheduler_(sched),
+      handler_(static_cast<Handler&&>(handler)),
+      work_(handler_, io_ex)
+  {
+  }
+
+  static void do_complete(void* owner, operation* base,
+      const asio::error_code& /*ec*/,
+      std::size_t /*bytes_transferred*/)
+  {
+    // Take ownership of the operation object.
+    ASIO_ASSUME(base != 0);
+    blocking_function_op* o(static_cast<blocking_function_op*>(base));
+    ptr p = { asio::detail::addressof(o->handler_), o, o };
+
+    if (owner && owner != &o->scheduler_)
+    {
+      // The operation is being run on a worker thread. Time to perform the
+      // blocking operation.
+      o->result_ = o->function_(o->ec_);
+
+      // Pass operation back to main io_context for completion.
+      o->scheduler_.post_deferred_completion(o);
+      p.v = p.p = 0;
+    }
+    else
+    {
+      // The operation has been returned to the main io_context. The completion
+      // handler is ready to be delivered.
+
+      ASIO_HANDLER_COMPLETION((*o));
+
+      // Take ownership of the operation's outstanding work.
+      handler_work<Handler, IoExecutor> w(
+          static_cast<handler_work<Handler, IoExecutor>&&>(
+            o->work_));
+
+      do_upcall(owner, o, p, w, integral_constant<bool, HasResult>());
+    }
+  }
+
+private:
+  static void do_upcall(void* owner, blocking_function_op* o, ptr& p,
+      handler_work<Handler, IoExecutor>& w, false_type)
+  {
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the upcall is made. Even if we're not about to make an upcall, a
+    // sub-object of the handler may be the true owner of the memory associated
+    // with the handler. Consequently, a local copy of the handler is required
+    // to ensure that any owning sub-object remains valid until after we have
+    // deallocated the memory here.
+    detail::binder1<Handler, asio::error_code>
+      handler(o->handler_, o->ec_);
+    p.h = asio::detail::addressof(handler.handler_);
+    p.reset();
+
+    // Make the upcall if required.
+    if (owner)
+    {
+      fenced_block b(fenced_block::half);
+      ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_));
+      w.complete(handler, handler.handler_);
+      ASIO_HANDLER_INVOCATION_END;
+    }
+  }
+
+  static void do_upcall(void* owner, blocking_function_op* o, ptr& p,
+      handler_work<Handler, IoExecutor>& w, true_type)
+  {
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the upcall is made.
+    detail::binder2<Handler, asio::error_code, uint64_t>
+      handler(o->handler_, o->ec_, o->result_);
+    p.h = asio::detail::addressof(handler.handler_);
+    p.reset();
+
+    // Make the upcall if required.
+    if (owner)
+    {
+      fenced_block b(fenced_block::half);
+      ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_, handler.arg2_));
+      w.complete(handler, handler.handler_);
+      ASIO_HANDLER_INVOCATION_END;
+    }
+  }
+
+  Function function_;
+  scheduler_impl& scheduler_;
+  Handler handler_;
+  handler_work<Handler, IoExecutor> work_;
+};
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_DETAIL_BLOCKING_FUNCTION_OP_HPP
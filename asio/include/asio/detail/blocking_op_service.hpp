@@ -0,0 +1,124 @@
+//
+// detail/blocking_op_service.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_BLOCKING_OP_SERVICE_HPP
+#define ASIO_DETAIL_BLOCKING_OP_SERVICE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+#include "asio/detail/blocking_function_op.hpp"
+#include "asio/detail/blocking_op.hpp"
+#include "asio/detail/memory.hpp"
+#include "asio/detail/mutex.hpp"
+#include "asio/detail/scoped_ptr.hpp"
+#include "asio/detail/thread_group.hpp"
+#include "asio/execution_context.hpp"
+
+#if defined(ASIO_HAS_IOCP)
+# include "asio/detail/win_iocp_io_context.hpp"
+#else // defined(ASIO_HAS_IOCP)
+# include "asio/detail/scheduler.hpp"
+#endif // defined(ASIO_HAS_IOCP)
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+// Runs blocking system calls on a private pool of worker threads, for those
+// operations that the platform cannot perform asynchronously.
+class blocking_op_service :
+  public execution_context_service_base<blocking_op_service>
+{
+public:
+  // Constructor.
+  ASIO_DECL blocking_op_service(execution_context& context);
+
+  // Destructor.
+  ASIO_DECL ~blocking_op_service();
+
+  // Destroy all user-defined handler objects owned by the service.
+  ASIO_DECL void shutdown();
+
+  // Perform any fork-related housekeeping.
+  ASIO_DECL void notify_fork(execution_context::fork_event fork_ev);
+
+  // Start an asynchronous call to a function object of the form:
+  //
+  //   uint64_t f(asio::error_code& ec);
+  //
+  // The result is passed to the handler only if HasResult is true.
+  template <bool HasResult, typename Function,
+      typename Handler, typename IoExecutor>
+  void async_call(Function&& f, Handler& handler, const IoExecutor& io_ex)
+  {
+    // Allocate and construct an operation to wrap the handler.
+    typedef blocking_function_op<decay_t<Function>,
+      HasResult, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(static_cast<Function&&>(f),
+        scheduler_, handler, io_ex);
+
+    ASIO_HANDLER_CREATION((scheduler_.context(),
+          *p.p, "blocking_op", this, 0, "async_call"));
+
+    start_op(p.p);
+    p.v = p.p = 0;
+  }
+
+private:
+  // Helper function to start an asynchronous blocking operation.
+  ASIO_DECL void start_op(blocking_op* op);
+
+  // Helper class to run the work scheduler in a thread.
+  class work_scheduler_runner;
+
+  // Start the worker threads if they're not already running.
+  ASIO_DECL void start_work_threads();
+
+  // The scheduler implementation used to post completions.
+#if defined(ASIO_HAS_IOCP)
+  typedef class win_iocp_io_context scheduler_impl;
+#else
+  typedef class scheduler scheduler_impl;
+#endif
+  scheduler_impl& scheduler_;
+
+  // Mutex to protect access to internal data.
+  asio::detail::mutex mutex_;
+
+  // Private scheduler used for performing the blocking operations.
+  asio::detail::scoped_ptr<scheduler_impl> work_scheduler_;
+
+  // Threads used for running the work scheduler's run loop.
+  asio::detail::thread_group work_threads_;
+
+  // The number of worker threads to create.
+  const std::size_t thread_count_;
+
+  // Whether the scheduler locking is enabled.
+  const bool scheduler_locking_;
+};
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#if defined(ASIO_HEADER_ONLY)
+# include "asio/detail/impl/blocking_op_service.ipp"
+#endif // defined(ASIO_HEADER_ONLY)
+
+#endif // ASIO_DETAIL_BLOCKING_OP_SERVICE_HPP
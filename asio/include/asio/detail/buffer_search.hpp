@@ -0,0 +1,142 @@
+//
+// detail/buffer_search.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_BUFFER_SEARCH_HPP
+#define ASIO_DETAIL_BUFFER_SEARCH_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include "asio/buffer.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+// Finds the first occurrence of a character in a buffer sequence, starting
+// from the specified offset. Each buffer is searched with memchr(), which the
+// C library implements using the widest vector instructions available.
+// Returns (offset,true) if the character was found, or (size,false) if not,
+// where size is the total size of the buffer sequence.
+template <typename ConstBufferSequence>
+std::pair<std::size_t, bool> buffer_find(
+    const ConstBufferSequence& buffers, std::size_t start, char c)
+{
+  std::size_t offset = 0;
+  for (auto iter = asio::buffer_sequence_begin(buffers),
+      end = asio::buffer_sequence_end(buffers); iter != end; ++iter)
+  {
+    const_buffer buffer(*iter);
+    const char* data = static_cast<const char*>(buffer.data());
+    std::size_t size = buffer.size();
+    if (size > 0 && offset + size > start)
+    {
+      std::size_t pos = start > offset ? start - offset : 0;
+      if (const void* p = std::memchr(data + pos, c, size - pos))
+        return std::make_pair(
+            offset + (static_cast<const char*>(p) - data), true);
+    }
+    offset += size;
+  }
+  return std::make_pair(offset, false);
+}
+
+// Finds the first occurrence of a character string in a buffer sequence,
+// starting from the specified offset. Candidate positions are located using
+// memchr() on the first character of the string, and then verified using
+// memcmp(), continuing into the following buffers when a candidate is close to
+// the end of a buffer. Returns (offset,true) if a full match was found.
+// Returns (offset,false) if a partial match was found at the end of the
+// buffer sequence, in which case the offset is the beginning of the partial
+// match. Returns (size,false) if no full or partial match was found.
+template <typename ConstBufferSequence>
+std::pair<std::size_t, bool> buffer_partial_search(
+    const ConstBufferSequence& buffers, std::size_t start,
+    const char* s, std::size_t length)
+{
+  typedef decltype(asio::buffer_sequence_begin(buffers)) iterator;
+
+  iterator end = asio::buffer_sequence_end(buffers);
+  std::size_t offset = 0;
+  for (iterator iter = asio::buffer_sequence_begin(buffers);
+      iter != end; ++iter)
+  {
+    const_buffer buffer(*iter);
+    const char* data = static_cast<const char*>(buffer.data());
+    std::size_t size = buffer.size();
+    if (size == 0 || offset + size <= start)
+    {
+      offset += size;
+      continue;
+    }
+
+    std::size_t pos = start > offset ? start - offset : 0;
+    if (length == 0)
+      return std::make_pair(offset + pos, true);
+
+    while (pos < size)
+    {
+      const void* p = std::memchr(data + pos, s[0], size - pos);
+      if (!p)
+        break;
+      pos = static_cast<const char*>(p) - data;
+
+      std::size_t available = size - pos;
+      if (available >= length)
+      {
+        if (std::memcmp(data + pos, s, length) == 0)
+          return std::make_pair(offset + pos, true);
+      }
+      else if (std::memcmp(data + pos, s, available) == 0)
+      {
+        // The candidate spans the end of the buffer, so the remainder of the
+        // string is compared against the following buffers.
+        std::size_t matched = available;
+        bool mismatch = false;
+        iterator next = iter;
+        for (++next; next != end && matched < length; ++next)
+        {
+          const_buffer next_buffer(*next);
+          std::size_t n = next_buffer.size() < length - matched
+            ? next_buffer.size() : length - matched;
+          if (n == 0)
+            continue;
+          if (std::memcmp(next_buffer.data(), s + matched, n) != 0)
+          {
+            mismatch = true;
+            break;
+          }
+          matched += n;
+        }
+
+        if (!mismatch)
+          return std::make_pair(offset + pos, matched == length);
+      }
+
+      ++pos;
+    }
+
+    offset += size;
+  }
+  return std::make_pair(offset, false);
+}
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_DETAIL_BUFFER_SEARCH_HPP
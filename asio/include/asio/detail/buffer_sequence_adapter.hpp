@@ -33,6 +33,10 @@ public:
   // The maximum number of buffers to support in a single operation.
   enum { max_buffers = 1 };
 
+  // The maximum number of buffers in a single operation on a prepared
+  // subsequence of a longer buffer sequence.
+  enum { max_vectored_buffers = 1 };
+
 protected:
   typedef Windows::Storage::Streams::IBuffer^ native_buffer_type;
 
@@ -48,6 +52,10 @@ public:
   // The maximum number of buffers to support in a single operation.
   enum { max_buffers = 64 < max_iov_len ? 64 : max_iov_len };
 
+  // The maximum number of buffers in a single operation on a prepared
+  // subsequence of a longer buffer sequence.
+  enum { max_vectored_buffers = max_iov_len };
+
 protected:
   typedef WSABUF native_buffer_type;
 
@@ -69,6 +77,10 @@ public:
   // The maximum number of buffers to support in a single operation.
   enum { max_buffers = 64 < max_iov_len ? 64 : max_iov_len };
 
+  // The maximum number of buffers in a single operation on a prepared
+  // subsequence of a longer buffer sequence.
+  enum { max_vectored_buffers = max_iov_len };
+
 protected:
   typedef iovec native_buffer_type;
 
@@ -980,6 +980,15 @@
 # endif // !defined(ASIO_DISABLE_FILE)
 #endif // !defined(ASIO_HAS_FILE)
 
+// Zero-copy transfer of file contents to stream sockets.
+#if !defined(ASIO_HAS_SENDFILE)
+# if !defined(ASIO_DISABLE_SENDFILE)
+#  if defined(ASIO_HAS_FILE) && defined(__linux__)
+#   define ASIO_HAS_SENDFILE 1
+#  endif // defined(ASIO_HAS_FILE) && defined(__linux__)
+# endif // !defined(ASIO_DISABLE_SENDFILE)
+#endif // !defined(ASIO_HAS_SENDFILE)
+
 // Pipes.
 #if !defined(ASIO_HAS_PIPE)
 # if defined(ASIO_HAS_IOCP) \
@@ -997,6 +1006,111 @@
         //   && !defined(__CYGWIN__)
 #endif // !defined(ASIO_HAS_PIPE)
 
+// Zero-copy transfer of data between stream sockets through a pipe.
+#if !defined(ASIO_HAS_SPLICE)
+# if !defined(ASIO_DISABLE_SPLICE)
+#  if defined(ASIO_HAS_PIPE) && defined(__linux__)
+#   define ASIO_HAS_SPLICE 1
+#  endif // defined(ASIO_HAS_PIPE) && defined(__linux__)
+# endif // !defined(ASIO_DISABLE_SPLICE)
+#endif // !defined(ASIO_HAS_SPLICE)
+
+// Batched datagram operations using recvmmsg() and sendmmsg().
+#if !defined(ASIO_HAS_MMSG)
+# if !defined(ASIO_DISABLE_MMSG)
+#  if defined(__linux__)
+#   define ASIO_HAS_MMSG 1
+#  endif // defined(__linux__)
+# endif // !defined(ASIO_DISABLE_MMSG)
+#endif // !defined(ASIO_HAS_MMSG)
+
+// UDP generic segmentation offload (UDP_SEGMENT) and generic receive offload
+// (UDP_GRO).
+#if !defined(ASIO_HAS_UDP_GSO)
+# if !defined(ASIO_DISABLE_UDP_GSO)
+#  if defined(__linux__)
+#   define ASIO_HAS_UDP_GSO 1
+#  endif // defined(__linux__)
+# endif // !defined(ASIO_DISABLE_UDP_GSO)
+#endif // !defined(ASIO_HAS_UDP_GSO)
+
+// Ancillary data (control messages) using recvmsg() and sendmsg().
+#if !defined(ASIO_HAS_ANCILLARY_DATA)
+# if !defined(ASIO_DISABLE_ANCILLARY_DATA)
+#  if !defined(ASIO_WINDOWS) \
+    && !defined(ASIO_WINDOWS_RUNTIME) \
+    && !defined(__CYGWIN__)
+#   define ASIO_HAS_ANCILLARY_DATA 1
+#  endif // !defined(ASIO_WINDOWS)
+         //   && !defined(ASIO_WINDOWS_RUNTIME)
+         //   && !defined(__CYGWIN__)
+# endif // !defined(ASIO_DISABLE_ANCILLARY_DATA)
+#endif // !defined(ASIO_HAS_ANCILLARY_DATA)
+
+// TCP Fast Open using MSG_FASTOPEN and the TCP_FASTOPEN socket option.
+#if !defined(ASIO_HAS_TCP_FASTOPEN)
+# if !defined(ASIO_DISABLE_TCP_FASTOPEN)
+#  if defined(__linux__)
+#   define ASIO_HAS_TCP_FASTOPEN 1
+#  endif // defined(__linux__)
+# endif // !defined(ASIO_DISABLE_TCP_FASTOPEN)
+#endif // !defined(ASIO_HAS_TCP_FASTOPEN)
+
+// Accepting sockets with accept4(), so that the new socket's non-blocking and
+// close-on-exec flags are set atomically.
+#if !defined(ASIO_HAS_ACCEPT4)
+# if !defined(ASIO_DISABLE_ACCEPT4)
+#  if defined(__linux__)
+#   define ASIO_HAS_ACCEPT4 1
+#  endif // defined(__linux__)
+# endif // !defined(ASIO_DISABLE_ACCEPT4)
+#endif // !defined(ASIO_HAS_ACCEPT4)
+
+// Binding multiple sockets to the same address and port using SO_REUSEPORT.
+#if !defined(ASIO_HAS_REUSE_PORT)
+# if !defined(ASIO_DISABLE_REUSE_PORT)
+#  if defined(__linux__) \
+  || defined(__APPLE__) \
+  || defined(__FreeBSD__) \
+  || defined(__NetBSD__) \
+  || defined(__OpenBSD__) \
+  || defined(__DragonFly__)
+#   define ASIO_HAS_REUSE_PORT 1
+#  endif // defined(__linux__)
+         //   || defined(__APPLE__)
+         //   || defined(__FreeBSD__)
+         //   || defined(__NetBSD__)
+         //   || defined(__OpenBSD__)
+         //   || defined(__DragonFly__)
+# endif // !defined(ASIO_DISABLE_REUSE_PORT)
+#endif // !defined(ASIO_HAS_REUSE_PORT)
+
+// Steering connections within a SO_REUSEPORT group by the receiving CPU, using
+// SO_INCOMING_CPU or a SO_ATTACH_REUSEPORT_CBPF program.
+#if !defined(ASIO_HAS_INCOMING_CPU)
+# if !defined(ASIO_DISABLE_INCOMING_CPU)
+#  if defined(__linux__) && defined(ASIO_HAS_REUSE_PORT)
+#   define ASIO_HAS_INCOMING_CPU 1
+#  endif // defined(__linux__) && defined(ASIO_HAS_REUSE_PORT)
+# endif // !defined(ASIO_DISABLE_INCOMING_CPU)
+#endif // !defined(ASIO_HAS_INCOMING_CPU)
+
+// Mirrored memory mappings using memfd_create() and mmap(). The C library
+// provides memfd_create() from glibc 2.27 and Android API level 30.
+#if !defined(ASIO_HAS_MEMFD)
+# if !defined(ASIO_DISABLE_MEMFD)
+#  if defined(__ANDROID__)
+#   if (__ANDROID_API__ >= 30)
+#    define ASIO_HAS_MEMFD 1
+#   endif // (__ANDROID_API__ >= 30)
+#  elif defined(__linux__) && defined(__GLIBC__)
+#   if (__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27)
+#    define ASIO_HAS_MEMFD 1
+#   endif // (__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27)
+#  endif // defined(__linux__) && defined(__GLIBC__)
+# endif // !defined(ASIO_DISABLE_MEMFD)
+#endif // !defined(ASIO_HAS_MEMFD)
+
 // Can use sigaction() instead of signal().
 #if !defined(ASIO_HAS_SIGACTION)
 # if !defined(ASIO_DISABLE_SIGACTION)
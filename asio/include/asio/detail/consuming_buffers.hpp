@@ -17,9 +17,11 @@
 
 #include "asio/detail/config.hpp"
 #include <cstddef>
+#include <iterator>
 #include "asio/buffer.hpp"
 #include "asio/detail/buffer_sequence_adapter.hpp"
 #include "asio/detail/limits.hpp"
+#include "asio/detail/memory.hpp"
 #include "asio/registered_buffer.hpp"
 
 #include "asio/detail/push_options.hpp"
@@ -31,7 +33,7 @@ namespace detail {
 template <typename Buffers>
 struct prepared_buffers_max
 {
-  enum { value = buffer_sequence_adapter_base::max_buffers };
+  enum { value = buffer_sequence_adapter_base::max_vectored_buffers };
 };
 
 template <typename Elem, std::size_t N>
@@ -46,25 +48,193 @@ struct prepared_buffers_max<std::array<Elem, N>>
   enum { value = N };
 };
 
-// A buffer sequence used to represent a subsequence of the buffers.
+// Helper class to give the prepared buffers access to the native buffer type.
+class prepared_buffers_base
+  : buffer_sequence_adapter_base
+{
+public:
+  typedef buffer_sequence_adapter_base::native_buffer_type native_buffer_type;
+};
+
+// A buffer sequence used to represent a subsequence of the buffers. The first
+// few buffers are stored inline, so that the operations that hold a copy of
+// the subsequence stay small. Longer subsequences, which arise only when
+// gathering from or scattering to long buffer sequences, are moved to storage
+// owned by the consuming_buffers object, together with space for their native
+// representation.
 template <typename Buffer, std::size_t MaxBuffers>
 struct prepared_buffers
 {
   typedef Buffer value_type;
   typedef const Buffer* const_iterator;
+  typedef prepared_buffers_base::native_buffer_type native_buffer_type;
+
+  enum { max_buffers = MaxBuffers };
+  enum { max_inline_buffers = MaxBuffers < 16 ? MaxBuffers : 16 };
+
+  prepared_buffers()
+    : overflow(0),
+      native_overflow(0),
+      count(0)
+  {
+  }
 
-  enum { max_buffers = MaxBuffers < 16 ? MaxBuffers : 16 };
+  const_iterator begin() const
+  {
+    return overflow ? overflow : elems;
+  }
 
-  prepared_buffers() : count(0) {}
-  const_iterator begin() const { return elems; }
-  const_iterator end() const { return elems + count; }
+  const_iterator end() const
+  {
+    return begin() + count;
+  }
 
-  Buffer elems[max_buffers];
+  void push_back(const Buffer& buffer)
+  {
+    (overflow ? overflow : elems)[count++] = buffer;
+  }
+
+  // Move the buffers to storage that is large enough for the subsequence.
+  void spill(Buffer* storage, native_buffer_type* native_storage)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+      storage[i] = elems[i];
+    overflow = storage;
+    native_overflow = native_storage;
+  }
+
+  Buffer elems[max_inline_buffers];
+  Buffer* overflow;
+  native_buffer_type* native_overflow;
   std::size_t count;
 };
 
-// A proxy for a sub-range in a list of buffers.
-template <typename Buffer, typename Buffers, typename Buffer_Iterator>
+// Adapts prepared buffers to the native representation, allowing up to the
+// platform's limit on the number of buffers in a single operation.
+template <typename Buffer, typename Elem, std::size_t MaxBuffers>
+class buffer_sequence_adapter<Buffer, prepared_buffers<Elem, MaxBuffers>>
+  : buffer_sequence_adapter_base
+{
+public:
+  enum { is_single_buffer = false };
+  enum { is_registered_buffer = false };
+
+  typedef prepared_buffers<Elem, MaxBuffers> buffers_type;
+
+  explicit buffer_sequence_adapter(const buffers_type& buffer_sequence)
+    : count_(buffer_sequence.count < std::size_t(max_vectored_buffers)
+        ? buffer_sequence.count : std::size_t(max_vectored_buffers)),
+      total_buffer_size_(0),
+      native_overflow_(buffer_sequence.native_overflow)
+  {
+    native_buffer_type* native = buffers();
+    typename buffers_type::const_iterator iter = buffer_sequence.begin();
+    for (std::size_t i = 0; i < count_; ++i, ++iter)
+    {
+      Buffer buffer(*iter);
+      init_native_buffer(native[i], buffer);
+      total_buffer_size_ += buffer.size();
+    }
+  }
+
+  native_buffer_type* buffers()
+  {
+    return count_ > buffers_type::max_inline_buffers
+      ? native_overflow_ : inline_buffers_;
+  }
+
+  std::size_t count() const
+  {
+    return count_;
+  }
+
+  std::size_t total_size() const
+  {
+    return total_buffer_size_;
+  }
+
+  registered_buffer_id registered_id() const
+  {
+    return registered_buffer_id();
+  }
+
+  bool all_empty() const
+  {
+    return total_buffer_size_ == 0;
+  }
+
+  static bool all_empty(const buffers_type& buffer_sequence)
+  {
+    typename buffers_type::const_iterator iter = buffer_sequence.begin();
+    typename buffers_type::const_iterator end = buffer_sequence.end();
+    for (; iter != end; ++iter)
+      if (Buffer(*iter).size() > 0)
+        return false;
+    return true;
+  }
+
+  static void validate(const buffers_type& buffer_sequence)
+  {
+    typename buffers_type::const_iterator iter = buffer_sequence.begin();
+    typename buffers_type::const_iterator end = buffer_sequence.end();
+    for (; iter != end; ++iter)
+    {
+      Buffer buffer(*iter);
+      buffer.data();
+    }
+  }
+
+  static Buffer first(const buffers_type& buffer_sequence)
+  {
+    typename buffers_type::const_iterator iter = buffer_sequence.begin();
+    typename buffers_type::const_iterator end = buffer_sequence.end();
+    for (; iter != end; ++iter)
+    {
+      Buffer buffer(*iter);
+      if (buffer.size() != 0)
+        return buffer;
+    }
+    return Buffer();
+  }
+
+  enum { linearisation_storage_size = 8192 };
+
+  static Buffer linearise(const buffers_type& buffer_sequence,
+      const asio::mutable_buffer& storage)
+  {
+    asio::mutable_buffer unused_storage = storage;
+    typename buffers_type::const_iterator iter = buffer_sequence.begin();
+    typename buffers_type::const_iterator end = buffer_sequence.end();
+    while (iter != end && unused_storage.size() != 0)
+    {
+      Buffer buffer(*iter);
+      ++iter;
+      if (buffer.size() == 0)
+        continue;
+      if (unused_storage.size() == storage.size())
+      {
+        if (iter == end)
+          return buffer;
+        if (buffer.size() >= unused_storage.size())
+          return buffer;
+      }
+      unused_storage += asio::buffer_copy(unused_storage, buffer);
+    }
+    return Buffer(storage.data(), storage.size() - unused_storage.size());
+  }
+
+private:
+  native_buffer_type inline_buffers_[buffers_type::max_inline_buffers];
+  std::size_t count_;
+  std::size_t total_buffer_size_;
+  native_buffer_type* native_overflow_;
+};
+
+// A proxy for a sub-range in a list of buffers. The storage for subsequences
+// that are too long to be held inline is allocated when it is first needed,
+// and is reused for every later subsequence.
+template <typename Buffer, typename Buffers, typename Buffer_Iterator,
+    typename Allocator = std::allocator<void>>
 class consuming_buffers
 {
 public:
@@ -72,16 +242,56 @@ public:
     prepared_buffers_type;
 
   // Construct to represent the entire list of buffers.
-  explicit consuming_buffers(const Buffers& buffers)
+  explicit consuming_buffers(const Buffers& buffers,
+      const Allocator& allocator = Allocator())
     : buffers_(buffers),
       total_consumed_(0),
       next_elem_(0),
-      next_elem_offset_(0)
+      next_elem_offset_(0),
+      allocator_(allocator),
+      storage_(0),
+      native_storage_(0),
+      storage_size_(0)
   {
     using asio::buffer_size;
     total_size_ = buffer_size(buffers);
   }
 
+  // Copies allocate their own storage when it is needed.
+  consuming_buffers(const consuming_buffers& other)
+    : buffers_(other.buffers_),
+      total_size_(other.total_size_),
+      total_consumed_(other.total_consumed_),
+      next_elem_(other.next_elem_),
+      next_elem_offset_(other.next_elem_offset_),
+      allocator_(other.allocator_),
+      storage_(0),
+      native_storage_(0),
+      storage_size_(0)
+  {
+  }
+
+  consuming_buffers(consuming_buffers&& other)
+    : buffers_(static_cast<Buffers&&>(other.buffers_)),
+      total_size_(other.total_size_),
+      total_consumed_(other.total_consumed_),
+      next_elem_(other.next_elem_),
+      next_elem_offset_(other.next_elem_offset_),
+      allocator_(static_cast<Allocator&&>(other.allocator_)),
+      storage_(other.storage_),
+      native_storage_(other.native_storage_),
+      storage_size_(other.storage_size_)
+  {
+    other.storage_ = 0;
+    other.native_storage_ = 0;
+    other.storage_size_ = 0;
+  }
+
+  ~consuming_buffers()
+  {
+    release();
+  }
+
   // Determine if we are at the end of the buffers.
   bool empty() const
   {
@@ -97,15 +307,23 @@ public:
     Buffer_Iterator end = asio::buffer_sequence_end(buffers_);
 
     std::advance(next, next_elem_);
+    Buffer_Iterator first = next;
     std::size_t elem_offset = next_elem_offset_;
     while (next != end && max_size > 0 && (result.count) < result.max_buffers)
     {
-      Buffer next_buf = Buffer(*next) + elem_offset;
-      result.elems[result.count] = asio::buffer(next_buf, max_size);
-      max_size -= result.elems[result.count].size();
+      Buffer next_buf = asio::buffer(Buffer(*next) + elem_offset, max_size);
+      max_size -= next_buf.size();
       elem_offset = 0;
-      if (result.elems[result.count].size() > 0)
-        ++result.count;
+      if (next_buf.size() > 0)
+      {
+        if (result.count == result.max_inline_buffers)
+        {
+          if (!storage_)
+            allocate(first, end);
+          result.spill(storage_, native_storage_);
+        }
+        result.push_back(next_buf);
+      }
       ++next;
     }
 
@@ -145,12 +363,65 @@ public:
     return total_consumed_;
   }
 
+  // Free the storage for long subsequences. Composed operations call this
+  // before invoking their handler, so that the memory may be reused by the
+  // next operation.
+  void release()
+  {
+    if (storage_)
+    {
+      buffer_allocator_type(allocator_).deallocate(storage_, storage_size_);
+      native_allocator_type(allocator_).deallocate(
+          native_storage_, storage_size_);
+      storage_ = 0;
+      native_storage_ = 0;
+      storage_size_ = 0;
+    }
+  }
+
 private:
+  typedef typename prepared_buffers_type::native_buffer_type
+    native_buffer_type;
+  typedef ASIO_REBIND_ALLOC(Allocator, Buffer) buffer_allocator_type;
+  typedef ASIO_REBIND_ALLOC(Allocator, native_buffer_type)
+    native_allocator_type;
+
+  // Allocate storage that is large enough for any subsequence starting at or
+  // after the given position.
+  void allocate(Buffer_Iterator first, Buffer_Iterator end)
+  {
+    std::size_t size = static_cast<std::size_t>(std::distance(first, end));
+    if (size > std::size_t(prepared_buffers_type::max_buffers))
+      size = prepared_buffers_type::max_buffers;
+
+    native_allocator_type native_allocator(allocator_);
+    native_buffer_type* native_storage = native_allocator.allocate(size);
+#if !defined(ASIO_NO_EXCEPTIONS)
+    try
+#endif // !defined(ASIO_NO_EXCEPTIONS)
+    {
+      storage_ = buffer_allocator_type(allocator_).allocate(size);
+    }
+#if !defined(ASIO_NO_EXCEPTIONS)
+    catch (...)
+    {
+      native_allocator.deallocate(native_storage, size);
+      throw;
+    }
+#endif // !defined(ASIO_NO_EXCEPTIONS)
+    native_storage_ = native_storage;
+    storage_size_ = size;
+  }
+
   Buffers buffers_;
   std::size_t total_size_;
   std::size_t total_consumed_;
   std::size_t next_elem_;
   std::size_t next_elem_offset_;
+  Allocator allocator_;
+  Buffer* storage_;
+  native_buffer_type* native_storage_;
+  std::size_t storage_size_;
 };
 
 // Base class of all consuming_buffers specialisations for single buffers.
@@ -190,87 +461,102 @@ public:
     return total_consumed_;
   }
 
+  // There is no storage to release.
+  void release()
+  {
+  }
+
 private:
   Buffer buffer_;
   std::size_t total_consumed_;
 };
 
-template <>
-class consuming_buffers<mutable_buffer, mutable_buffer, const mutable_buffer*>
+template <typename Allocator>
+class consuming_buffers<mutable_buffer,
+    mutable_buffer, const mutable_buffer*, Allocator>
   : public consuming_single_buffer<mutable_buffer>
 {
 public:
-  explicit consuming_buffers(const mutable_buffer& buffer)
+  explicit consuming_buffers(const mutable_buffer& buffer,
+      const Allocator& = Allocator())
     : consuming_single_buffer<mutable_buffer>(buffer)
   {
   }
 };
 
-template <>
-class consuming_buffers<const_buffer, mutable_buffer, const mutable_buffer*>
+template <typename Allocator>
+class consuming_buffers<const_buffer,
+    mutable_buffer, const mutable_buffer*, Allocator>
   : public consuming_single_buffer<const_buffer>
 {
 public:
-  explicit consuming_buffers(const mutable_buffer& buffer)
+  explicit consuming_buffers(const mutable_buffer& buffer,
+      const Allocator& = Allocator())
     : consuming_single_buffer<const_buffer>(buffer)
   {
   }
 };
 
-template <>
-class consuming_buffers<const_buffer, const_buffer, const const_buffer*>
+template <typename Allocator>
+class consuming_buffers<const_buffer,
+    const_buffer, const const_buffer*, Allocator>
   : public consuming_single_buffer<const_buffer>
 {
 public:
-  explicit consuming_buffers(const const_buffer& buffer)
+  explicit consuming_buffers(const const_buffer& buffer,
+      const Allocator& = Allocator())
     : consuming_single_buffer<const_buffer>(buffer)
   {
   }
 };
 
-template <>
+template <typename Allocator>
 class consuming_buffers<mutable_buffer,
-    mutable_registered_buffer, const mutable_buffer*>
+    mutable_registered_buffer, const mutable_buffer*, Allocator>
   : public consuming_single_buffer<mutable_registered_buffer>
 {
 public:
-  explicit consuming_buffers(const mutable_registered_buffer& buffer)
+  explicit consuming_buffers(const mutable_registered_buffer& buffer,
+      const Allocator& = Allocator())
     : consuming_single_buffer<mutable_registered_buffer>(buffer)
   {
   }
 };
 
-template <>
+template <typename Allocator>
 class consuming_buffers<const_buffer,
-    mutable_registered_buffer, const mutable_buffer*>
+    mutable_registered_buffer, const mutable_buffer*, Allocator>
   : public consuming_single_buffer<mutable_registered_buffer>
 {
 public:
-  explicit consuming_buffers(const mutable_registered_buffer& buffer)
+  explicit consuming_buffers(const mutable_registered_buffer& buffer,
+      const Allocator& = Allocator())
     : consuming_single_buffer<mutable_registered_buffer>(buffer)
   {
   }
 };
 
-template <>
+template <typename Allocator>
 class consuming_buffers<const_buffer,
-    const_registered_buffer, const const_buffer*>
+    const_registered_buffer, const const_buffer*, Allocator>
   : public consuming_single_buffer<const_registered_buffer>
 {
 public:
-  explicit consuming_buffers(const const_registered_buffer& buffer)
+  explicit consuming_buffers(const const_registered_buffer& buffer,
+      const Allocator& = Allocator())
     : consuming_single_buffer<const_registered_buffer>(buffer)
   {
   }
 };
 
-template <typename Buffer, typename Elem>
+template <typename Buffer, typename Elem, typename Allocator>
 class consuming_buffers<Buffer, boost::array<Elem, 2>,
-    typename boost::array<Elem, 2>::const_iterator>
+    typename boost::array<Elem, 2>::const_iterator, Allocator>
 {
 public:
   // Construct to represent the entire list of buffers.
-  explicit consuming_buffers(const boost::array<Elem, 2>& buffers)
+  explicit consuming_buffers(const boost::array<Elem, 2>& buffers,
+      const Allocator& = Allocator())
     : buffers_(buffers),
       total_consumed_(0)
   {
@@ -309,18 +595,24 @@ public:
     return total_consumed_;
   }
 
+  // There is no storage to release.
+  void release()
+  {
+  }
+
 private:
   boost::array<Elem, 2> buffers_;
   std::size_t total_consumed_;
 };
 
-template <typename Buffer, typename Elem>
+template <typename Buffer, typename Elem, typename Allocator>
 class consuming_buffers<Buffer, std::array<Elem, 2>,
-    typename std::array<Elem, 2>::const_iterator>
+    typename std::array<Elem, 2>::const_iterator, Allocator>
 {
 public:
   // Construct to represent the entire list of buffers.
-  explicit consuming_buffers(const std::array<Elem, 2>& buffers)
+  explicit consuming_buffers(const std::array<Elem, 2>& buffers,
+      const Allocator& = Allocator())
     : buffers_(buffers),
       total_consumed_(0)
   {
@@ -359,6 +651,11 @@ public:
     return total_consumed_;
   }
 
+  // There is no storage to release.
+  void release()
+  {
+  }
+
 private:
   std::array<Elem, 2> buffers_;
   std::size_t total_consumed_;
@@ -366,12 +663,12 @@ private:
 
 // Specialisation for null_buffers to ensure that the null_buffers type is
 // always passed through to the underlying read or write operation.
-template <typename Buffer>
-class consuming_buffers<Buffer, null_buffers, const mutable_buffer*>
+template <typename Buffer, typename Allocator>
+class consuming_buffers<Buffer, null_buffers, const mutable_buffer*, Allocator>
   : public asio::null_buffers
 {
 public:
-  consuming_buffers(const null_buffers&)
+  consuming_buffers(const null_buffers&, const Allocator& = Allocator())
   {
     // No-op.
   }
@@ -395,6 +692,11 @@ public:
   {
     return 0;
   }
+
+  // There is no storage to release.
+  void release()
+  {
+  }
 };
 
 } // namespace detail
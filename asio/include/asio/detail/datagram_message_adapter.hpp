@@ -0,0 +1,279 @@
+//
+// detail/datagram_message_adapter.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_DATAGRAM_MESSAGE_ADAPTER_HPP
+#define ASIO_DETAIL_DATAGRAM_MESSAGE_ADAPTER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_MMSG)
+
+#include <cstddef>
+#include <cstring>
+#include "asio/associated_allocator.hpp"
+#include "asio/detail/cstdint.hpp"
+#include "asio/detail/memory.hpp"
+#include "asio/detail/recycling_allocator.hpp"
+#include "asio/detail/socket_types.hpp"
+#include "asio/detail/thread_info_base.hpp"
+#include "asio/socket_base.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+// Adapts an array of datagram_message objects to the native message headers
+// used by recvmmsg() and sendmmsg(). The headers are held in storage that is
+// sized for the batch and allocated using the handler's associated allocator,
+// so that the operation object itself remains small enough to be recycled.
+template <typename Message>
+class datagram_message_adapter
+{
+public:
+  // The maximum number of messages to support in a single operation.
+  enum { max_messages = 64 };
+
+  // The storage required for a batch of messages, allocated using the
+  // handler's associated allocator.
+  template <typename Handler>
+  class storage;
+
+  datagram_message_adapter(Message* messages,
+      std::size_t count, void* storage_block, bool is_receive)
+    : messages_(messages),
+      count_(storage_block ? batch_size(count) : 0),
+      valid_(true),
+      storage_(storage_block),
+      hdrs_(static_cast<mmsghdr*>(storage_block)),
+      iov_(reinterpret_cast<iovec*>(hdrs_ + count_))
+#if defined(ASIO_HAS_UDP_GSO)
+      , control_(reinterpret_cast<control_buffer*>(iov_ + count_))
+#endif // defined(ASIO_HAS_UDP_GSO)
+  {
+    for (std::size_t i = 0; i < count_; ++i)
+    {
+      Message& m = messages_[i];
+      iov_[i].iov_base = const_cast<void*>(
+          static_cast<const void*>(m.buffer().data()));
+      iov_[i].iov_len = m.buffer().size();
+      hdrs_[i] = mmsghdr();
+      hdrs_[i].msg_hdr.msg_iov = &iov_[i];
+      hdrs_[i].msg_hdr.msg_iovlen = 1;
+      if (is_receive)
+      {
+        hdrs_[i].msg_hdr.msg_name = m.endpoint().data();
+        hdrs_[i].msg_hdr.msg_namelen =
+          static_cast<socklen_t>(m.endpoint().capacity());
+      }
+      else if (!(m.endpoint() == typename Message::endpoint_type()))
+      {
+        // A message without an endpoint is sent to the connected peer.
+        hdrs_[i].msg_hdr.msg_name = m.endpoint().data();
+        hdrs_[i].msg_hdr.msg_namelen =
+          static_cast<socklen_t>(m.endpoint().size());
+      }
+      m.length(0);
+      m.flags(0);
+#if defined(ASIO_HAS_UDP_GSO)
+      if (is_receive)
+      {
+        m.segment_size(0);
+        hdrs_[i].msg_hdr.msg_control = control_[i].buf;
+        hdrs_[i].msg_hdr.msg_controllen = sizeof(control_[i].buf);
+      }
+      else if (m.segment_size() > std::size_t(max_segment_size))
+        valid_ = false;
+      else if (m.segment_size() != 0)
+        init_segment_size(hdrs_[i].msg_hdr, control_[i], m.segment_size());
+#endif // defined(ASIO_HAS_UDP_GSO)
+    }
+  }
+
+  // Whether the messages can be passed to the operating system. A message to
+  // be sent is invalid if its segment size cannot be represented.
+  bool valid() const
+  {
+    return valid_;
+  }
+
+  mmsghdr* headers()
+  {
+    return hdrs_;
+  }
+
+  std::size_t count() const
+  {
+    return count_;
+  }
+
+  // Release the storage, which must then be deallocated using the handler's
+  // associated allocator.
+  template <typename Handler>
+  void deallocate(Handler& handler)
+  {
+    if (storage_)
+    {
+      storage<Handler>::deallocate(handler, storage_, count_);
+      storage_ = 0;
+      count_ = 0;
+    }
+  }
+
+  // Record the results of receiving the first n messages.
+  void complete_receive(std::size_t n)
+  {
+    for (std::size_t i = 0; i < n && i < count_; ++i)
+    {
+      messages_[i].length(hdrs_[i].msg_len);
+      messages_[i].endpoint().resize(hdrs_[i].msg_hdr.msg_namelen);
+      messages_[i].flags(
+          static_cast<socket_base::message_flags>(
+            hdrs_[i].msg_hdr.msg_flags));
+#if defined(ASIO_HAS_UDP_GSO)
+      messages_[i].segment_size(get_segment_size(hdrs_[i].msg_hdr));
+#endif // defined(ASIO_HAS_UDP_GSO)
+    }
+  }
+
+  // Record the results of sending the first n messages.
+  void complete_send(std::size_t n)
+  {
+    for (std::size_t i = 0; i < n && i < count_; ++i)
+      messages_[i].length(hdrs_[i].msg_len);
+  }
+
+private:
+  static std::size_t batch_size(std::size_t count)
+  {
+    return count < std::size_t(max_messages)
+      ? count : std::size_t(max_messages);
+  }
+
+#if defined(ASIO_HAS_UDP_GSO)
+  // The largest segment size that can be carried by a UDP_SEGMENT message.
+  enum { max_segment_size = 65535 };
+
+  // Space for the control messages of a single datagram. A received datagram
+  // may carry other ancillary data enabled on the socket, such as packet info
+  // or timestamps, alongside the UDP_GRO segment size. If the space is still
+  // exhausted, MSG_CTRUNC is reported in the message's flags.
+  union control_buffer
+  {
+    cmsghdr align;
+    char buf[CMSG_SPACE(sizeof(int)) * 4
+      + CMSG_SPACE(sizeof(in6_addr) + sizeof(unsigned int))
+      + CMSG_SPACE(sizeof(timespec) * 3)];
+  };
+
+  // Attach a UDP_SEGMENT control message to an outgoing message.
+  static void init_segment_size(msghdr& hdr,
+      control_buffer& control, std::size_t segment_size)
+  {
+    hdr.msg_control = control.buf;
+    hdr.msg_controllen = CMSG_SPACE(sizeof(uint16_t));
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&hdr);
+    cmsg->cmsg_level = ASIO_OS_DEF(IPPROTO_UDP);
+    cmsg->cmsg_type = ASIO_OS_DEF(UDP_SEGMENT);
+    cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+    uint16_t value = static_cast<uint16_t>(segment_size);
+    std::memcpy(CMSG_DATA(cmsg), &value, sizeof(value));
+  }
+
+  // Extract the segment size from a UDP_GRO control message, if present.
+  static std::size_t get_segment_size(msghdr& hdr)
+  {
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&hdr);
+        cmsg; cmsg = CMSG_NXTHDR(&hdr, cmsg))
+    {
+      if (cmsg->cmsg_level == ASIO_OS_DEF(IPPROTO_UDP)
+          && cmsg->cmsg_type == ASIO_OS_DEF(UDP_GRO))
+      {
+        int value = 0;
+        std::memcpy(&value, CMSG_DATA(cmsg), sizeof(value));
+        return value > 0 ? static_cast<std::size_t>(value) : 0;
+      }
+    }
+    return 0;
+  }
+#endif // defined(ASIO_HAS_UDP_GSO)
+
+  // The storage required for each message. The storage for a batch holds an
+  // array of headers, followed by an array of I/O vectors and then an array
+  // of control buffers, as the headers must be contiguous.
+  struct entry
+  {
+    mmsghdr hdr;
+    iovec iov;
+#if defined(ASIO_HAS_UDP_GSO)
+    control_buffer control;
+#endif // defined(ASIO_HAS_UDP_GSO)
+  };
+
+  Message* messages_;
+  std::size_t count_;
+  bool valid_;
+  void* storage_;
+  mmsghdr* hdrs_;
+  iovec* iov_;
+#if defined(ASIO_HAS_UDP_GSO)
+  control_buffer* control_;
+#endif // defined(ASIO_HAS_UDP_GSO)
+};
+
+// Allocates and deallocates the storage for a batch of messages. The storage
+// is recycled when the batch is small enough.
+template <typename Message>
+template <typename Handler>
+class datagram_message_adapter<Message>::storage
+{
+public:
+  static void* allocate(Handler& handler, std::size_t count)
+  {
+    std::size_t n = batch_size(count);
+    if (n == 0)
+      return 0;
+    allocator_type a(get_allocator(handler));
+    return a.allocate(n);
+  }
+
+  static void deallocate(Handler& handler, void* p, std::size_t count)
+  {
+    allocator_type a(get_allocator(handler));
+    a.deallocate(static_cast<entry*>(p), count);
+  }
+
+private:
+  typedef typename associated_allocator<Handler>::type
+    associated_allocator_type;
+  typedef typename get_recycling_allocator<associated_allocator_type,
+    thread_info_base::default_tag>::type default_allocator_type;
+  typedef ASIO_REBIND_ALLOC(default_allocator_type, entry) allocator_type;
+
+  static default_allocator_type get_allocator(Handler& handler)
+  {
+    return get_recycling_allocator<associated_allocator_type,
+      thread_info_base::default_tag>::get(
+        asio::get_associated_allocator(handler));
+  }
+};
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_MMSG)
+
+#endif // ASIO_DETAIL_DATAGRAM_MESSAGE_ADAPTER_HPP
@@ -33,6 +33,10 @@
 #include "asio/detail/wait_handler.hpp"
 #include "asio/detail/wait_op.hpp"
 
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+# include "asio/detail/allocation_accounting_service.hpp"
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+
 #if defined(ASIO_WINDOWS_RUNTIME)
 # include <chrono>
 # include <thread>
@@ -71,6 +75,9 @@ public:
       scheduler_(asio::use_service<timer_scheduler>(context))
   {
     scheduler_.init_task();
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+    timer_queue_.set_allocation_counters(&get_allocation_counters(context));
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
     scheduler_.add_timer_queue(timer_queue_);
   }
 
@@ -19,6 +19,7 @@
 
 #if defined(ASIO_HAS_EPOLL)
 
+#include "asio/detail/allocation_counters.hpp"
 #include "asio/detail/atomic_count.hpp"
 #include "asio/detail/conditionally_enabled_mutex.hpp"
 #include "asio/detail/limits.hpp"
@@ -281,6 +282,11 @@ private:
   // Keep track of all registered descriptors.
   object_pool<descriptor_state> registered_descriptors_;
 
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  // The counters charged for the memory used by registered descriptors.
+  allocation_counters* allocation_counters_;
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+
   // Helper class to do post-perform_io cleanup.
   struct perform_io_cleanup_on_block_exit;
   friend struct perform_io_cleanup_on_block_exit;
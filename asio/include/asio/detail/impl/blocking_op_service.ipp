@@ -0,0 +1,117 @@
+//
+// detail/impl/blocking_op_service.ipp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_IMPL_BLOCKING_OP_SERVICE_IPP
+#define ASIO_DETAIL_IMPL_BLOCKING_OP_SERVICE_IPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include "asio/config.hpp"
+#include "asio/detail/blocking_op_service.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+class blocking_op_service::work_scheduler_runner
+{
+public:
+  work_scheduler_runner(scheduler_impl& work_scheduler)
+    : work_scheduler_(work_scheduler)
+  {
+  }
+
+  void operator()()
+  {
+    asio::error_code ec;
+    work_scheduler_.run(ec);
+  }
+
+private:
+  scheduler_impl& work_scheduler_;
+};
+
+blocking_op_service::blocking_op_service(execution_context& context)
+  : execution_context_service_base<blocking_op_service>(context),
+    scheduler_(asio::use_service<scheduler_impl>(context)),
+    work_scheduler_(new scheduler_impl(context, false)),
+    thread_count_(config(context).get("scheduler", "blocking_op_threads", 1U)),
+    scheduler_locking_(config(context).get("scheduler", "locking", true))
+{
+  work_scheduler_->work_started();
+}
+
+blocking_op_service::~blocking_op_service()
+{
+  shutdown();
+}
+
+void blocking_op_service::shutdown()
+{
+  if (work_scheduler_.get())
+  {
+    work_scheduler_->work_finished();
+    work_scheduler_->stop();
+    work_threads_.join();
+    work_scheduler_.reset();
+  }
+}
+
+void blocking_op_service::notify_fork(execution_context::fork_event fork_ev)
+{
+  if (!work_threads_.empty())
+  {
+    if (fork_ev == execution_context::fork_prepare)
+    {
+      work_scheduler_->stop();
+      work_threads_.join();
+    }
+  }
+  else if (fork_ev != execution_context::fork_prepare)
+  {
+    work_scheduler_->restart();
+  }
+}
+
+void blocking_op_service::start_op(blocking_op* op)
+{
+  if (scheduler_locking_)
+  {
+    start_work_threads();
+    scheduler_.work_started();
+    work_scheduler_->post_immediate_completion(op, false);
+  }
+  else
+  {
+    op->ec_ = asio::error::operation_not_supported;
+    scheduler_.post_immediate_completion(op, false);
+  }
+}
+
+void blocking_op_service::start_work_threads()
+{
+  asio::detail::mutex::scoped_lock lock(mutex_);
+  if (work_threads_.empty())
+  {
+    work_threads_.create_threads(work_scheduler_runner(*work_scheduler_),
+        thread_count_ > 0 ? thread_count_ : 1);
+  }
+}
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_DETAIL_IMPL_BLOCKING_OP_SERVICE_IPP
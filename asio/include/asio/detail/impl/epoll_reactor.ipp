@@ -31,6 +31,10 @@
 # include <sys/timerfd.h>
 #endif // defined(ASIO_HAS_TIMERFD)
 
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+# include "asio/detail/allocation_accounting_service.hpp"
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+
 #include "asio/detail/push_options.hpp"
 
 namespace asio {
@@ -52,6 +56,9 @@ epoll_reactor::epoll_reactor(asio::execution_context& ctx)
     registered_descriptors_(
         config(ctx).get("reactor", "preallocated_io_objects", 0U),
         io_locking_, io_locking_spin_count_)
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+    , allocation_counters_(&get_allocation_counters(ctx))
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
 {
   // Add the interrupter's descriptor to epoll.
   epoll_event ev = { 0, { 0 } };
@@ -90,6 +97,10 @@ void epoll_reactor::shutdown()
     for (int i = 0; i < max_ops; ++i)
       ops.push(state->op_queue_[i]);
     state->shutdown_ = true;
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+    allocation_counters_->record_deallocation(
+        allocation_counters::reactor, sizeof(descriptor_state));
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
     registered_descriptors_.free(state);
   }
 
@@ -678,12 +689,20 @@ int epoll_reactor::do_timerfd_create()
 epoll_reactor::descriptor_state* epoll_reactor::allocate_descriptor_state()
 {
   mutex::scoped_lock descriptors_lock(registered_descriptors_mutex_);
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  allocation_counters_->record_allocation(
+      allocation_counters::reactor, sizeof(descriptor_state));
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
   return registered_descriptors_.alloc(io_locking_, io_locking_spin_count_);
 }
 
 void epoll_reactor::free_descriptor_state(epoll_reactor::descriptor_state* s)
 {
   mutex::scoped_lock descriptors_lock(registered_descriptors_mutex_);
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  allocation_counters_->record_deallocation(
+      allocation_counters::reactor, sizeof(descriptor_state));
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
   registered_descriptors_.free(s);
 }
 
@@ -32,6 +32,7 @@ namespace detail {
 io_uring_file_service::io_uring_file_service(
     execution_context& context)
   : execution_context_service_base<io_uring_file_service>(context),
+    io_uring_service_(asio::use_service<io_uring_service>(context)),
     descriptor_service_(context)
 {
 }
@@ -53,7 +54,6 @@ asio::error_code io_uring_file_service::open(
     return ec;
   }
 
-  descriptor_ops::state_type state = 0;
   int fd = descriptor_ops::open(path, static_cast<int>(open_flags), 0777, ec);
   if (fd < 0)
   {
@@ -61,17 +61,54 @@ asio::error_code io_uring_file_service::open(
     return ec;
   }
 
-  // We're done. Take ownership of the serial port descriptor.
-  if (descriptor_service_.assign(impl, fd, ec))
+  assign_opened(impl, fd, ec);
+  ASIO_ERROR_LOCATION(ec);
+  return ec;
+}
+
+void io_uring_file_service::complete_async_open(
+    io_uring_file_service::implementation_type& impl,
+    io_uring_service::per_io_object_data& io_object_data,
+    int descriptor, asio::error_code& ec)
+{
+  if (io_object_data)
+  {
+    io_uring_service_.deregister_io_object(io_object_data);
+    io_uring_service_.cleanup_io_object(io_object_data);
+  }
+
+  if (descriptor != -1)
   {
+    if (is_open(impl))
+    {
+      descriptor_ops::state_type state = 0;
+      asio::error_code ignored_ec;
+      descriptor_ops::close(descriptor, state, ignored_ec);
+      ec = asio::error::already_open;
+    }
+    else
+    {
+      assign_opened(impl, descriptor, ec);
+    }
+  }
+}
+
+asio::error_code io_uring_file_service::assign_opened(
+    io_uring_file_service::implementation_type& impl,
+    int descriptor, asio::error_code& ec)
+{
+  // Take ownership of the file descriptor.
+  if (descriptor_service_.assign(impl, descriptor, ec))
+  {
+    descriptor_ops::state_type state = 0;
     asio::error_code ignored_ec;
-    descriptor_ops::close(fd, state, ignored_ec);
+    descriptor_ops::close(descriptor, state, ignored_ec);
+    return ec;
   }
 
   (void)::posix_fadvise(native_handle(impl), 0, 0,
       impl.is_stream_ ? POSIX_FADV_SEQUENTIAL : POSIX_FADV_RANDOM);
 
-  ASIO_ERROR_LOCATION(ec);
   return ec;
 }
 
@@ -20,6 +20,8 @@
 #if defined(ASIO_HAS_IO_URING)
 
 #include <cstddef>
+#include <cstring>
+#include <poll.h>
 #include <sys/eventfd.h>
 #include "asio/detail/io_uring_service.hpp"
 #include "asio/detail/reactor_op.hpp"
@@ -27,6 +29,10 @@
 #include "asio/detail/throw_error.hpp"
 #include "asio/error.hpp"
 
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+# include "asio/detail/allocation_accounting_service.hpp"
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+
 #include "asio/detail/push_options.hpp"
 
 namespace asio {
@@ -50,17 +56,42 @@ io_uring_service::io_uring_service(asio::execution_context& ctx)
     registered_io_objects_(
         config(ctx).get("reactor", "preallocated_io_objects", 0U),
         io_locking_, io_locking_spin_count_),
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+    allocation_counters_(&get_allocation_counters(ctx)),
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
     reactor_(use_service<reactor>(ctx)),
     reactor_data_(),
-    event_fd_(-1)
+    event_fd_(-1),
+#if defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+    thread_rings_enabled_(
+        config(ctx).get("reactor", "io_uring_thread_rings", false)),
+#else // defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+    thread_rings_enabled_(false),
+#endif // defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+    thread_rings_(0)
 {
   reactor_.init_task();
   init_ring();
+#if defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+  if (thread_rings_enabled_)
+  {
+    thread_rings_enabled_ = thread_rings_supported();
+    if (thread_rings_enabled_)
+      this_thread_ring_.reset(new posix_tss_ptr<thread_ring>);
+  }
+#endif // defined(ASIO_HAS_IO_URING_THREAD_RINGS)
   register_with_reactor();
 }
 
 io_uring_service::~io_uring_service()
 {
+  while (thread_ring* r = thread_rings_)
+  {
+    thread_rings_ = r->next_;
+    if (r->ring_.ring_fd != -1)
+      ::io_uring_queue_exit(&r->ring_);
+    delete r;
+  }
   if (ring_.ring_fd != -1)
     ::io_uring_queue_exit(&ring_);
   if (event_fd_ != -1)
@@ -83,19 +114,31 @@ void io_uring_service::shutdown()
       if (!io_obj->queues_[i].op_queue_.empty())
       {
         ops.push(io_obj->queues_[i].op_queue_);
-        if (::io_uring_sqe* sqe = get_sqe())
-          ::io_uring_prep_cancel(sqe, &io_obj->queues_[i], 0);
+        prepare_cancel(&io_obj->queues_[i]);
       }
     }
     io_obj->shutdown_ = true;
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+    allocation_counters_->record_deallocation(
+        allocation_counters::reactor, sizeof(io_object));
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
     registered_io_objects_.free(io_obj);
   }
 
+  // Stop watching the per-thread rings.
+  for (thread_ring* r = thread_rings_; r != 0; r = r->next_)
+    if (::io_uring_sqe* sqe = get_sqe())
+      ::io_uring_prep_cancel(sqe, thread_ring_tag(r), 0);
+
   // Cancel the timeout operation.
   if (::io_uring_sqe* sqe = get_sqe())
     ::io_uring_prep_cancel(sqe, &timeout_, IOSQE_IO_DRAIN);
   submit_sqes();
 
+  // The I/O queues have already been abandoned, so any completions on the
+  // per-thread rings are simply discarded.
+  drain_thread_rings(0);
+
   // Wait for all completions to come back.
   for (; outstanding_work_ > 0; --outstanding_work_)
   {
@@ -129,15 +172,17 @@ void io_uring_service::notify_fork(
               && !io_obj->queues_[i].cancel_requested_)
           {
             mutex::scoped_lock lock(mutex_);
-            if (::io_uring_sqe* sqe = get_sqe())
-              ::io_uring_prep_cancel(sqe, &io_obj->queues_[i], 0);
+            prepare_cancel(&io_obj->queues_[i]);
           }
         }
       }
 
-      // Cancel the timeout operation.
+      // Cancel the timeout operation, and stop watching the per-thread rings.
       {
         mutex::scoped_lock lock(mutex_);
+        for (thread_ring* r = thread_rings_; r != 0; r = r->next_)
+          if (::io_uring_sqe* sqe = get_sqe())
+            ::io_uring_prep_cancel(sqe, thread_ring_tag(r), 0);
         if (::io_uring_sqe* sqe = get_sqe())
           ::io_uring_prep_cancel(sqe, &timeout_, IOSQE_IO_DRAIN);
         submit_sqes();
@@ -155,7 +200,8 @@ void io_uring_service::notify_fork(
           break;
         if (void* ptr = ::io_uring_cqe_get_data(cqe))
         {
-          if (ptr != this && ptr != &timer_queues_ && ptr != &timeout_)
+          if (ptr != this && ptr != &timer_queues_ && ptr != &timeout_
+              && ptr != &thread_rings_ && !thread_ring_from_tag(ptr))
           {
             io_queue* io_q = static_cast<io_queue*>(ptr);
             io_q->set_result(cqe->res);
@@ -163,6 +209,7 @@ void io_uring_service::notify_fork(
           }
         }
       }
+      drain_thread_rings(&ops);
       scheduler_.post_deferred_completions(ops);
 
       // Restart and eventfd operation.
@@ -171,16 +218,42 @@ void io_uring_service::notify_fork(
     break;
 
   case asio::execution_context::fork_parent:
-    // Restart the timeout and eventfd operations.
-    update_timeout();
-    register_with_reactor();
+    {
+      // Restart the timeout and eventfd operations, and resume watching the
+      // per-thread rings.
+      mutex::scoped_lock lock(mutex_);
+      update_timeout();
+      for (thread_ring* r = thread_rings_; r != 0; r = r->next_)
+        watch_thread_ring(r);
+      submit_sqes();
+      lock.unlock();
+      register_with_reactor();
+    }
     break;
 
   case asio::execution_context::fork_child:
     {
-      // The child process gets a new io_uring instance.
+      // The child process gets new io_uring instances.
       ::io_uring_queue_exit(&ring_);
       init_ring();
+      mutex::scoped_lock lock(mutex_);
+      for (thread_ring* r = thread_rings_; r != 0; r = r->next_)
+      {
+        ::io_uring_queue_exit(&r->ring_);
+        r->outstanding_work_ = 0;
+        r->pending_sqes_ = 0;
+        int result = ::io_uring_queue_init(thread_ring_size, &r->ring_, 0);
+        if (result < 0)
+        {
+          r->ring_.ring_fd = -1;
+          asio::error_code ec(-result,
+              asio::error::get_system_category());
+          asio::detail::throw_error(ec, "io_uring_queue_init");
+        }
+        watch_thread_ring(r);
+      }
+      submit_sqes();
+      lock.unlock();
       register_with_reactor();
     }
     break;
@@ -207,6 +280,7 @@ void io_uring_service::register_io_object(
   {
     io_obj->queues_[i].io_object_ = io_obj;
     io_obj->queues_[i].cancel_requested_ = false;
+    io_obj->queues_[i].ring_ = 0;
   }
 }
 
@@ -224,6 +298,7 @@ void io_uring_service::register_internal_io_object(
   {
     io_obj->queues_[i].io_object_ = io_obj;
     io_obj->queues_[i].cancel_requested_ = false;
+    io_obj->queues_[i].ring_ = 0;
   }
 
   io_obj->queues_[op_type].op_queue_.push(op);
@@ -288,21 +363,16 @@ void io_uring_service::start_op(int op_type,
     }
     else
     {
+      // When submitting to a per-thread ring the operation may complete on
+      // another thread before submit_op returns, so the work must be counted
+      // first.
       io_obj->queues_[op_type].op_queue_.push(op);
-      io_object_lock.unlock();
-      mutex::scoped_lock lock(mutex_);
-      if (::io_uring_sqe* sqe = get_sqe())
-      {
-        op->prepare(sqe);
-        ::io_uring_sqe_set_data(sqe, &io_obj->queues_[op_type]);
-        scheduler_.work_started();
-        post_submit_sqes_op(lock);
-      }
-      else
+      scheduler_.work_started();
+      if (!submit_op(op, &io_obj->queues_[op_type]))
       {
-        lock.unlock();
         io_obj->queues_[op_type].set_result(-ENOBUFS);
-        post_immediate_completion(&io_obj->queues_[op_type], is_continuation);
+        io_object_lock.unlock();
+        scheduler_.post_deferred_completion(&io_obj->queues_[op_type]);
       }
     }
   }
@@ -313,6 +383,16 @@ void io_uring_service::start_op(int op_type,
   }
 }
 
+bool io_uring_service::is_op_queue_empty(
+    int op_type, io_uring_service::per_io_object_data& io_obj)
+{
+  if (!io_obj)
+    return true;
+
+  mutex::scoped_lock io_object_lock(io_obj->mutex_);
+  return io_obj->queues_[op_type].op_queue_.empty();
+}
+
 void io_uring_service::cancel_ops(io_uring_service::per_io_object_data& io_obj)
 {
   if (!io_obj)
@@ -347,13 +427,10 @@ void io_uring_service::cancel_ops_by_key(
         other_ops.push(op);
         if (!io_obj->queues_[op_type].cancel_requested_)
         {
-          io_obj->queues_[op_type].cancel_requested_ = true;
           mutex::scoped_lock lock(mutex_);
-          if (::io_uring_sqe* sqe = get_sqe())
-          {
-            ::io_uring_prep_cancel(sqe, &io_obj->queues_[op_type], 0);
-            submit_sqes();
-          }
+          io_obj->queues_[op_type].cancel_requested_ =
+            prepare_cancel(&io_obj->queues_[op_type]);
+          submit_sqes();
         }
       }
       else
@@ -458,6 +535,7 @@ void io_uring_service::run(long usec, op_queue<operation>& ops)
 
   bool check_timers = false;
   int count = 0;
+  int uncounted = 0;
   while (result == 0 || local_ops > 0)
   {
     if (result == 0)
@@ -468,6 +546,12 @@ void io_uring_service::run(long usec, op_queue<operation>& ops)
         {
           // The io_uring service was interrupted.
         }
+        else if (ptr == &thread_rings_)
+        {
+          // The io_uring service was interrupted by a message from a
+          // per-thread ring. Messages are not counted as outstanding work.
+          ++uncounted;
+        }
         else if (ptr == &timer_queues_)
         {
           check_timers = true;
@@ -482,6 +566,25 @@ void io_uring_service::run(long usec, op_queue<operation>& ops)
         {
           --local_ops;
         }
+        else if (thread_ring* r = thread_ring_from_tag(ptr))
+        {
+          // A per-thread ring has completions. The poll request remains
+          // outstanding until a completion without IORING_CQE_F_MORE is
+          // delivered, and only that final completion balances the work
+          // counted when the poll was submitted.
+          reap_thread_ring(r, ops);
+          if (cqe->flags & IORING_CQE_F_MORE)
+            ++uncounted;
+          else if (cqe->res != -ECANCELED)
+          {
+            mutex::scoped_lock lock(mutex_);
+            if (!shutdown_)
+            {
+              watch_thread_ring(r);
+              push_submit_sqes_op(ops);
+            }
+          }
+        }
         else
         {
           io_queue* io_q = static_cast<io_queue*>(ptr);
@@ -496,7 +599,7 @@ void io_uring_service::run(long usec, op_queue<operation>& ops)
       ? ::io_uring_peek_cqe(&ring_, &cqe) : -EAGAIN;
   }
 
-  decrement(outstanding_work_, count);
+  decrement(outstanding_work_, count - uncounted);
 
   if (check_timers)
   {
@@ -517,6 +620,26 @@ void io_uring_service::run(long usec, op_queue<operation>& ops)
 
 void io_uring_service::interrupt()
 {
+#if defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+  // A thread with its own ring can wake the shared ring with a message,
+  // avoiding contention on the shared ring's submission queue. The message's
+  // completion on the shared ring is not counted as outstanding work, since
+  // it never arrives if the message cannot be delivered. In that case the
+  // failed message's completion on the sending ring wakes the shared ring.
+  if (thread_ring* r = this_thread_ring())
+  {
+    if (::io_uring_sqe* sqe = r->get_sqe())
+    {
+      ::io_uring_prep_msg_ring(sqe, ring_.ring_fd, 0,
+          reinterpret_cast<__u64>(&thread_rings_), 0);
+      ::io_uring_sqe_set_data(sqe, this);
+      r->submit_sqes();
+      if (r->pending_sqes_ == 0)
+        return;
+    }
+  }
+#endif // defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+
   mutex::scoped_lock lock(mutex_);
   if (::io_uring_sqe* sqe = get_sqe())
   {
@@ -618,12 +741,20 @@ void io_uring_service::register_with_reactor()
 io_uring_service::io_object* io_uring_service::allocate_io_object()
 {
   mutex::scoped_lock registration_lock(registration_mutex_);
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  allocation_counters_->record_allocation(
+      allocation_counters::reactor, sizeof(io_object));
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
   return registered_io_objects_.alloc(io_locking_, io_locking_spin_count_);
 }
 
 void io_uring_service::free_io_object(io_uring_service::io_object* io_obj)
 {
   mutex::scoped_lock registration_lock(registration_mutex_);
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  allocation_counters_->record_deallocation(
+      allocation_counters::reactor, sizeof(io_object));
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
   registered_io_objects_.free(io_obj);
 }
 
@@ -656,9 +787,8 @@ bool io_uring_service::do_cancel_ops(
       if (!io_obj->queues_[i].op_queue_.empty()
           && !io_obj->queues_[i].cancel_requested_)
       {
-        io_obj->queues_[i].cancel_requested_ = true;
-        if (::io_uring_sqe* sqe = get_sqe())
-          ::io_uring_prep_cancel(sqe, &io_obj->queues_[i], 0);
+        io_obj->queues_[i].cancel_requested_ =
+          prepare_cancel(&io_obj->queues_[i]);
       }
     }
     submit_sqes();
@@ -713,6 +843,252 @@ __kernel_timespec io_uring_service::get_timeout() const
   return sqe;
 }
 
+template <typename Ring>
+bool io_uring_service::prepare_op_sqes(
+    Ring& r, io_uring_operation* op, io_queue* io_q)
+{
+  // A linked timeout must be submitted in the same batch as the operation it
+  // applies to, so make sure there is room for both entries. If there is not,
+  // the submission fails rather than losing the deadline.
+  if (op->has_link_timeout_ && ::io_uring_sq_space_left(&r.ring_) < 2)
+  {
+    r.submit_sqes();
+    if (::io_uring_sq_space_left(&r.ring_) < 2)
+      return false;
+  }
+
+  if (::io_uring_sqe* sqe = r.get_sqe())
+  {
+    op->prepare(sqe);
+    ::io_uring_sqe_set_data(sqe, io_q);
+    if (op->has_link_timeout_)
+    {
+      // The timeout's own completion carries no user data and is simply
+      // counted and discarded by run().
+      ::io_uring_sqe* timeout_sqe = r.get_sqe();
+      sqe->flags |= IOSQE_IO_LINK;
+      ::io_uring_prep_link_timeout(timeout_sqe,
+          &op->link_timeout_, IORING_TIMEOUT_ABS);
+    }
+    return true;
+  }
+  return false;
+}
+
+bool io_uring_service::submit_op(io_uring_operation* op, io_queue* io_q)
+{
+  if (thread_ring* r = get_thread_ring())
+  {
+    // Only the owning thread submits to its ring, so there is no need to
+    // batch submissions.
+    io_q->ring_ = r;
+    if (!prepare_op_sqes(*r, op, io_q))
+      return false;
+    r->submit_sqes();
+    return true;
+  }
+
+  io_q->ring_ = 0;
+  mutex::scoped_lock lock(mutex_);
+  if (!prepare_op_sqes(*this, op, io_q))
+    return false;
+  post_submit_sqes_op(lock);
+  return true;
+}
+
+bool io_uring_service::prepare_cancel(io_queue* io_q)
+{
+#if defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+  if (thread_ring* r = io_q->ring_)
+  {
+    if (r == this_thread_ring())
+    {
+      if (::io_uring_sqe* sqe = r->get_sqe())
+      {
+        ::io_uring_prep_cancel(sqe, io_q, 0);
+        r->submit_sqes();
+        return true;
+      }
+      return false;
+    }
+
+    // Another thread owns the ring's submission queue, so cancel the
+    // operation synchronously. A zero timeout means that we do not wait for
+    // an operation that is already executing, as its completion is delivered
+    // regardless.
+    ::io_uring_sync_cancel_reg reg;
+    std::memset(&reg, 0, sizeof(reg));
+    reg.addr = reinterpret_cast<__u64>(io_q);
+    reg.fd = -1;
+    reg.timeout.tv_sec = 0;
+    reg.timeout.tv_nsec = 0;
+    int result;
+    do
+      result = ::io_uring_register_sync_cancel(&r->ring_, &reg);
+    while (result == -EINTR);
+
+    // The operation has been cancelled, has already completed, or is
+    // executing. In each case its completion will be delivered. Any other
+    // error means the cancellation request was not made.
+    return result >= 0 || result == -ENOENT
+      || result == -EALREADY || result == -ETIME;
+  }
+#endif // defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+
+  if (::io_uring_sqe* sqe = get_sqe())
+  {
+    ::io_uring_prep_cancel(sqe, io_q, 0);
+    return true;
+  }
+  return false;
+}
+
+bool io_uring_service::thread_rings_supported()
+{
+#if defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+  // IORING_OP_MSG_RING requires Linux 5.18.
+  ::io_uring_probe* probe = ::io_uring_get_probe_ring(&ring_);
+  if (!probe)
+    return false;
+  bool msg_ring = ::io_uring_opcode_supported(probe, IORING_OP_MSG_RING) != 0;
+  ::io_uring_free_probe(probe);
+  if (!msg_ring)
+    return false;
+
+  // Synchronous cancellation requires Linux 6.0. Where it is supported, a
+  // request that matches no operation fails with ENOENT.
+  ::io_uring_sync_cancel_reg reg;
+  std::memset(&reg, 0, sizeof(reg));
+  reg.addr = reinterpret_cast<__u64>(&thread_rings_enabled_);
+  reg.fd = -1;
+  reg.timeout.tv_sec = 0;
+  reg.timeout.tv_nsec = 0;
+  int result = ::io_uring_register_sync_cancel(&ring_, &reg);
+  return result >= 0 || result == -ENOENT;
+#else // defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+  return false;
+#endif // defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+}
+
+io_uring_service::thread_ring* io_uring_service::this_thread_ring()
+{
+#if defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+  if (this_thread_ring_.get())
+    return *this_thread_ring_;
+#endif // defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+  return 0;
+}
+
+io_uring_service::thread_ring* io_uring_service::get_thread_ring()
+{
+#if defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+  if (thread_rings_enabled_ && scheduler_.can_dispatch())
+  {
+    if (thread_ring* r = this_thread_ring())
+      return r;
+    return create_thread_ring();
+  }
+#endif // defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+  return 0;
+}
+
+io_uring_service::thread_ring* io_uring_service::create_thread_ring()
+{
+#if defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+  thread_ring* r = new thread_ring(mutex_.enabled());
+  int result = ::io_uring_queue_init(thread_ring_size, &r->ring_, 0);
+  if (result < 0)
+  {
+    // Fall back to using the shared ring for this thread.
+    delete r;
+    return 0;
+  }
+
+  mutex::scoped_lock lock(mutex_);
+  if (shutdown_)
+  {
+    lock.unlock();
+    ::io_uring_queue_exit(&r->ring_);
+    delete r;
+    return 0;
+  }
+  r->next_ = thread_rings_;
+  thread_rings_ = r;
+  watch_thread_ring(r);
+  submit_sqes();
+  lock.unlock();
+
+  *this_thread_ring_ = r;
+  return r;
+#else // defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+  return 0;
+#endif // defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+}
+
+void io_uring_service::watch_thread_ring(thread_ring* r)
+{
+  if (::io_uring_sqe* sqe = get_sqe())
+  {
+    ::io_uring_prep_poll_multishot(sqe, r->ring_.ring_fd, POLLIN);
+    ::io_uring_sqe_set_data(sqe, thread_ring_tag(r));
+  }
+}
+
+void io_uring_service::reap_thread_ring(
+    thread_ring* r, op_queue<operation>& ops)
+{
+  mutex::scoped_lock lock(r->completion_mutex_);
+
+  int count = 0;
+  ::io_uring_cqe* cqe = 0;
+  while (::io_uring_peek_cqe(&r->ring_, &cqe) == 0)
+  {
+    if (void* ptr = ::io_uring_cqe_get_data(cqe))
+    {
+      if (ptr == this)
+      {
+        // The completion of an interrupt message. If the message could not
+        // be delivered, this completion is itself enough to wake the shared
+        // ring.
+      }
+      else
+      {
+        io_queue* io_q = static_cast<io_queue*>(ptr);
+        io_q->set_result(cqe->res);
+        ops.push(io_q);
+      }
+    }
+    ::io_uring_cqe_seen(&r->ring_, cqe);
+    ++count;
+  }
+
+  decrement(r->outstanding_work_, count);
+}
+
+void io_uring_service::drain_thread_rings(op_queue<operation>* ops)
+{
+  for (thread_ring* r = thread_rings_; r != 0; r = r->next_)
+  {
+    mutex::scoped_lock lock(r->completion_mutex_);
+    for (; r->outstanding_work_ > 0; --r->outstanding_work_)
+    {
+      ::io_uring_cqe* cqe = 0;
+      if (::io_uring_wait_cqe(&r->ring_, &cqe) != 0)
+        break;
+      if (void* ptr = ::io_uring_cqe_get_data(cqe))
+      {
+        if (ptr != this && ops)
+        {
+          io_queue* io_q = static_cast<io_queue*>(ptr);
+          io_q->set_result(cqe->res);
+          ops->push(io_q);
+        }
+      }
+      ::io_uring_cqe_seen(&r->ring_, cqe);
+    }
+  }
+}
+
 void io_uring_service::submit_sqes()
 {
   if (pending_sqes_ != 0)
@@ -772,7 +1148,8 @@ void io_uring_service::submit_sqes_op::do_complete(void* owner, operation* base,
 }
 
 io_uring_service::io_queue::io_queue()
-  : operation(&io_uring_service::io_queue::do_complete)
+  : operation(&io_uring_service::io_queue::do_complete),
+    ring_(0)
 {
 }
 
@@ -821,7 +1198,11 @@ operation* io_uring_service::io_queue::perform_io(int result)
   perform_io_cleanup_on_block_exit io_cleanup(io_object_->service_);
   mutex::scoped_lock io_object_lock(io_object_->mutex_);
 
-  if (result != -ECANCELED || cancel_requested_)
+  // An ECANCELED result that was not explicitly requested indicates either
+  // that the operation's linked timeout has expired, or that the operation was
+  // interrupted by a fork and must be restarted.
+  if (result != -ECANCELED || cancel_requested_
+      || (!op_queue_.empty() && op_queue_.front()->link_timeout_expired()))
   {
     if (io_uring_operation* op = op_queue_.front())
     {
@@ -854,16 +1235,8 @@ operation* io_uring_service::io_queue::perform_io(int result)
   if (!op_queue_.empty())
   {
     io_uring_service* service = io_object_->service_;
-    mutex::scoped_lock lock(service->mutex_);
-    if (::io_uring_sqe* sqe = service->get_sqe())
+    if (!service->submit_op(op_queue_.front(), this))
     {
-      op_queue_.front()->prepare(sqe);
-      ::io_uring_sqe_set_data(sqe, this);
-      service->post_submit_sqes_op(lock);
-    }
-    else
-    {
-      lock.unlock();
       while (io_uring_operation* op = op_queue_.front())
       {
         op->ec_ = asio::error::no_buffer_space;
@@ -908,6 +1281,43 @@ io_uring_service::io_object::io_object(bool locking, int spin_count)
 {
 }
 
+io_uring_service::thread_ring::thread_ring(bool locking)
+  : outstanding_work_(0),
+    pending_sqes_(0),
+    completion_mutex_(locking),
+    next_(0)
+{
+}
+
+::io_uring_sqe* io_uring_service::thread_ring::get_sqe()
+{
+  ::io_uring_sqe* sqe = ::io_uring_get_sqe(&ring_);
+  if (!sqe)
+  {
+    submit_sqes();
+    sqe = ::io_uring_get_sqe(&ring_);
+  }
+  if (sqe)
+  {
+    ::io_uring_sqe_set_data(sqe, 0);
+    ++pending_sqes_;
+  }
+  return sqe;
+}
+
+void io_uring_service::thread_ring::submit_sqes()
+{
+  if (pending_sqes_ != 0)
+  {
+    int result = ::io_uring_submit(&ring_);
+    if (result > 0)
+    {
+      pending_sqes_ -= result;
+      increment(outstanding_work_, result);
+    }
+  }
+}
+
 } // namespace detail
 } // namespace asio
 
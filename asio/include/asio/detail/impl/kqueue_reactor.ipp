@@ -30,6 +30,10 @@
 # include <sys/param.h>
 #endif
 
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+# include "asio/detail/allocation_accounting_service.hpp"
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+
 #include "asio/detail/push_options.hpp"
 
 #if defined(__NetBSD__) && __NetBSD_Version__ < 999001500
@@ -59,6 +63,9 @@ kqueue_reactor::kqueue_reactor(asio::execution_context& ctx)
     registered_descriptors_(
         config(ctx).get("reactor", "preallocated_io_objects", 0U),
         io_locking_, io_locking_spin_count_)
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+    , allocation_counters_(&get_allocation_counters(ctx))
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
 {
   struct kevent events[1];
   ASIO_KQUEUE_EV_SET(&events[0], interrupter_.read_descriptor(),
@@ -89,6 +96,10 @@ void kqueue_reactor::shutdown()
     for (int i = 0; i < max_ops; ++i)
       ops.push(state->op_queue_[i]);
     state->shutdown_ = true;
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+    allocation_counters_->record_deallocation(
+        allocation_counters::reactor, sizeof(descriptor_state));
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
     registered_descriptors_.free(state);
   }
 
@@ -569,12 +580,20 @@ int kqueue_reactor::do_kqueue_create()
 kqueue_reactor::descriptor_state* kqueue_reactor::allocate_descriptor_state()
 {
   mutex::scoped_lock descriptors_lock(registered_descriptors_mutex_);
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  allocation_counters_->record_allocation(
+      allocation_counters::reactor, sizeof(descriptor_state));
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
   return registered_descriptors_.alloc(io_locking_, io_locking_spin_count_);
 }
 
 void kqueue_reactor::free_descriptor_state(kqueue_reactor::descriptor_state* s)
 {
   mutex::scoped_lock descriptors_lock(registered_descriptors_mutex_);
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  allocation_counters_->record_deallocation(
+      allocation_counters::reactor, sizeof(descriptor_state));
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
   registered_descriptors_.free(s);
 }
 
@@ -30,6 +30,10 @@
 # include "asio/detail/reactor.hpp"
 #endif // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
 
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+# include "asio/detail/allocation_accounting_service.hpp"
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+
 #include "asio/detail/push_options.hpp"
 
 namespace asio {
@@ -124,6 +128,9 @@ scheduler::scheduler(asio::execution_context& ctx,
     task_usec_(config(ctx).get("scheduler", "task_usec", -1L)),
     wait_usec_(config(ctx).get("scheduler", "wait_usec", -1L)),
     thread_(0)
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+    , allocation_counters_(&get_allocation_counters(ctx))
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
 {
   ASIO_HANDLER_TRACKING_INIT;
 
@@ -199,6 +206,9 @@ std::size_t scheduler::run(asio::error_code& ec)
 
   thread_info this_thread;
   this_thread.private_outstanding_work = 0;
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  this_thread.set_allocation_counters(allocation_counters_);
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
   thread_call_stack::context ctx(this, this_thread);
 
   mutex::scoped_lock lock(mutex_);
@@ -221,6 +231,9 @@ std::size_t scheduler::run_one(asio::error_code& ec)
 
   thread_info this_thread;
   this_thread.private_outstanding_work = 0;
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  this_thread.set_allocation_counters(allocation_counters_);
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
   thread_call_stack::context ctx(this, this_thread);
 
   mutex::scoped_lock lock(mutex_);
@@ -239,6 +252,9 @@ std::size_t scheduler::wait_one(long usec, asio::error_code& ec)
 
   thread_info this_thread;
   this_thread.private_outstanding_work = 0;
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  this_thread.set_allocation_counters(allocation_counters_);
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
   thread_call_stack::context ctx(this, this_thread);
 
   mutex::scoped_lock lock(mutex_);
@@ -257,6 +273,9 @@ std::size_t scheduler::poll(asio::error_code& ec)
 
   thread_info this_thread;
   this_thread.private_outstanding_work = 0;
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  this_thread.set_allocation_counters(allocation_counters_);
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
   thread_call_stack::context ctx(this, this_thread);
 
   mutex::scoped_lock lock(mutex_);
@@ -288,6 +307,9 @@ std::size_t scheduler::poll_one(asio::error_code& ec)
 
   thread_info this_thread;
   this_thread.private_outstanding_work = 0;
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  this_thread.set_allocation_counters(allocation_counters_);
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
   thread_call_stack::context ctx(this, this_thread);
 
   mutex::scoped_lock lock(mutex_);
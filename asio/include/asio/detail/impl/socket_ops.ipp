@@ -45,6 +45,14 @@
 # include <malloc.h>
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1800)
 
+#if defined(ASIO_HAS_SENDFILE)
+# include <sys/sendfile.h>
+#endif // defined(ASIO_HAS_SENDFILE)
+
+#if defined(ASIO_HAS_SPLICE)
+# include <fcntl.h>
+#endif // defined(ASIO_HAS_SPLICE)
+
 #include "asio/detail/push_options.hpp"
 
 namespace asio {
@@ -98,19 +106,27 @@ inline void get_last_error(
 
 template <typename SockLenType>
 inline socket_type call_accept(SockLenType msghdr::*,
-    socket_type s, void* addr, std::size_t* addrlen)
+    socket_type s, void* addr, std::size_t* addrlen, bool non_blocking)
 {
   SockLenType tmp_addrlen = addrlen ? (SockLenType)*addrlen : 0;
+#if defined(ASIO_HAS_ACCEPT4)
+  socket_type result = ::accept4(s,
+      static_cast<socket_addr_type*>(addr),
+      addrlen ? &tmp_addrlen : 0,
+      SOCK_CLOEXEC | (non_blocking ? SOCK_NONBLOCK : 0));
+#else // defined(ASIO_HAS_ACCEPT4)
+  (void)non_blocking;
   socket_type result = ::accept(s,
       static_cast<socket_addr_type*>(addr),
       addrlen ? &tmp_addrlen : 0);
+#endif // defined(ASIO_HAS_ACCEPT4)
   if (addrlen)
     *addrlen = (std::size_t)tmp_addrlen;
   return result;
 }
 
-socket_type accept(socket_type s, void* addr,
-    std::size_t* addrlen, asio::error_code& ec)
+inline socket_type do_accept(socket_type s, void* addr,
+    std::size_t* addrlen, bool non_blocking, asio::error_code& ec)
 {
   if (s == invalid_socket)
   {
@@ -118,7 +134,8 @@ socket_type accept(socket_type s, void* addr,
     return invalid_socket;
   }
 
-  socket_type new_s = call_accept(&msghdr::msg_namelen, s, addr, addrlen);
+  socket_type new_s = call_accept(&msghdr::msg_namelen,
+      s, addr, addrlen, non_blocking);
   get_last_error(ec, new_s == invalid_socket);
   if (new_s == invalid_socket)
     return new_s;
@@ -139,6 +156,12 @@ socket_type accept(socket_type s, void* addr,
   return new_s;
 }
 
+socket_type accept(socket_type s, void* addr,
+    std::size_t* addrlen, asio::error_code& ec)
+{
+  return do_accept(s, addr, addrlen, false, ec);
+}
+
 socket_type sync_accept(socket_type s, state_type state,
     void* addr, std::size_t* addrlen, asio::error_code& ec)
 {
@@ -229,14 +252,14 @@ void complete_iocp_accept(socket_type s, void* output_buffer,
 
 #else // defined(ASIO_HAS_IOCP)
 
-bool non_blocking_accept(socket_type s,
-    state_type state, void* addr, std::size_t* addrlen,
+inline bool do_non_blocking_accept(socket_type s,
+    state_type state, void* addr, std::size_t* addrlen, bool non_blocking,
     asio::error_code& ec, socket_type& new_socket)
 {
   for (;;)
   {
     // Accept the waiting connection.
-    new_socket = socket_ops::accept(s, addr, addrlen, ec);
+    new_socket = do_accept(s, addr, addrlen, non_blocking, ec);
 
     // Check if operation succeeded.
     if (new_socket != invalid_socket)
@@ -273,6 +296,32 @@ bool non_blocking_accept(socket_type s,
   }
 }
 
+bool non_blocking_accept(socket_type s,
+    state_type state, void* addr, std::size_t* addrlen,
+    asio::error_code& ec, socket_type& new_socket)
+{
+  return do_non_blocking_accept(s, state,
+      addr, addrlen, false, ec, new_socket);
+}
+
+bool non_blocking_accept(socket_type s,
+    state_type state, void* addr, std::size_t* addrlen,
+    asio::error_code& ec, socket_type& new_socket,
+    state_type& new_state)
+{
+#if defined(ASIO_HAS_ACCEPT4)
+  // The new socket is created in non-blocking mode, avoiding the need for a
+  // separate system call when it is first used for an asynchronous operation.
+  new_state = internal_non_blocking;
+  return do_non_blocking_accept(s, state,
+      addr, addrlen, true, ec, new_socket);
+#else // defined(ASIO_HAS_ACCEPT4)
+  new_state = 0;
+  return do_non_blocking_accept(s, state,
+      addr, addrlen, false, ec, new_socket);
+#endif // defined(ASIO_HAS_ACCEPT4)
+}
+
 #endif // defined(ASIO_HAS_IOCP)
 
 template <typename SockLenType>
@@ -1656,6 +1705,267 @@ bool non_blocking_send1(socket_type s,
 
 #endif // defined(ASIO_HAS_IOCP)
 
+#if defined(ASIO_HAS_SENDFILE)
+
+signed_size_type sendfile(socket_type s, int fd,
+    uint64_t offset, size_t size, asio::error_code& ec)
+{
+  off_t off = static_cast<off_t>(offset);
+  signed_size_type result = ::sendfile(s, fd, &off, size);
+  get_last_error(ec, result < 0);
+  return result;
+}
+
+bool non_blocking_sendfile(socket_type s, int fd,
+    uint64_t offset, size_t size, asio::error_code& ec,
+    size_t& bytes_transferred)
+{
+  for (;;)
+  {
+    // Write some data.
+    signed_size_type bytes = socket_ops::sendfile(s, fd, offset, size, ec);
+
+    // Check if operation succeeded.
+    if (bytes >= 0)
+    {
+      bytes_transferred = bytes;
+      return true;
+    }
+
+    // Retry operation if interrupted by signal.
+    if (ec == asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again.
+    if (ec == asio::error::would_block
+        || ec == asio::error::try_again)
+      return false;
+
+    // Operation failed.
+    bytes_transferred = 0;
+    return true;
+  }
+}
+
+#endif // defined(ASIO_HAS_SENDFILE)
+
+#if defined(ASIO_HAS_SPLICE)
+
+signed_size_type splice(int in_fd, int out_fd,
+    size_t size, asio::error_code& ec)
+{
+  signed_size_type result = ::splice(in_fd, 0, out_fd, 0,
+      size, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+  get_last_error(ec, result < 0);
+  return result;
+}
+
+bool non_blocking_splice(int in_fd, int out_fd,
+    size_t size, asio::error_code& ec, size_t& bytes_transferred)
+{
+  for (;;)
+  {
+    // Move some data.
+    signed_size_type bytes = socket_ops::splice(in_fd, out_fd, size, ec);
+
+    // Check if operation succeeded.
+    if (bytes >= 0)
+    {
+      bytes_transferred = bytes;
+      return true;
+    }
+
+    // Retry operation if interrupted by signal.
+    if (ec == asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again.
+    if (ec == asio::error::would_block
+        || ec == asio::error::try_again)
+      return false;
+
+    // Operation failed.
+    bytes_transferred = 0;
+    return true;
+  }
+}
+
+#endif // defined(ASIO_HAS_SPLICE)
+
+#if defined(ASIO_HAS_MMSG)
+
+signed_size_type recvmmsg(socket_type s, mmsghdr* msgs,
+    size_t count, int flags, asio::error_code& ec)
+{
+  signed_size_type result = ::recvmmsg(s, msgs,
+      static_cast<unsigned int>(count), flags, 0);
+  get_last_error(ec, result < 0);
+  return result;
+}
+
+bool non_blocking_recvmmsg(socket_type s, mmsghdr* msgs,
+    size_t count, int flags, asio::error_code& ec,
+    size_t& messages_transferred)
+{
+  for (;;)
+  {
+    // Read some messages.
+    signed_size_type messages = socket_ops::recvmmsg(
+        s, msgs, count, flags, ec);
+
+    // Check if operation succeeded.
+    if (messages >= 0)
+    {
+      messages_transferred = messages;
+      return true;
+    }
+
+    // Retry operation if interrupted by signal.
+    if (ec == asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again.
+    if (ec == asio::error::would_block
+        || ec == asio::error::try_again)
+      return false;
+
+    // Operation failed.
+    messages_transferred = 0;
+    return true;
+  }
+}
+
+signed_size_type sendmmsg(socket_type s, mmsghdr* msgs,
+    size_t count, int flags, asio::error_code& ec)
+{
+#if defined(ASIO_HAS_MSG_NOSIGNAL)
+  flags |= MSG_NOSIGNAL;
+#endif // defined(ASIO_HAS_MSG_NOSIGNAL)
+  signed_size_type result = ::sendmmsg(s, msgs,
+      static_cast<unsigned int>(count), flags);
+  get_last_error(ec, result < 0);
+  return result;
+}
+
+bool non_blocking_sendmmsg(socket_type s, mmsghdr* msgs,
+    size_t count, int flags, asio::error_code& ec,
+    size_t& messages_transferred)
+{
+  for (;;)
+  {
+    // Write some messages.
+    signed_size_type messages = socket_ops::sendmmsg(
+        s, msgs, count, flags, ec);
+
+    // Check if operation succeeded.
+    if (messages >= 0)
+    {
+      messages_transferred = messages;
+      return true;
+    }
+
+    // Retry operation if interrupted by signal.
+    if (ec == asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again.
+    if (ec == asio::error::would_block
+        || ec == asio::error::try_again)
+      return false;
+
+    // Operation failed.
+    messages_transferred = 0;
+    return true;
+  }
+}
+
+#endif // defined(ASIO_HAS_MMSG)
+
+#if defined(ASIO_HAS_ANCILLARY_DATA)
+
+signed_size_type recvmsg(socket_type s,
+    msghdr* msg, int flags, asio::error_code& ec)
+{
+  signed_size_type result = ::recvmsg(s, msg, flags);
+  get_last_error(ec, result < 0);
+  return result;
+}
+
+bool non_blocking_recvmsg(socket_type s,
+    msghdr* msg, int flags, asio::error_code& ec,
+    size_t& bytes_transferred)
+{
+  for (;;)
+  {
+    // Read some data.
+    signed_size_type bytes = socket_ops::recvmsg(s, msg, flags, ec);
+
+    // Check if operation succeeded.
+    if (bytes >= 0)
+    {
+      bytes_transferred = bytes;
+      return true;
+    }
+
+    // Retry operation if interrupted by signal.
+    if (ec == asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again.
+    if (ec == asio::error::would_block
+        || ec == asio::error::try_again)
+      return false;
+
+    // Operation failed.
+    bytes_transferred = 0;
+    return true;
+  }
+}
+
+signed_size_type sendmsg(socket_type s,
+    const msghdr* msg, int flags, asio::error_code& ec)
+{
+#if defined(ASIO_HAS_MSG_NOSIGNAL)
+  flags |= MSG_NOSIGNAL;
+#endif // defined(ASIO_HAS_MSG_NOSIGNAL)
+  signed_size_type result = ::sendmsg(s, msg, flags);
+  get_last_error(ec, result < 0);
+  return result;
+}
+
+bool non_blocking_sendmsg(socket_type s,
+    const msghdr* msg, int flags, asio::error_code& ec,
+    size_t& bytes_transferred)
+{
+  for (;;)
+  {
+    // Write some data.
+    signed_size_type bytes = socket_ops::sendmsg(s, msg, flags, ec);
+
+    // Check if operation succeeded.
+    if (bytes >= 0)
+    {
+      bytes_transferred = bytes;
+      return true;
+    }
+
+    // Retry operation if interrupted by signal.
+    if (ec == asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again.
+    if (ec == asio::error::would_block
+        || ec == asio::error::try_again)
+      return false;
+
+    // Operation failed.
+    bytes_transferred = 0;
+    return true;
+  }
+}
+
+#endif // defined(ASIO_HAS_ANCILLARY_DATA)
+
 signed_size_type sendto(socket_type s, const buf* bufs,
     size_t count, int flags, const void* addr,
     std::size_t addrlen, asio::error_code& ec)
@@ -18,6 +18,10 @@
 #include "asio/detail/config.hpp"
 #include "asio/detail/strand_executor_service.hpp"
 
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+# include "asio/detail/allocation_accounting_service.hpp"
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+
 #include "asio/detail/push_options.hpp"
 
 namespace asio {
@@ -28,6 +32,9 @@ strand_executor_service::strand_executor_service(execution_context& ctx)
     mutex_(),
     salt_(0),
     impl_list_(0)
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+    , allocation_counters_(&get_allocation_counters(ctx))
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
 {
 }
 
@@ -76,6 +83,11 @@ strand_executor_service::create_implementation()
   impl_list_ = new_impl.get();
   new_impl->service_ = this;
 
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  allocation_counters_->record_allocation(
+      allocation_counters::strand, sizeof(strand_impl));
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+
   return new_impl;
 }
 
@@ -90,6 +102,11 @@ strand_executor_service::strand_impl::~strand_impl()
     prev_->next_ = next_;
   if (next_)
     next_->prev_= prev_;
+
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  service_->allocation_counters_->record_deallocation(
+      allocation_counters::strand, sizeof(strand_impl));
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
 }
 
 bool strand_executor_service::enqueue(const implementation_type& impl,
@@ -0,0 +1,177 @@
+//
+// detail/impl/thread_info_base.ipp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_IMPL_THREAD_INFO_BASE_IPP
+#define ASIO_DETAIL_IMPL_THREAD_INFO_BASE_IPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_THREADS)
+# include <atomic>
+#endif // defined(ASIO_HAS_THREADS)
+
+#include "asio/detail/thread_info_base.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+struct thread_info_base::depot
+{
+#if defined(ASIO_HAS_THREADS)
+  std::atomic<free_block*> head_[size_class_count];
+  std::atomic<std::size_t> count_[size_class_count];
+#else // defined(ASIO_HAS_THREADS)
+  free_block* head_[size_class_count];
+  std::size_t count_[size_class_count];
+#endif // defined(ASIO_HAS_THREADS)
+};
+
+thread_info_base::depot* thread_info_base::get_depot()
+{
+  // The depot is zero-initialised and trivially destructible, so that it
+  // remains usable by threads that return blocks during program shutdown.
+  static depot d;
+  return &d;
+}
+
+void thread_info_base::push_batches(int size_class,
+    free_block* first, free_block* last, std::size_t count)
+{
+  depot* d = get_depot();
+#if defined(ASIO_HAS_THREADS)
+  d->count_[size_class].fetch_add(count, std::memory_order_relaxed);
+  free_block* head = d->head_[size_class].load(std::memory_order_relaxed);
+  do
+    last->next_batch_ = head;
+  while (!d->head_[size_class].compare_exchange_weak(head, first,
+        std::memory_order_release, std::memory_order_relaxed));
+#else // defined(ASIO_HAS_THREADS)
+  d->count_[size_class] += count;
+  last->next_batch_ = d->head_[size_class];
+  d->head_[size_class] = first;
+#endif // defined(ASIO_HAS_THREADS)
+}
+
+thread_info_base::free_block* thread_info_base::take_batches(int size_class)
+{
+  depot* d = get_depot();
+#if defined(ASIO_HAS_THREADS)
+  if (!d->head_[size_class].load(std::memory_order_relaxed))
+    return 0;
+  return d->head_[size_class].exchange(0, std::memory_order_acquire);
+#else // defined(ASIO_HAS_THREADS)
+  free_block* head = d->head_[size_class];
+  d->head_[size_class] = 0;
+  return head;
+#endif // defined(ASIO_HAS_THREADS)
+}
+
+bool thread_info_base::refill_cache(int size_class)
+{
+  free_block* batch = take_batches(size_class);
+  if (!batch)
+    return false;
+
+  // Move whole batches into the cache while they fit. The cache is empty, so
+  // at least one batch always fits.
+  class_cache& cache = cache_[size_class];
+  std::size_t taken = 0;
+  while (batch)
+  {
+    std::size_t length = 0;
+    for (free_block* b = batch; b; b = b->next_)
+      ++length;
+    if (cache.count_ + length > cache_size)
+      break;
+
+    free_block* next_batch = batch->next_batch_;
+    for (free_block* b = batch; b; b = b->next_)
+      cache.blocks_[cache.count_++] = b;
+    taken += length;
+    batch = next_batch;
+  }
+
+  depot* d = get_depot();
+#if defined(ASIO_HAS_THREADS)
+  d->count_[size_class].fetch_sub(taken, std::memory_order_relaxed);
+#else // defined(ASIO_HAS_THREADS)
+  d->count_[size_class] -= taken;
+#endif // defined(ASIO_HAS_THREADS)
+
+  // Return the remaining batches to the depot.
+  if (batch)
+  {
+    free_block* last = batch;
+    while (last->next_batch_)
+      last = last->next_batch_;
+    push_batches(size_class, batch, last, 0);
+  }
+
+  ++statistics_.depot_refills;
+  return true;
+}
+
+void thread_info_base::flush_cache(int size_class, std::size_t count)
+{
+  class_cache& cache = cache_[size_class];
+
+  // The oldest blocks are at the bottom of the cache, and are the ones that
+  // are given up. If the depot is full they are freed.
+  depot* d = get_depot();
+#if defined(ASIO_HAS_THREADS)
+  std::size_t depot_count =
+    d->count_[size_class].load(std::memory_order_relaxed);
+#else // defined(ASIO_HAS_THREADS)
+  std::size_t depot_count = d->count_[size_class];
+#endif // defined(ASIO_HAS_THREADS)
+  if (depot_count + count <= ASIO_RECYCLING_ALLOCATOR_DEPOT_SIZE)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      free_block* b = static_cast<free_block*>(cache.blocks_[i]);
+      b->next_ = i + 1 < count
+        ? static_cast<free_block*>(cache.blocks_[i + 1]) : 0;
+    }
+    free_block* first = static_cast<free_block*>(cache.blocks_[0]);
+    push_batches(size_class, first, first, count);
+  }
+  else
+  {
+    for (std::size_t i = 0; i < count; ++i)
+      aligned_delete(cache.blocks_[i]);
+    statistics_.heap_deallocations += count;
+  }
+
+  for (std::size_t i = count; i < cache.count_; ++i)
+    cache.blocks_[i - count] = cache.blocks_[i];
+  cache.count_ -= count;
+
+  ++statistics_.depot_flushes;
+}
+
+void thread_info_base::release_cache()
+{
+  for (int size_class = 0; size_class < size_class_count; ++size_class)
+    if (cache_[size_class].count_ > 0)
+      flush_cache(size_class, cache_[size_class].count_);
+}
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_DETAIL_IMPL_THREAD_INFO_BASE_IPP
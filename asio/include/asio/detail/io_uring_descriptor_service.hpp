@@ -64,6 +64,9 @@ public:
     // Only this service will have access to the internal values.
     friend class io_uring_descriptor_service;
 
+    // The file service starts its own operations on the descriptor.
+    friend class io_uring_file_service;
+
     // The native descriptor representation.
     int descriptor_;
 
@@ -241,6 +244,9 @@ public:
     p.p = new (p.v) op(success_ec_, impl.descriptor_,
         poll_flags, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected() && op_type != -1)
     {
@@ -256,6 +262,26 @@ public:
     p.v = p.p = 0;
   }
 
+  // Determine whether an operation that waits for the given condition would
+  // be submitted immediately, so that its deadline can be enforced using a
+  // linked timeout.
+  bool linked_timeout_available(implementation_type& impl,
+      posix::descriptor_base::wait_type w)
+  {
+    switch (w)
+    {
+    case posix::descriptor_base::wait_read:
+      return io_uring_service_.is_op_queue_empty(
+          io_uring_service::read_op, impl.io_object_data_);
+    case posix::descriptor_base::wait_write:
+      return io_uring_service_.is_op_queue_empty(
+          io_uring_service::write_op, impl.io_object_data_);
+    default:
+      return io_uring_service_.is_op_queue_empty(
+          io_uring_service::except_op, impl.io_object_data_);
+    }
+  }
+
   // Write some data to the descriptor.
   template <typename ConstBufferSequence>
   size_t write_some(implementation_type& impl,
@@ -315,6 +341,9 @@ public:
     p.p = new (p.v) op(success_ec_, impl.descriptor_,
         impl.state_, buffers, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
     {
@@ -349,6 +378,9 @@ public:
       op::ptr::allocate(handler), 0 };
     p.p = new (p.v) op(success_ec_, impl.descriptor_, POLLOUT, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
     {
@@ -420,6 +452,9 @@ public:
     p.p = new (p.v) op(success_ec_, impl.descriptor_,
         impl.state_, offset, buffers, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
     {
@@ -505,6 +540,9 @@ public:
     p.p = new (p.v) op(success_ec_, impl.descriptor_,
         impl.state_, buffers, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
     {
@@ -539,6 +577,9 @@ public:
       op::ptr::allocate(handler), 0 };
     p.p = new (p.v) op(success_ec_, impl.descriptor_, POLLIN, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
     {
@@ -607,6 +648,9 @@ public:
     p.p = new (p.v) op(success_ec_, impl.descriptor_,
         impl.state_, offset, buffers, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
     {
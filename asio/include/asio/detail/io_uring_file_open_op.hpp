@@ -0,0 +1,153 @@
+//
+// detail/io_uring_file_open_op.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_IO_URING_FILE_OPEN_OP_HPP
+#define ASIO_DETAIL_IO_URING_FILE_OPEN_OP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_IO_URING)
+
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/fenced_block.hpp"
+#include "asio/detail/handler_alloc_helpers.hpp"
+#include "asio/detail/handler_work.hpp"
+#include "asio/detail/io_uring_operation.hpp"
+#include "asio/detail/io_uring_service.hpp"
+#include "asio/detail/memory.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+// Opens a file using IORING_OP_OPENAT. The file is not yet associated with an
+// I/O object, so the operation is started on a temporary one that it owns.
+template <typename Service, typename Handler, typename IoExecutor>
+class io_uring_file_open_op : public io_uring_operation
+{
+public:
+  ASIO_DEFINE_HANDLER_PTR(io_uring_file_open_op);
+
+  typedef typename Service::implementation_type implementation_type;
+
+  io_uring_file_open_op(const asio::error_code& success_ec,
+      Service& service, implementation_type& impl, const char* path,
+      int flags, Handler& handler, const IoExecutor& io_ex)
+    : io_uring_operation(success_ec,
+        &io_uring_file_open_op::do_prepare,
+        &io_uring_file_open_op::do_perform,
+        &io_uring_file_open_op::do_complete),
+      io_object_data_(0),
+      handler_(static_cast<Handler&&>(handler)),
+      work_(handler_, io_ex),
+      service_(service),
+      impl_(impl),
+      path_(path),
+      flags_(flags),
+      descriptor_(-1)
+  {
+  }
+
+  // The temporary I/O object on which the operation is started.
+  io_uring_service::per_io_object_data io_object_data_;
+
+  static void do_prepare(io_uring_operation* base, ::io_uring_sqe* sqe)
+  {
+    ASIO_ASSUME(base != 0);
+    io_uring_file_open_op* o(static_cast<io_uring_file_open_op*>(base));
+
+    ::io_uring_prep_openat(sqe, AT_FDCWD, o->path_.c_str(), o->flags_, 0777);
+  }
+
+  static bool do_perform(io_uring_operation* base, bool after_completion)
+  {
+    ASIO_ASSUME(base != 0);
+    io_uring_file_open_op* o(static_cast<io_uring_file_open_op*>(base));
+
+    if (after_completion && !o->ec_)
+      o->descriptor_ = static_cast<int>(o->bytes_transferred_);
+    return after_completion;
+  }
+
+  static void do_complete(void* owner, operation* base,
+      const asio::error_code& /*ec*/,
+      std::size_t /*bytes_transferred*/)
+  {
+    // Take ownership of the handler object.
+    ASIO_ASSUME(base != 0);
+    io_uring_file_open_op* o(static_cast<io_uring_file_open_op*>(base));
+    ptr p = { asio::detail::addressof(o->handler_), o, o };
+
+    ASIO_HANDLER_COMPLETION((*o));
+
+    // Transfer ownership of the new descriptor to the file, or discard it if
+    // the context is being shut down.
+    if (owner)
+    {
+      o->service_.complete_async_open(o->impl_,
+          o->io_object_data_, o->descriptor_, o->ec_);
+    }
+    else if (o->descriptor_ != -1)
+      ::close(o->descriptor_);
+
+    // Take ownership of the operation's outstanding work.
+    handler_work<Handler, IoExecutor> w(
+        static_cast<handler_work<Handler, IoExecutor>&&>(
+          o->work_));
+
+    ASIO_ERROR_LOCATION(o->ec_);
+
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the upcall is made. Even if we're not about to make an upcall, a
+    // sub-object of the handler may be the true owner of the memory associated
+    // with the handler. Consequently, a local copy of the handler is required
+    // to ensure that any owning sub-object remains valid until after we have
+    // deallocated the memory here.
+    detail::binder1<Handler, asio::error_code>
+      handler(o->handler_, o->ec_);
+    p.h = asio::detail::addressof(handler.handler_);
+    p.reset();
+
+    // Make the upcall if required.
+    if (owner)
+    {
+      fenced_block b(fenced_block::half);
+      ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_));
+      w.complete(handler, handler.handler_);
+      ASIO_HANDLER_INVOCATION_END;
+    }
+  }
+
+private:
+  Handler handler_;
+  handler_work<Handler, IoExecutor> work_;
+  Service& service_;
+  implementation_type& impl_;
+  std::string path_;
+  int flags_;
+  int descriptor_;
+};
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_IO_URING)
+
+#endif // ASIO_DETAIL_IO_URING_FILE_OPEN_OP_HPP
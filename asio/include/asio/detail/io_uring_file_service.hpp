@@ -21,15 +21,40 @@
   && defined(ASIO_HAS_IO_URING)
 
 #include <string>
+#include "asio/associated_cancellation_slot.hpp"
+#include "asio/cancellation_type.hpp"
+#include "asio/detail/blocking_op_service.hpp"
 #include "asio/detail/cstdint.hpp"
 #include "asio/detail/descriptor_ops.hpp"
+#include "asio/detail/handler_cont_helpers.hpp"
 #include "asio/detail/io_uring_descriptor_service.hpp"
+#include "asio/detail/io_uring_file_open_op.hpp"
+#include "asio/detail/io_uring_file_resize_op.hpp"
+#include "asio/detail/io_uring_file_size_op.hpp"
+#include "asio/detail/io_uring_file_sync_op.hpp"
+#include "asio/detail/io_uring_service.hpp"
+#include "asio/detail/memory.hpp"
 #include "asio/error.hpp"
 #include "asio/execution_context.hpp"
 #include "asio/file_base.hpp"
 
 #include "asio/detail/push_options.hpp"
 
+// IORING_OP_FTRUNCATE is available from liburing 2.6. Older versions resize
+// files using a blocking call on the blocking_op_service's threads.
+#if !defined(ASIO_HAS_IO_URING_FTRUNCATE)
+# if !defined(ASIO_DISABLE_IO_URING_FTRUNCATE)
+#  if defined(IO_URING_VERSION_MAJOR)
+#   if (IO_URING_VERSION_MAJOR > 2) \
+  || ((IO_URING_VERSION_MAJOR == 2) && (IO_URING_VERSION_MINOR >= 6))
+#    define ASIO_HAS_IO_URING_FTRUNCATE 1
+#   endif // (IO_URING_VERSION_MAJOR > 2)
+          //   || ((IO_URING_VERSION_MAJOR == 2)
+          //     && (IO_URING_VERSION_MINOR >= 6))
+#  endif // defined(IO_URING_VERSION_MAJOR)
+# endif // !defined(ASIO_DISABLE_IO_URING_FTRUNCATE)
+#endif // !defined(ASIO_HAS_IO_URING_FTRUNCATE)
+
 namespace asio {
 namespace detail {
 
@@ -94,6 +119,61 @@ public:
       const char* path, file_base::flags open_flags,
       asio::error_code& ec);
 
+  // Start an asynchronous open. The implementation must not be used for any
+  // other operation until the open completes.
+  template <typename Handler, typename IoExecutor>
+  void async_open(implementation_type& impl,
+      const char* path, file_base::flags open_flags,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_file_open_op<io_uring_file_service,
+        Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, *this, impl, path,
+        static_cast<int>(open_flags), handler, io_ex);
+
+    ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
+          "file", &impl, -1, "async_open"));
+
+    if (is_open(impl))
+    {
+      p.p->ec_ = asio::error::already_open;
+      io_uring_service_.post_immediate_completion(p.p, is_continuation);
+      p.v = p.p = 0;
+      return;
+    }
+
+    // The file has no I/O object until it is open, so the operation is
+    // started on one of its own.
+    io_uring_service_.register_io_object(p.p->io_object_data_);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(&io_uring_service_,
+            &p.p->io_object_data_, io_uring_service::read_op);
+    }
+
+    io_uring_service_.start_op(io_uring_service::read_op,
+        p.p->io_object_data_, p.p, is_continuation);
+    p.v = p.p = 0;
+  }
+
+  // Complete an asynchronous open by taking ownership of the new descriptor
+  // and releasing the operation's temporary I/O object.
+  ASIO_DECL void complete_async_open(implementation_type& impl,
+      io_uring_service::per_io_object_data& io_object_data,
+      int descriptor, asio::error_code& ec);
+
   // Assign a native descriptor to a file implementation.
   asio::error_code assign(implementation_type& impl,
       const native_handle_type& native_descriptor,
@@ -145,18 +225,86 @@ public:
   ASIO_DECL uint64_t size(const implementation_type& impl,
       asio::error_code& ec) const;
 
+  // Start an asynchronous operation to get the size of the file.
+  template <typename Handler, typename IoExecutor>
+  void async_size(implementation_type& impl,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    typedef io_uring_file_size_op<Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, native_handle(impl), handler, io_ex);
+
+    start_file_op(impl, io_uring_service::except_op,
+        p.p, handler, "async_size");
+    p.v = p.p = 0;
+  }
+
   // Alter the size of the file.
   ASIO_DECL asio::error_code resize(implementation_type& impl,
       uint64_t n, asio::error_code& ec);
 
+  // Start an asynchronous operation to alter the size of the file.
+  template <typename Handler, typename IoExecutor>
+  void async_resize(implementation_type& impl, uint64_t n,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+#if defined(ASIO_HAS_IO_URING_FTRUNCATE)
+    typedef io_uring_file_resize_op<Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, native_handle(impl), n, handler, io_ex);
+
+    start_file_op(impl, io_uring_service::write_op,
+        p.p, handler, "async_resize");
+    p.v = p.p = 0;
+#else // defined(ASIO_HAS_IO_URING_FTRUNCATE)
+    // The blocking fallback is not queued behind outstanding writes.
+    use_service<blocking_op_service>(io_uring_service_.context())
+      .template async_call<false>(
+          resize_function(native_handle(impl), n), handler, io_ex);
+#endif // defined(ASIO_HAS_IO_URING_FTRUNCATE)
+  }
+
   // Synchronise the file to disk.
   ASIO_DECL asio::error_code sync_all(implementation_type& impl,
       asio::error_code& ec);
 
+  // Start an asynchronous operation to synchronise the file to disk.
+  template <typename Handler, typename IoExecutor>
+  void async_sync_all(implementation_type& impl,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    typedef io_uring_file_sync_op<Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, native_handle(impl), 0, handler, io_ex);
+
+    start_file_op(impl, io_uring_service::write_op,
+        p.p, handler, "async_sync_all");
+    p.v = p.p = 0;
+  }
+
   // Synchronise the file data to disk.
   ASIO_DECL asio::error_code sync_data(implementation_type& impl,
       asio::error_code& ec);
 
+  // Start an asynchronous operation to synchronise the file data to disk.
+  template <typename Handler, typename IoExecutor>
+  void async_sync_data(implementation_type& impl,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    typedef io_uring_file_sync_op<Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, native_handle(impl),
+        IORING_FSYNC_DATASYNC, handler, io_ex);
+
+    start_file_op(impl, io_uring_service::write_op,
+        p.p, handler, "async_sync_data");
+    p.v = p.p = 0;
+  }
+
   // Seek to a position in the file.
   ASIO_DECL uint64_t seek(implementation_type& impl, int64_t offset,
       file_base::seek_basis whence, asio::error_code& ec);
@@ -188,6 +336,14 @@ public:
     return descriptor_service_.write_some_at(impl, offset, buffers, ec);
   }
 
+  // Determine whether a write would be submitted immediately, so that its
+  // deadline can be enforced using a linked timeout.
+  bool write_linked_timeout_available(implementation_type& impl)
+  {
+    return descriptor_service_.linked_timeout_available(
+        impl, posix::descriptor_base::wait_write);
+  }
+
   // Start an asynchronous write at the specified location. The data being
   // written must be valid for the lifetime of the asynchronous operation.
   template <typename ConstBufferSequence, typename Handler, typename IoExecutor>
@@ -226,6 +382,14 @@ public:
     return descriptor_service_.read_some_at(impl, offset, buffers, ec);
   }
 
+  // Determine whether a read would be submitted immediately, so that its
+  // deadline can be enforced using a linked timeout.
+  bool read_linked_timeout_available(implementation_type& impl)
+  {
+    return descriptor_service_.linked_timeout_available(
+        impl, posix::descriptor_base::wait_read);
+  }
+
   // Start an asynchronous read. The buffer for the data being read must be
   // valid for the lifetime of the asynchronous operation.
   template <typename MutableBufferSequence,
@@ -239,6 +403,94 @@ public:
   }
 
 private:
+  // Take ownership of a newly opened descriptor.
+  ASIO_DECL asio::error_code assign_opened(implementation_type& impl,
+      int descriptor, asio::error_code& ec);
+
+  // Start a file operation on the file's I/O object. Operations that alter
+  // the file are queued behind any outstanding writes.
+  template <typename Handler>
+  void start_file_op(implementation_type& impl, int op_type,
+      io_uring_operation* op, Handler& handler, const char* name)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      op->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(
+            &io_uring_service_, &impl.io_object_data_, op_type);
+    }
+
+    ASIO_HANDLER_CREATION((io_uring_service_.context(), *op,
+          "file", &impl, native_handle(impl), name));
+    (void)name;
+
+    io_uring_service_.start_op(op_type,
+        impl.io_object_data_, op, is_continuation);
+  }
+
+#if !defined(ASIO_HAS_IO_URING_FTRUNCATE)
+  // Function object used to resize a file on a blocking_op_service thread.
+  class resize_function
+  {
+  public:
+    resize_function(int descriptor, uint64_t n)
+      : descriptor_(descriptor),
+        n_(n)
+    {
+    }
+
+    uint64_t operator()(asio::error_code& ec)
+    {
+      int result = ::ftruncate(descriptor_, n_);
+      descriptor_ops::get_last_error(ec, result != 0);
+      return 0;
+    }
+
+  private:
+    int descriptor_;
+    uint64_t n_;
+  };
+#endif // !defined(ASIO_HAS_IO_URING_FTRUNCATE)
+
+  // Helper class used to implement per-operation cancellation
+  class io_uring_op_cancellation
+  {
+  public:
+    io_uring_op_cancellation(io_uring_service* s,
+        io_uring_service::per_io_object_data* p, int o)
+      : io_uring_service_(s),
+        io_object_data_(p),
+        op_type_(o)
+    {
+    }
+
+    void operator()(cancellation_type_t type)
+    {
+      if (!!(type &
+            (cancellation_type::terminal
+              | cancellation_type::partial
+              | cancellation_type::total)))
+      {
+        io_uring_service_->cancel_ops_by_key(*io_object_data_, op_type_, this);
+      }
+    }
+
+  private:
+    io_uring_service* io_uring_service_;
+    io_uring_service::per_io_object_data* io_object_data_;
+    int op_type_;
+  };
+
+  // The io_uring_service used to start file operations.
+  io_uring_service& io_uring_service_;
+
   // The implementation used for initiating asynchronous operations.
   descriptor_service descriptor_service_;
 
@@ -20,7 +20,10 @@
 #if defined(ASIO_HAS_IO_URING)
 
 #include <liburing.h>
+#include <time.h>
+#include "asio/detail/chrono.hpp"
 #include "asio/detail/cstdint.hpp"
+#include "asio/detail/linked_timeout_handler.hpp"
 #include "asio/detail/operation.hpp"
 
 #include "asio/detail/push_options.hpp"
@@ -41,6 +44,13 @@ public:
   // The operation key used for targeted cancellation.
   void* cancellation_key_;
 
+  // The absolute deadline, on CLOCK_MONOTONIC, of the linked timeout that is
+  // submitted alongside the operation. Only valid if has_link_timeout_ is set.
+  __kernel_timespec link_timeout_;
+
+  // Whether the operation is submitted with a linked timeout.
+  bool has_link_timeout_;
+
   // Prepare the operation.
   void prepare(::io_uring_sqe* sqe)
   {
@@ -53,6 +63,34 @@ public:
     return perform_func_(this, after_completion);
   }
 
+  // Arm a linked timeout if the handler carries a deadline.
+  template <typename Handler>
+  void arm_link_timeout(const Handler& handler)
+  {
+    if (const chrono::steady_clock::time_point* deadline
+        = get_linked_timeout_deadline(handler))
+    {
+      int64_t ns = chrono::duration_cast<chrono::nanoseconds>(
+          deadline->time_since_epoch()).count();
+      link_timeout_.tv_sec = ns / 1000000000;
+      link_timeout_.tv_nsec = ns % 1000000000;
+      has_link_timeout_ = true;
+    }
+  }
+
+  // Determine whether the operation's linked timeout has expired. Used to
+  // distinguish a timeout from other causes of ECANCELED.
+  bool link_timeout_expired() const
+  {
+    if (!has_link_timeout_)
+      return false;
+    ::timespec now;
+    ::clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec > link_timeout_.tv_sec
+      || (now.tv_sec == link_timeout_.tv_sec
+        && now.tv_nsec >= link_timeout_.tv_nsec);
+  }
+
 protected:
   typedef void (*prepare_func_type)(io_uring_operation*, ::io_uring_sqe*);
   typedef bool (*perform_func_type)(io_uring_operation*, bool);
@@ -64,6 +102,8 @@ protected:
       ec_(success_ec),
       bytes_transferred_(0),
       cancellation_key_(0),
+      link_timeout_(),
+      has_link_timeout_(false),
       prepare_func_(prepare_func),
       perform_func_(perform_func)
   {
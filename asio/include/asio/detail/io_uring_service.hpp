@@ -20,6 +20,7 @@
 #if defined(ASIO_HAS_IO_URING)
 
 #include <liburing.h>
+#include "asio/detail/allocation_counters.hpp"
 #include "asio/detail/atomic_count.hpp"
 #include "asio/detail/buffer_sequence_adapter.hpp"
 #include "asio/detail/conditionally_enabled_mutex.hpp"
@@ -27,8 +28,10 @@
 #include "asio/detail/limits.hpp"
 #include "asio/detail/object_pool.hpp"
 #include "asio/detail/op_queue.hpp"
+#include "asio/detail/posix_tss_ptr.hpp"
 #include "asio/detail/reactor.hpp"
 #include "asio/detail/scheduler_task.hpp"
+#include "asio/detail/scoped_ptr.hpp"
 #include "asio/detail/timer_queue_base.hpp"
 #include "asio/detail/timer_queue_set.hpp"
 #include "asio/detail/wait_op.hpp"
@@ -36,6 +39,22 @@
 
 #include "asio/detail/push_options.hpp"
 
+// Per-thread rings rely on IORING_OP_MSG_RING and on synchronous cancellation
+// of requests on another thread's ring, both of which require liburing 2.3.
+// Kernel support for both is checked at runtime.
+#if !defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+# if !defined(ASIO_DISABLE_IO_URING_THREAD_RINGS)
+#  if defined(ASIO_HAS_PTHREADS) && defined(IO_URING_VERSION_MAJOR)
+#   if (IO_URING_VERSION_MAJOR > 2) \
+  || ((IO_URING_VERSION_MAJOR == 2) && (IO_URING_VERSION_MINOR >= 3))
+#    define ASIO_HAS_IO_URING_THREAD_RINGS 1
+#   endif // (IO_URING_VERSION_MAJOR > 2)
+          //   || ((IO_URING_VERSION_MAJOR == 2)
+          //     && (IO_URING_VERSION_MINOR >= 3))
+#  endif // defined(ASIO_HAS_PTHREADS) && defined(IO_URING_VERSION_MAJOR)
+# endif // !defined(ASIO_DISABLE_IO_URING_THREAD_RINGS)
+#endif // !defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+
 namespace asio {
 namespace detail {
 
@@ -51,6 +70,7 @@ public:
   enum op_types { read_op = 0, write_op = 1, except_op = 2, max_ops = 3 };
 
   class io_object;
+  class thread_ring;
 
   // An I/O queue stores operations that must run serially.
   class io_queue : operation
@@ -61,6 +81,10 @@ public:
     op_queue<io_uring_operation> op_queue_;
     bool cancel_requested_;
 
+    // The per-thread ring to which the operation at the head of the queue was
+    // submitted, or 0 if it was submitted to the shared ring.
+    thread_ring* ring_;
+
     ASIO_DECL io_queue();
     void set_result(int r) { task_result_ = static_cast<unsigned>(r); }
     ASIO_DECL operation* perform_io(int result);
@@ -88,6 +112,26 @@ public:
   // Per I/O object data.
   typedef io_object* per_io_object_data;
 
+  // A ring owned by a single thread that runs the io_context. Submission queue
+  // entries are only ever prepared and submitted by the owning thread, so no
+  // locking is required to start an operation. The completion queue may be
+  // drained by whichever thread runs the task, and is protected by a mutex of
+  // its own.
+  class thread_ring
+  {
+    friend class io_uring_service;
+
+    ::io_uring ring_;
+    atomic_count outstanding_work_;
+    int pending_sqes_;
+    mutex completion_mutex_;
+    thread_ring* next_;
+
+    ASIO_DECL thread_ring(bool locking);
+    ASIO_DECL ::io_uring_sqe* get_sqe();
+    ASIO_DECL void submit_sqes();
+  };
+
   // Constructor.
   ASIO_DECL io_uring_service(asio::execution_context& ctx);
 
@@ -125,6 +169,10 @@ public:
   ASIO_DECL void start_op(int op_type, per_io_object_data& io_obj,
       io_uring_operation* op, bool is_continuation);
 
+  // Determine whether a new operation would be submitted to the io_uring
+  // immediately, rather than waiting behind other operations in its queue.
+  ASIO_DECL bool is_op_queue_empty(int op_type, per_io_object_data& io_obj);
+
   // Cancel all operations associated with the given I/O object. The handlers
   // associated with the I/O object will be invoked with the operation_aborted
   // error.
@@ -196,6 +244,9 @@ private:
   // The number of operations to complete in a batch.
   enum { complete_batch_size = 128 };
 
+  // The hint to pass to io_uring_queue_init to size a per-thread ring.
+  enum { thread_ring_size = 4096 };
+
   // The type used for processing eventfd readiness notifications.
   class event_fd_read_op;
 
@@ -232,6 +283,62 @@ private:
   // Get a new submission queue entry, flushing the queue if necessary.
   ASIO_DECL ::io_uring_sqe* get_sqe();
 
+  // Prepare the submission queue entries for an operation at the head of its
+  // I/O queue, including its linked timeout if it has one. Returns false if no
+  // submission queue entry is available.
+  template <typename Ring>
+  static bool prepare_op_sqes(Ring& r, io_uring_operation* op, io_queue* io_q);
+
+  // Prepare and submit an operation at the head of its I/O queue, using the
+  // calling thread's ring if it has one. Returns false if no submission queue
+  // entry is available.
+  ASIO_DECL bool submit_op(io_uring_operation* op, io_queue* io_q);
+
+  // Request cancellation of the operation at the head of the given queue on
+  // the ring to which it was submitted. Must be called with mutex_ held.
+  // Returns false if cancellation could not be requested.
+  ASIO_DECL bool prepare_cancel(io_queue* io_q);
+
+  // Determine whether the kernel supports the operations used by per-thread
+  // rings. Must be called after the shared ring has been initialised.
+  ASIO_DECL bool thread_rings_supported();
+
+  // Get the calling thread's ring, or 0 if it does not have one.
+  ASIO_DECL thread_ring* this_thread_ring();
+
+  // Get the calling thread's ring, creating it if required. Returns 0 if
+  // per-thread rings are disabled or the thread is not running the io_context.
+  ASIO_DECL thread_ring* get_thread_ring();
+
+  // Create and initialise a new per-thread ring.
+  ASIO_DECL thread_ring* create_thread_ring();
+
+  // Ask the shared ring to watch a per-thread ring for completions. Must be
+  // called with mutex_ held.
+  ASIO_DECL void watch_thread_ring(thread_ring* r);
+
+  // Drain the completion queue of a per-thread ring.
+  ASIO_DECL void reap_thread_ring(thread_ring* r, op_queue<operation>& ops);
+
+  // Wait for all outstanding operations on the per-thread rings to complete,
+  // collecting the I/O queues of those that completed if required.
+  ASIO_DECL void drain_thread_rings(op_queue<operation>* ops);
+
+  // User data values used on the shared ring to identify per-thread rings have
+  // the low bit set, to distinguish them from I/O queues.
+  static void* thread_ring_tag(thread_ring* r)
+  {
+    return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(r) | 1);
+  }
+
+  static thread_ring* thread_ring_from_tag(void* ptr)
+  {
+    uintptr_t value = reinterpret_cast<uintptr_t>(ptr);
+    if ((value & 1) == 0)
+      return 0;
+    return reinterpret_cast<thread_ring*>(value & ~uintptr_t(1));
+  }
+
   // Submit pending submission queue entries.
   ASIO_DECL void submit_sqes();
 
@@ -296,6 +403,11 @@ private:
   // Keep track of all registered I/O objects.
   object_pool<io_object> registered_io_objects_;
 
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  // The counters charged for the memory used by registered I/O objects.
+  allocation_counters* allocation_counters_;
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+
   // Helper class to do post-perform_io cleanup.
   struct perform_io_cleanup_on_block_exit;
   friend struct perform_io_cleanup_on_block_exit;
@@ -308,6 +420,18 @@ private:
 
   // The eventfd descriptor used to wait for readiness.
   int event_fd_;
+
+  // Whether operations started on threads that run the io_context are
+  // submitted to per-thread rings.
+  bool thread_rings_enabled_;
+
+  // All per-thread rings created by the service. Protected by mutex_.
+  thread_ring* thread_rings_;
+
+#if defined(ASIO_HAS_IO_URING_THREAD_RINGS)
+  // The calling thread's ring. Only allocated if per-thread rings are enabled.
+  scoped_ptr<posix_tss_ptr<thread_ring> > this_thread_ring_;
+#endif // defined(ASIO_HAS_IO_URING_THREAD_RINGS)
 };
 
 } // namespace detail
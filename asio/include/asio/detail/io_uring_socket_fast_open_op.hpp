@@ -0,0 +1,205 @@
+//
+// detail/io_uring_socket_fast_open_op.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_IO_URING_SOCKET_FAST_OPEN_OP_HPP
+#define ASIO_DETAIL_IO_URING_SOCKET_FAST_OPEN_OP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_IO_URING) && defined(ASIO_HAS_TCP_FASTOPEN)
+
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/buffer_sequence_adapter.hpp"
+#include "asio/detail/socket_ops.hpp"
+#include "asio/detail/fenced_block.hpp"
+#include "asio/detail/handler_work.hpp"
+#include "asio/detail/io_uring_operation.hpp"
+#include "asio/detail/memory.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+template <typename ConstBufferSequence, typename Endpoint>
+class io_uring_socket_fast_open_op_base : public io_uring_operation
+{
+public:
+  io_uring_socket_fast_open_op_base(const asio::error_code& success_ec,
+      socket_type socket, const Endpoint& peer_endpoint,
+      const ConstBufferSequence& buffers, func_type complete_func)
+    : io_uring_operation(success_ec,
+        &io_uring_socket_fast_open_op_base::do_prepare,
+        &io_uring_socket_fast_open_op_base::do_perform, complete_func),
+      socket_(socket),
+      peer_endpoint_(peer_endpoint),
+      buffers_(buffers),
+      state_(fast_open),
+      bufs_(buffers),
+      msghdr_()
+  {
+    msghdr_.msg_iov = bufs_.buffers();
+    msghdr_.msg_iovlen = static_cast<int>(bufs_.count());
+    msghdr_.msg_name = static_cast<sockaddr*>(
+        static_cast<void*>(peer_endpoint_.data()));
+    msghdr_.msg_namelen = peer_endpoint_.size();
+  }
+
+  static void do_prepare(io_uring_operation* base, ::io_uring_sqe* sqe)
+  {
+    ASIO_ASSUME(base != 0);
+    io_uring_socket_fast_open_op_base* o(
+        static_cast<io_uring_socket_fast_open_op_base*>(base));
+
+    switch (o->state_)
+    {
+    case fast_open:
+      ::io_uring_prep_sendmsg(sqe, o->socket_,
+          &o->msghdr_, ASIO_OS_DEF(MSG_FASTOPEN));
+      break;
+    case connecting:
+      ::io_uring_prep_connect(sqe, o->socket_,
+          static_cast<sockaddr*>(o->peer_endpoint_.data()),
+          static_cast<socklen_t>(o->peer_endpoint_.size()));
+      break;
+    default:
+      o->msghdr_.msg_name = 0;
+      o->msghdr_.msg_namelen = 0;
+      ::io_uring_prep_sendmsg(sqe, o->socket_, &o->msghdr_, 0);
+      break;
+    }
+  }
+
+  static bool do_perform(io_uring_operation* base, bool after_completion)
+  {
+    ASIO_ASSUME(base != 0);
+    io_uring_socket_fast_open_op_base* o(
+        static_cast<io_uring_socket_fast_open_op_base*>(base));
+
+    if (!after_completion)
+      return false;
+
+    switch (o->state_)
+    {
+    case fast_open:
+      if (o->ec_ == asio::error::in_progress)
+      {
+        // The SYN has been sent without data. Send the data normally once
+        // the connection has been established.
+        o->ec_ = asio::error_code();
+        o->state_ = sending;
+        return false;
+      }
+      else if (o->ec_ == asio::error::operation_not_supported)
+      {
+        // Fast Open is disabled, so fall back to a regular connect.
+        o->ec_ = asio::error_code();
+        o->state_ = connecting;
+        return false;
+      }
+      return true;
+    case connecting:
+      if (o->ec_)
+        return true;
+      o->state_ = sending;
+      return false;
+    default:
+      return true;
+    }
+  }
+
+private:
+  enum state_type { fast_open, connecting, sending };
+
+  socket_type socket_;
+  Endpoint peer_endpoint_;
+  ConstBufferSequence buffers_;
+  state_type state_;
+  buffer_sequence_adapter<asio::const_buffer, ConstBufferSequence> bufs_;
+  msghdr msghdr_;
+};
+
+template <typename ConstBufferSequence, typename Endpoint,
+    typename Handler, typename IoExecutor>
+class io_uring_socket_fast_open_op
+  : public io_uring_socket_fast_open_op_base<ConstBufferSequence, Endpoint>
+{
+public:
+  ASIO_DEFINE_HANDLER_PTR(io_uring_socket_fast_open_op);
+
+  io_uring_socket_fast_open_op(const asio::error_code& success_ec,
+      int socket, const Endpoint& peer_endpoint,
+      const ConstBufferSequence& buffers,
+      Handler& handler, const IoExecutor& io_ex)
+    : io_uring_socket_fast_open_op_base<ConstBufferSequence, Endpoint>(
+        success_ec, socket, peer_endpoint, buffers,
+        &io_uring_socket_fast_open_op::do_complete),
+      handler_(static_cast<Handler&&>(handler)),
+      work_(handler_, io_ex)
+  {
+  }
+
+  static void do_complete(void* owner, operation* base,
+      const asio::error_code& /*ec*/,
+      std::size_t /*bytes_transferred*/)
+  {
+    // Take ownership of the handler object.
+    ASIO_ASSUME(base != 0);
+    io_uring_socket_fast_open_op* o
+      (static_cast<io_uring_socket_fast_open_op*>(base));
+    ptr p = { asio::detail::addressof(o->handler_), o, o };
+
+    ASIO_HANDLER_COMPLETION((*o));
+
+    // Take ownership of the operation's outstanding work.
+    handler_work<Handler, IoExecutor> w(
+        static_cast<handler_work<Handler, IoExecutor>&&>(
+          o->work_));
+
+    ASIO_ERROR_LOCATION(o->ec_);
+
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the upcall is made. Even if we're not about to make an upcall, a
+    // sub-object of the handler may be the true owner of the memory associated
+    // with the handler. Consequently, a local copy of the handler is required
+    // to ensure that any owning sub-object remains valid until after we have
+    // deallocated the memory here.
+    detail::binder2<Handler, asio::error_code, std::size_t>
+      handler(o->handler_, o->ec_, o->bytes_transferred_);
+    p.h = asio::detail::addressof(handler.handler_);
+    p.reset();
+
+    // Make the upcall if required.
+    if (owner)
+    {
+      fenced_block b(fenced_block::half);
+      ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_, handler.arg2_));
+      w.complete(handler, handler.handler_);
+      ASIO_HANDLER_INVOCATION_END;
+    }
+  }
+
+private:
+  Handler handler_;
+  handler_work<Handler, IoExecutor> work_;
+};
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_IO_URING) && defined(ASIO_HAS_TCP_FASTOPEN)
+
+#endif // ASIO_DETAIL_IO_URING_SOCKET_FAST_OPEN_OP_HPP
@@ -0,0 +1,236 @@
+//
+// detail/io_uring_socket_sendfile_op.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_IO_URING_SOCKET_SENDFILE_OP_HPP
+#define ASIO_DETAIL_IO_URING_SOCKET_SENDFILE_OP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_IO_URING) && defined(ASIO_HAS_SENDFILE)
+
+#include <fcntl.h>
+#include <unistd.h>
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/cstdint.hpp"
+#include "asio/detail/fenced_block.hpp"
+#include "asio/detail/handler_work.hpp"
+#include "asio/detail/io_uring_operation.hpp"
+#include "asio/detail/memory.hpp"
+#include "asio/detail/socket_ops.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+// Sends file data to a socket by splicing it through a pipe. The data is moved
+// one pipe's worth at a time, reusing the same pipe, until the requested length
+// has been sent, the end of the file is reached, or an error occurs.
+class io_uring_socket_sendfile_op_base : public io_uring_operation
+{
+public:
+  io_uring_socket_sendfile_op_base(const asio::error_code& success_ec,
+      socket_type socket, int fd, uint64_t offset, std::size_t length,
+      func_type complete_func)
+    : io_uring_operation(success_ec,
+        &io_uring_socket_sendfile_op_base::do_prepare,
+        &io_uring_socket_sendfile_op_base::do_perform, complete_func),
+      socket_(socket),
+      fd_(fd),
+      offset_(offset),
+      length_(length),
+      phase_(fill_phase),
+      pipe_bytes_(0),
+      total_bytes_(0)
+  {
+    pipe_[0] = pipe_[1] = -1;
+    if (length_ > 0 && ::pipe2(pipe_, O_CLOEXEC) != 0)
+      ec_ = asio::error_code(errno, asio::error::get_system_category());
+  }
+
+  ~io_uring_socket_sendfile_op_base()
+  {
+    if (pipe_[0] != -1)
+      ::close(pipe_[0]);
+    if (pipe_[1] != -1)
+      ::close(pipe_[1]);
+  }
+
+  static void do_prepare(io_uring_operation* base, ::io_uring_sqe* sqe)
+  {
+    ASIO_ASSUME(base != 0);
+    io_uring_socket_sendfile_op_base* o(
+        static_cast<io_uring_socket_sendfile_op_base*>(base));
+
+    switch (o->phase_)
+    {
+    case fill_phase:
+      ::io_uring_prep_splice(sqe, o->fd_, static_cast<int64_t>(o->offset_),
+          o->pipe_[1], -1, static_cast<unsigned int>(
+            o->length_ < std::size_t(max_chunk_size)
+              ? o->length_ : std::size_t(max_chunk_size)),
+          SPLICE_F_MOVE);
+      break;
+    case drain_phase:
+      ::io_uring_prep_splice(sqe, o->pipe_[0], -1, o->socket_, -1,
+          static_cast<unsigned int>(o->pipe_bytes_), SPLICE_F_MOVE);
+      break;
+    default:
+      ::io_uring_prep_poll_add(sqe, o->socket_, POLLOUT);
+      break;
+    }
+  }
+
+  static bool do_perform(io_uring_operation* base, bool after_completion)
+  {
+    ASIO_ASSUME(base != 0);
+    io_uring_socket_sendfile_op_base* o(
+        static_cast<io_uring_socket_sendfile_op_base*>(base));
+
+    // Complete immediately if the pipe could not be created.
+    if (!after_completion)
+      return !!o->ec_;
+
+    switch (o->phase_)
+    {
+    case fill_phase:
+      // A zero-length result means that the end of the file was reached.
+      if (o->ec_ || o->bytes_transferred_ == 0)
+        break;
+      o->pipe_bytes_ = o->bytes_transferred_;
+      o->offset_ += o->bytes_transferred_;
+      o->length_ -= o->bytes_transferred_;
+      o->phase_ = drain_phase;
+      return false;
+    case drain_phase:
+      if (o->ec_ == asio::error::would_block
+          || o->ec_ == asio::error::try_again)
+      {
+        // The socket is in non-blocking mode, so wait for it to be writable.
+        o->phase_ = wait_phase;
+        return false;
+      }
+      if (o->ec_)
+        break;
+      o->pipe_bytes_ -= o->bytes_transferred_;
+      o->total_bytes_ += o->bytes_transferred_;
+      if (o->bytes_transferred_ == 0)
+        break;
+      if (o->pipe_bytes_ > 0)
+        return false;
+      if (o->length_ > 0)
+      {
+        // The pipe is empty, so refill it with the next chunk of the file.
+        o->phase_ = fill_phase;
+        return false;
+      }
+      break;
+    default:
+      if (o->ec_)
+        break;
+      o->phase_ = drain_phase;
+      return false;
+    }
+
+    o->bytes_transferred_ = o->total_bytes_;
+    return true;
+  }
+
+private:
+  // The maximum number of bytes moved through the pipe at a time. This is the
+  // default capacity of a pipe.
+  enum { max_chunk_size = 65536 };
+
+  enum phase_type { fill_phase, drain_phase, wait_phase };
+
+  socket_type socket_;
+  int fd_;
+  uint64_t offset_;
+  std::size_t length_;
+  phase_type phase_;
+  int pipe_[2];
+  std::size_t pipe_bytes_;
+  std::size_t total_bytes_;
+};
+
+template <typename Handler, typename IoExecutor>
+class io_uring_socket_sendfile_op
+  : public io_uring_socket_sendfile_op_base
+{
+public:
+  ASIO_DEFINE_HANDLER_PTR(io_uring_socket_sendfile_op);
+
+  io_uring_socket_sendfile_op(const asio::error_code& success_ec,
+      int socket, int fd, uint64_t offset, std::size_t length,
+      Handler& handler, const IoExecutor& io_ex)
+    : io_uring_socket_sendfile_op_base(success_ec, socket,
+        fd, offset, length, &io_uring_socket_sendfile_op::do_complete),
+      handler_(static_cast<Handler&&>(handler)),
+      work_(handler_, io_ex)
+  {
+  }
+
+  static void do_complete(void* owner, operation* base,
+      const asio::error_code& /*ec*/,
+      std::size_t /*bytes_transferred*/)
+  {
+    // Take ownership of the handler object.
+    ASIO_ASSUME(base != 0);
+    io_uring_socket_sendfile_op* o
+      (static_cast<io_uring_socket_sendfile_op*>(base));
+    ptr p = { asio::detail::addressof(o->handler_), o, o };
+
+    ASIO_HANDLER_COMPLETION((*o));
+
+    // Take ownership of the operation's outstanding work.
+    handler_work<Handler, IoExecutor> w(
+        static_cast<handler_work<Handler, IoExecutor>&&>(
+          o->work_));
+
+    ASIO_ERROR_LOCATION(o->ec_);
+
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the upcall is made. Even if we're not about to make an upcall, a
+    // sub-object of the handler may be the true owner of the memory associated
+    // with the handler. Consequently, a local copy of the handler is required
+    // to ensure that any owning sub-object remains valid until after we have
+    // deallocated the memory here.
+    detail::binder2<Handler, asio::error_code, std::size_t>
+      handler(o->handler_, o->ec_, o->bytes_transferred_);
+    p.h = asio::detail::addressof(handler.handler_);
+    p.reset();
+
+    // Make the upcall if required.
+    if (owner)
+    {
+      fenced_block b(fenced_block::half);
+      ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_, handler.arg2_));
+      w.complete(handler, handler.handler_);
+      ASIO_HANDLER_INVOCATION_END;
+    }
+  }
+
+private:
+  Handler handler_;
+  handler_work<Handler, IoExecutor> work_;
+};
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_IO_URING) && defined(ASIO_HAS_SENDFILE)
+
+#endif // ASIO_DETAIL_IO_URING_SOCKET_SENDFILE_OP_HPP
@@ -0,0 +1,182 @@
+//
+// detail/io_uring_socket_sendmmsg_op.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_IO_URING_SOCKET_SENDMMSG_OP_HPP
+#define ASIO_DETAIL_IO_URING_SOCKET_SENDMMSG_OP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_IO_URING) && defined(ASIO_HAS_MMSG)
+
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/datagram_message_adapter.hpp"
+#include "asio/detail/fenced_block.hpp"
+#include "asio/detail/handler_work.hpp"
+#include "asio/detail/io_uring_operation.hpp"
+#include "asio/detail/memory.hpp"
+#include "asio/detail/socket_ops.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+template <typename Message>
+class io_uring_socket_sendmmsg_op_base : public io_uring_operation
+{
+public:
+  io_uring_socket_sendmmsg_op_base(const asio::error_code& success_ec,
+      socket_type socket, Message* messages, std::size_t count,
+      void* storage, socket_base::message_flags flags,
+      func_type complete_func)
+    : io_uring_operation(success_ec,
+        &io_uring_socket_sendmmsg_op_base::do_prepare,
+        &io_uring_socket_sendmmsg_op_base::do_perform, complete_func),
+      socket_(socket),
+      flags_(flags),
+      msgs_(messages, count, storage, false)
+  {
+  }
+
+  static void do_prepare(io_uring_operation* base, ::io_uring_sqe* sqe)
+  {
+    ASIO_ASSUME(base != 0);
+    io_uring_socket_sendmmsg_op_base* o(
+        static_cast<io_uring_socket_sendmmsg_op_base*>(base));
+
+    // There is no io_uring equivalent of sendmmsg(), so wait for readiness
+    // and then perform the batch as a non-blocking system call.
+    ::io_uring_prep_poll_add(sqe, o->socket_, POLLOUT);
+  }
+
+  static bool do_perform(io_uring_operation* base, bool after_completion)
+  {
+    ASIO_ASSUME(base != 0);
+    io_uring_socket_sendmmsg_op_base* o(
+        static_cast<io_uring_socket_sendmmsg_op_base*>(base));
+
+    if (!o->msgs_.valid())
+    {
+      o->ec_ = asio::error::invalid_argument;
+      return true;
+    }
+
+    if (after_completion && o->ec_)
+      return true;
+
+    if (!socket_ops::non_blocking_sendmmsg(o->socket_,
+          o->msgs_.headers(), o->msgs_.count(), o->flags_ | MSG_DONTWAIT,
+          o->ec_, o->bytes_transferred_))
+      return false;
+
+    if (!o->ec_)
+      o->msgs_.complete_send(o->bytes_transferred_);
+
+    return true;
+  }
+
+protected:
+  // Deallocate the storage for the messages. This must be done before the
+  // handler is moved.
+  template <typename Handler>
+  void deallocate_messages(Handler& handler)
+  {
+    msgs_.deallocate(handler);
+  }
+
+private:
+  socket_type socket_;
+  socket_base::message_flags flags_;
+  datagram_message_adapter<Message> msgs_;
+};
+
+template <typename Message, typename Handler, typename IoExecutor>
+class io_uring_socket_sendmmsg_op
+  : public io_uring_socket_sendmmsg_op_base<Message>
+{
+public:
+  ASIO_DEFINE_HANDLER_PTR(io_uring_socket_sendmmsg_op);
+
+  io_uring_socket_sendmmsg_op(const asio::error_code& success_ec,
+      socket_type socket, Message* messages, std::size_t count,
+      socket_base::message_flags flags, Handler& handler,
+      const IoExecutor& io_ex)
+    : io_uring_socket_sendmmsg_op_base<Message>(success_ec, socket, messages,
+        count, datagram_message_adapter<Message>::template
+          storage<Handler>::allocate(handler, count),
+        flags, &io_uring_socket_sendmmsg_op::do_complete),
+      handler_(static_cast<Handler&&>(handler)),
+      work_(handler_, io_ex)
+  {
+  }
+
+  ~io_uring_socket_sendmmsg_op()
+  {
+    this->deallocate_messages(handler_);
+  }
+
+  static void do_complete(void* owner, operation* base,
+      const asio::error_code& /*ec*/,
+      std::size_t /*bytes_transferred*/)
+  {
+    // Take ownership of the handler object.
+    ASIO_ASSUME(base != 0);
+    io_uring_socket_sendmmsg_op* o
+      (static_cast<io_uring_socket_sendmmsg_op*>(base));
+    ptr p = { asio::detail::addressof(o->handler_), o, o };
+    o->deallocate_messages(o->handler_);
+
+    ASIO_HANDLER_COMPLETION((*o));
+
+    // Take ownership of the operation's outstanding work.
+    handler_work<Handler, IoExecutor> w(
+        static_cast<handler_work<Handler, IoExecutor>&&>(
+          o->work_));
+
+    ASIO_ERROR_LOCATION(o->ec_);
+
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the upcall is made. Even if we're not about to make an upcall, a
+    // sub-object of the handler may be the true owner of the memory associated
+    // with the handler. Consequently, a local copy of the handler is required
+    // to ensure that any owning sub-object remains valid until after we have
+    // deallocated the memory here.
+    detail::binder2<Handler, asio::error_code, std::size_t>
+      handler(o->handler_, o->ec_, o->bytes_transferred_);
+    p.h = asio::detail::addressof(handler.handler_);
+    p.reset();
+
+    // Make the upcall if required.
+    if (owner)
+    {
+      fenced_block b(fenced_block::half);
+      ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_, handler.arg2_));
+      w.complete(handler, handler.handler_);
+      ASIO_HANDLER_INVOCATION_END;
+    }
+  }
+
+private:
+  Handler handler_;
+  handler_work<Handler, IoExecutor> work_;
+};
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_IO_URING) && defined(ASIO_HAS_MMSG)
+
+#endif // ASIO_DETAIL_IO_URING_SOCKET_SENDMMSG_OP_HPP
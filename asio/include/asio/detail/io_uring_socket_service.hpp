@@ -28,8 +28,10 @@
 #include "asio/detail/noncopyable.hpp"
 #include "asio/detail/io_uring_null_buffers_op.hpp"
 #include "asio/detail/io_uring_service.hpp"
+#include "asio/detail/io_uring_socket_accept_batch_op.hpp"
 #include "asio/detail/io_uring_socket_accept_op.hpp"
 #include "asio/detail/io_uring_socket_connect_op.hpp"
+#include "asio/detail/io_uring_socket_fast_open_op.hpp"
 #include "asio/detail/io_uring_socket_recvfrom_op.hpp"
 #include "asio/detail/io_uring_socket_sendto_op.hpp"
 #include "asio/detail/io_uring_socket_service_base.hpp"
@@ -141,6 +143,21 @@ public:
     return ec;
   }
 
+  // Assign a newly accepted native socket to a socket implementation, adding
+  // the state flags that describe how the native socket was created.
+  asio::error_code assign_accepted(implementation_type& impl,
+      const protocol_type& protocol, const native_handle_type& native_socket,
+      socket_ops::state_type state, asio::error_code& ec)
+  {
+    if (!do_assign(impl, protocol.type(), native_socket, ec))
+    {
+      impl.protocol_ = protocol;
+      impl.state_ |= state;
+    }
+    ASIO_ERROR_LOCATION(ec);
+    return ec;
+  }
+
   // Get the native socket representation.
   native_handle_type native_handle(implementation_type& impl)
   {
@@ -286,6 +303,9 @@ public:
     p.p = new (p.v) op(success_ec_, impl.socket_, impl.state_,
         buffers, destination, flags, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
     {
@@ -319,6 +339,9 @@ public:
       op::ptr::allocate(handler), 0 };
     p.p = new (p.v) op(success_ec_, impl.socket_, POLLOUT, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
     {
@@ -409,6 +432,9 @@ public:
     p.p = new (p.v) op(success_ec_, impl.socket_, impl.state_,
         buffers, sender_endpoint, flags, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
     {
@@ -455,6 +481,9 @@ public:
       op::ptr::allocate(handler), 0 };
     p.p = new (p.v) op(success_ec_, impl.socket_, poll_flags, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
     {
@@ -524,6 +553,9 @@ public:
     p.p = new (p.v) op(success_ec_, impl.socket_, impl.state_,
         peer, impl.protocol_, peer_endpoint, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected() && !peer.is_open())
     {
@@ -539,6 +571,67 @@ public:
     p.v = p.p = 0;
   }
 
+  // Start an asynchronous accept of up to count connections. The peers array
+  // must be valid until the accept's handler is invoked.
+  template <typename Socket, typename Handler, typename IoExecutor>
+  void async_accept_batch(implementation_type& impl, Socket* peers,
+      std::size_t count, Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_socket_accept_batch_op<
+        Socket, Protocol, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+
+    // The operation drains pending connections after each readiness
+    // notification, so the listening socket must be in non-blocking mode.
+    asio::error_code ec;
+    if (impl.socket_ != invalid_socket
+        && !(impl.state_ & socket_ops::internal_non_blocking))
+    {
+      socket_ops::set_internal_non_blocking(
+          impl.socket_, impl.state_, true, ec);
+    }
+
+    p.p = new (p.v) op(success_ec_, impl.socket_, impl.state_,
+        peers, count, impl.protocol_, handler, io_ex);
+
+    ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
+          "socket", &impl, impl.socket_, "async_accept_batch"));
+
+    if (ec)
+    {
+      p.p->ec_ = ec;
+      io_uring_service_.post_immediate_completion(p.p, is_continuation);
+      p.v = p.p = 0;
+      return;
+    }
+
+    bool peers_open = false;
+    for (std::size_t i = 0; i < count && !peers_open; ++i)
+      peers_open = peers[i].is_open();
+
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected() && !peers_open)
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(&io_uring_service_,
+            &impl.io_object_data_, io_uring_service::read_op);
+    }
+
+    start_accept_op(impl, p.p, is_continuation, peers_open);
+    p.v = p.p = 0;
+  }
+
   // Start an asynchronous accept. The peer_endpoint object must be valid until
   // the accept's handler is invoked.
   template <typename PeerIoExecutor, typename Handler, typename IoExecutor>
@@ -560,6 +653,9 @@ public:
     p.p = new (p.v) op(success_ec_, peer_io_ex, impl.socket_,
         impl.state_, impl.protocol_, peer_endpoint, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
     {
@@ -603,6 +699,50 @@ public:
     p.p = new (p.v) op(success_ec_, impl.socket_,
         peer_endpoint, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(&io_uring_service_,
+            &impl.io_object_data_, io_uring_service::write_op);
+    }
+
+    ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
+          "socket", &impl, impl.socket_, "async_connect"));
+
+    start_op(impl, io_uring_service::write_op, p.p, is_continuation, false);
+    p.v = p.p = 0;
+  }
+
+#if defined(ASIO_HAS_TCP_FASTOPEN)
+  // Start an asynchronous connect that carries initial data, using TCP Fast
+  // Open to send the data in the SYN where possible.
+  template <typename ConstBufferSequence, typename Handler, typename IoExecutor>
+  void async_connect(implementation_type& impl,
+      const endpoint_type& peer_endpoint,
+      const ConstBufferSequence& initial_data,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_socket_fast_open_op<ConstBufferSequence,
+        endpoint_type, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_,
+        peer_endpoint, initial_data, handler, io_ex);
+
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
     {
@@ -617,6 +757,7 @@ public:
     start_op(impl, io_uring_service::write_op, p.p, is_continuation, false);
     p.v = p.p = 0;
   }
+#endif // defined(ASIO_HAS_TCP_FASTOPEN)
 };
 
 } // namespace detail
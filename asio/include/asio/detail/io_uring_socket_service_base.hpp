@@ -30,8 +30,14 @@
 #include "asio/detail/io_uring_null_buffers_op.hpp"
 #include "asio/detail/io_uring_service.hpp"
 #include "asio/detail/io_uring_socket_recv_op.hpp"
+#include "asio/detail/io_uring_socket_recvcmsg_op.hpp"
+#include "asio/detail/io_uring_socket_recvmmsg_op.hpp"
 #include "asio/detail/io_uring_socket_recvmsg_op.hpp"
 #include "asio/detail/io_uring_socket_send_op.hpp"
+#include "asio/detail/io_uring_socket_sendcmsg_op.hpp"
+#include "asio/detail/io_uring_socket_sendfile_op.hpp"
+#include "asio/detail/io_uring_socket_sendmmsg_op.hpp"
+#include "asio/detail/io_uring_socket_splice_op.hpp"
 #include "asio/detail/io_uring_wait_op.hpp"
 #include "asio/detail/socket_holder.hpp"
 #include "asio/detail/socket_ops.hpp"
@@ -231,6 +237,9 @@ public:
     p.p = new (p.v) op(success_ec_, impl.socket_,
         poll_flags, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
           "socket", &impl, impl.socket_, "async_wait"));
 
@@ -246,6 +255,29 @@ public:
     p.v = p.p = 0;
   }
 
+  // Determine whether an operation that waits for the given condition would
+  // be submitted immediately, so that its deadline can be enforced using a
+  // linked timeout. Out-of-band receives wait for an exceptional condition,
+  // so both queues are checked for a read.
+  bool linked_timeout_available(base_implementation_type& impl,
+      socket_base::wait_type w)
+  {
+    switch (w)
+    {
+    case socket_base::wait_read:
+      return io_uring_service_.is_op_queue_empty(
+          io_uring_service::read_op, impl.io_object_data_)
+        && io_uring_service_.is_op_queue_empty(
+          io_uring_service::except_op, impl.io_object_data_);
+    case socket_base::wait_write:
+      return io_uring_service_.is_op_queue_empty(
+          io_uring_service::write_op, impl.io_object_data_);
+    default:
+      return io_uring_service_.is_op_queue_empty(
+          io_uring_service::except_op, impl.io_object_data_);
+    }
+  }
+
   // Send the given data to the peer.
   template <typename ConstBufferSequence>
   size_t send(base_implementation_type& impl,
@@ -300,6 +332,9 @@ public:
     p.p = new (p.v) op(success_ec_, impl.socket_,
         impl.state_, buffers, flags, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
     {
@@ -335,6 +370,9 @@ public:
       op::ptr::allocate(handler), 0 };
     p.p = new (p.v) op(success_ec_, impl.socket_, POLLOUT, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
     {
@@ -350,6 +388,302 @@ public:
     p.v = p.p = 0;
   }
 
+#if defined(ASIO_HAS_SENDFILE)
+  // Start an asynchronous send of data from a file. The file must remain open
+  // for the lifetime of the asynchronous operation.
+  template <typename Handler, typename IoExecutor>
+  void async_send_file(base_implementation_type& impl, int fd,
+      uint64_t offset, std::size_t length,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_socket_sendfile_op<Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_,
+        fd, offset, length, handler, io_ex);
+
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(&io_uring_service_,
+            &impl.io_object_data_, io_uring_service::write_op);
+    }
+
+    ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
+          "socket", &impl, impl.socket_, "async_send_file"));
+
+    start_op(impl, io_uring_service::write_op,
+        p.p, is_continuation, length == 0);
+    p.v = p.p = 0;
+  }
+#endif // defined(ASIO_HAS_SENDFILE)
+
+#if defined(ASIO_HAS_SPLICE)
+  // Start an asynchronous operation to move data from the socket into a
+  // pipe. The pipe must remain open for the lifetime of the asynchronous
+  // operation.
+  template <typename Handler, typename IoExecutor>
+  void async_splice_to_pipe(base_implementation_type& impl, int pipe_fd,
+      std::size_t max_size, Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_socket_splice_op<Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_, impl.state_,
+        impl.socket_, pipe_fd, max_size, handler, io_ex);
+
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(&io_uring_service_,
+            &impl.io_object_data_, io_uring_service::read_op);
+    }
+
+    ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
+          "socket", &impl, impl.socket_, "async_splice_to_pipe"));
+
+    start_op(impl, io_uring_service::read_op,
+        p.p, is_continuation, max_size == 0);
+    p.v = p.p = 0;
+  }
+
+  // Start an asynchronous operation to move data from a pipe to the socket.
+  // The pipe must remain open for the lifetime of the asynchronous operation.
+  template <typename Handler, typename IoExecutor>
+  void async_splice_from_pipe(base_implementation_type& impl, int pipe_fd,
+      std::size_t max_size, Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_socket_splice_op<Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_, impl.state_,
+        pipe_fd, impl.socket_, max_size, handler, io_ex);
+
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(&io_uring_service_,
+            &impl.io_object_data_, io_uring_service::write_op);
+    }
+
+    ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
+          "socket", &impl, impl.socket_, "async_splice_from_pipe"));
+
+    start_op(impl, io_uring_service::write_op,
+        p.p, is_continuation, max_size == 0);
+    p.v = p.p = 0;
+  }
+#endif // defined(ASIO_HAS_SPLICE)
+
+#if defined(ASIO_HAS_MMSG)
+  // Start an asynchronous send of a batch of datagrams. The messages and
+  // their buffers must be valid for the lifetime of the asynchronous
+  // operation.
+  template <typename Message, typename Handler, typename IoExecutor>
+  void async_send_batch(base_implementation_type& impl,
+      Message* messages, std::size_t count,
+      socket_base::message_flags flags,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_socket_sendmmsg_op<Message, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_,
+        messages, count, flags, handler, io_ex);
+
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(&io_uring_service_,
+            &impl.io_object_data_, io_uring_service::write_op);
+    }
+
+    ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
+          "socket", &impl, impl.socket_, "async_send_batch"));
+
+    start_op(impl, io_uring_service::write_op,
+        p.p, is_continuation, count == 0);
+    p.v = p.p = 0;
+  }
+
+  // Start an asynchronous receive of a batch of datagrams. The messages
+  // and their buffers must be valid for the lifetime of the asynchronous
+  // operation.
+  template <typename Message, typename Handler, typename IoExecutor>
+  void async_receive_batch(base_implementation_type& impl,
+      Message* messages, std::size_t count,
+      socket_base::message_flags flags,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_socket_recvmmsg_op<Message, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_,
+        messages, count, flags, handler, io_ex);
+
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(&io_uring_service_,
+            &impl.io_object_data_, io_uring_service::read_op);
+    }
+
+    ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
+          "socket", &impl, impl.socket_, "async_receive_batch"));
+
+    start_op(impl, io_uring_service::read_op,
+        p.p, is_continuation, count == 0);
+    p.v = p.p = 0;
+  }
+#endif // defined(ASIO_HAS_MMSG)
+
+#if defined(ASIO_HAS_ANCILLARY_DATA)
+  // Start an asynchronous send with ancillary data. The buffers, and the
+  // storage referenced by the control buffer, must be valid for the lifetime
+  // of the asynchronous operation. A null destination sends to the connected
+  // peer.
+  template <typename ConstBufferSequence, typename Endpoint,
+      typename Handler, typename IoExecutor>
+  void async_send_msg(base_implementation_type& impl,
+      const ConstBufferSequence& buffers, const Endpoint* destination,
+      const control_buffer& control, socket_base::message_flags flags,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_socket_sendcmsg_op<ConstBufferSequence,
+        Endpoint, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_, impl.state_, buffers,
+        destination, control, flags, handler, io_ex);
+
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(&io_uring_service_,
+            &impl.io_object_data_, io_uring_service::write_op);
+    }
+
+    ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
+          "socket", &impl, impl.socket_, "async_send_msg"));
+
+    start_op(impl, io_uring_service::write_op, p.p, is_continuation, false);
+    p.v = p.p = 0;
+  }
+
+  // Start an asynchronous receive with ancillary data. The buffers, the
+  // sender endpoint, the control buffer and the storage it references must
+  // be valid for the lifetime of the asynchronous operation. The sender may
+  // be null if the source address is not required.
+  template <typename MutableBufferSequence, typename Endpoint,
+      typename Handler, typename IoExecutor>
+  void async_receive_msg(base_implementation_type& impl,
+      const MutableBufferSequence& buffers, Endpoint* sender,
+      control_buffer& control, socket_base::message_flags in_flags,
+      socket_base::message_flags& out_flags, Handler& handler,
+      const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    int op_type = (in_flags & socket_base::message_out_of_band)
+      ? io_uring_service::except_op : io_uring_service::read_op;
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_socket_recvcmsg_op<MutableBufferSequence,
+        Endpoint, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_, impl.state_, buffers,
+        sender, control, in_flags, out_flags, handler, io_ex);
+
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(
+            &io_uring_service_, &impl.io_object_data_, op_type);
+    }
+
+    ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
+          "socket", &impl, impl.socket_, "async_receive_msg"));
+
+    start_op(impl, op_type, p.p, is_continuation, false);
+    p.v = p.p = 0;
+  }
+#endif // defined(ASIO_HAS_ANCILLARY_DATA)
+
   // Receive some data from the peer. Returns the number of bytes received.
   template <typename MutableBufferSequence>
   size_t receive(base_implementation_type& impl,
@@ -408,6 +742,9 @@ public:
     p.p = new (p.v) op(success_ec_, impl.socket_,
         impl.state_, buffers, flags, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
     {
@@ -457,6 +794,9 @@ public:
       op::ptr::allocate(handler), 0 };
     p.p = new (p.v) op(success_ec_, impl.socket_, poll_flags, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
     {
@@ -528,6 +868,9 @@ public:
     p.p = new (p.v) op(success_ec_, impl.socket_, impl.state_,
         buffers, in_flags, out_flags, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
     {
@@ -575,6 +918,9 @@ public:
       op::ptr::allocate(handler), 0 };
     p.p = new (p.v) op(success_ec_, impl.socket_, poll_flags, handler, io_ex);
 
+    // Optionally enforce a deadline using a linked timeout.
+    p.p->arm_link_timeout(handler);
+
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
     {
@@ -0,0 +1,173 @@
+//
+// detail/io_uring_socket_splice_op.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_IO_URING_SOCKET_SPLICE_OP_HPP
+#define ASIO_DETAIL_IO_URING_SOCKET_SPLICE_OP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_IO_URING) && defined(ASIO_HAS_SPLICE)
+
+#include <fcntl.h>
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/fenced_block.hpp"
+#include "asio/detail/handler_work.hpp"
+#include "asio/detail/io_uring_operation.hpp"
+#include "asio/detail/memory.hpp"
+#include "asio/detail/socket_ops.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+class io_uring_socket_splice_op_base : public io_uring_operation
+{
+public:
+  io_uring_socket_splice_op_base(const asio::error_code& success_ec,
+      socket_type socket, socket_ops::state_type state, int in_fd,
+      int out_fd, std::size_t max_size, func_type complete_func)
+    : io_uring_operation(success_ec,
+        &io_uring_socket_splice_op_base::do_prepare,
+        &io_uring_socket_splice_op_base::do_perform, complete_func),
+      socket_(socket),
+      state_(state),
+      in_fd_(in_fd),
+      out_fd_(out_fd),
+      max_size_(max_size < std::size_t(max_splice_size)
+          ? max_size : std::size_t(max_splice_size))
+  {
+  }
+
+  static void do_prepare(io_uring_operation* base, ::io_uring_sqe* sqe)
+  {
+    ASIO_ASSUME(base != 0);
+    io_uring_socket_splice_op_base* o(
+        static_cast<io_uring_socket_splice_op_base*>(base));
+
+    if ((o->state_ & socket_ops::internal_non_blocking) != 0)
+    {
+      ::io_uring_prep_poll_add(sqe, o->socket_,
+          o->in_fd_ == o->socket_ ? POLLIN : POLLOUT);
+    }
+    else
+    {
+      ::io_uring_prep_splice(sqe, o->in_fd_, -1, o->out_fd_, -1,
+          static_cast<unsigned int>(o->max_size_), SPLICE_F_MOVE);
+    }
+  }
+
+  static bool do_perform(io_uring_operation* base, bool after_completion)
+  {
+    ASIO_ASSUME(base != 0);
+    io_uring_socket_splice_op_base* o(
+        static_cast<io_uring_socket_splice_op_base*>(base));
+
+    if ((o->state_ & socket_ops::internal_non_blocking) != 0)
+    {
+      return socket_ops::non_blocking_splice(o->in_fd_,
+          o->out_fd_, o->max_size_, o->ec_, o->bytes_transferred_);
+    }
+
+    if (o->ec_ && (o->ec_ == asio::error::would_block
+          || o->ec_ == asio::error::try_again))
+    {
+      o->state_ |= socket_ops::internal_non_blocking;
+      return false;
+    }
+
+    return after_completion;
+  }
+
+private:
+  // The largest number of bytes that may be moved by a single splice.
+  enum { max_splice_size = 0x7FFFF000 };
+
+  socket_type socket_;
+  socket_ops::state_type state_;
+  int in_fd_;
+  int out_fd_;
+  std::size_t max_size_;
+};
+
+template <typename Handler, typename IoExecutor>
+class io_uring_socket_splice_op
+  : public io_uring_socket_splice_op_base
+{
+public:
+  ASIO_DEFINE_HANDLER_PTR(io_uring_socket_splice_op);
+
+  io_uring_socket_splice_op(const asio::error_code& success_ec,
+      int socket, socket_ops::state_type state, int in_fd, int out_fd,
+      std::size_t max_size, Handler& handler, const IoExecutor& io_ex)
+    : io_uring_socket_splice_op_base(success_ec, socket, state,
+        in_fd, out_fd, max_size, &io_uring_socket_splice_op::do_complete),
+      handler_(static_cast<Handler&&>(handler)),
+      work_(handler_, io_ex)
+  {
+  }
+
+  static void do_complete(void* owner, operation* base,
+      const asio::error_code& /*ec*/,
+      std::size_t /*bytes_transferred*/)
+  {
+    // Take ownership of the handler object.
+    ASIO_ASSUME(base != 0);
+    io_uring_socket_splice_op* o
+      (static_cast<io_uring_socket_splice_op*>(base));
+    ptr p = { asio::detail::addressof(o->handler_), o, o };
+
+    ASIO_HANDLER_COMPLETION((*o));
+
+    // Take ownership of the operation's outstanding work.
+    handler_work<Handler, IoExecutor> w(
+        static_cast<handler_work<Handler, IoExecutor>&&>(
+          o->work_));
+
+    ASIO_ERROR_LOCATION(o->ec_);
+
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the upcall is made. Even if we're not about to make an upcall, a
+    // sub-object of the handler may be the true owner of the memory associated
+    // with the handler. Consequently, a local copy of the handler is required
+    // to ensure that any owning sub-object remains valid until after we have
+    // deallocated the memory here.
+    detail::binder2<Handler, asio::error_code, std::size_t>
+      handler(o->handler_, o->ec_, o->bytes_transferred_);
+    p.h = asio::detail::addressof(handler.handler_);
+    p.reset();
+
+    // Make the upcall if required.
+    if (owner)
+    {
+      fenced_block b(fenced_block::half);
+      ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_, handler.arg2_));
+      w.complete(handler, handler.handler_);
+      ASIO_HANDLER_INVOCATION_END;
+    }
+  }
+
+private:
+  Handler handler_;
+  handler_work<Handler, IoExecutor> work_;
+};
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_IO_URING) && defined(ASIO_HAS_SPLICE)
+
+#endif // ASIO_DETAIL_IO_URING_SOCKET_SPLICE_OP_HPP
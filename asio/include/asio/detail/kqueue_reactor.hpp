@@ -24,6 +24,7 @@
 #include <sys/types.h>
 #include <sys/event.h>
 #include <sys/time.h>
+#include "asio/detail/allocation_counters.hpp"
 #include "asio/detail/conditionally_enabled_mutex.hpp"
 #include "asio/detail/limits.hpp"
 #include "asio/detail/object_pool.hpp"
@@ -261,6 +262,11 @@ private:
 
   // Keep track of all registered descriptors.
   object_pool<descriptor_state> registered_descriptors_;
+
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  // The counters charged for the memory used by registered descriptors.
+  allocation_counters* allocation_counters_;
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
 };
 
 } // namespace detail
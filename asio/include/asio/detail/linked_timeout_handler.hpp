@@ -0,0 +1,157 @@
+//
+// detail/linked_timeout_handler.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_LINKED_TIMEOUT_HANDLER_HPP
+#define ASIO_DETAIL_LINKED_TIMEOUT_HANDLER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include "asio/associator.hpp"
+#include "asio/detail/chrono.hpp"
+#include "asio/detail/handler_cont_helpers.hpp"
+#include "asio/detail/type_traits.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+// Whether socket operations on the default backend are able to enforce a
+// deadline natively, without a separate timer.
+#if defined(ASIO_HAS_IO_URING_AS_DEFAULT)
+typedef true_type socket_linked_timeout_support;
+#else // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
+typedef false_type socket_linked_timeout_support;
+#endif // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
+
+// Whether file operations are able to enforce a deadline natively, without a
+// separate timer.
+#if defined(ASIO_HAS_IO_URING)
+typedef true_type file_linked_timeout_support;
+#else // defined(ASIO_HAS_IO_URING)
+typedef false_type file_linked_timeout_support;
+#endif // defined(ASIO_HAS_IO_URING)
+
+// Trait used to determine whether an initiation function object accepts a
+// linked_timeout_handler in place of a timed_cancel_op. Initiations opt in by
+// defining a nested linked_timeout_support type.
+template <typename Initiation, typename = void>
+struct supports_linked_timeout : false_type
+{
+};
+
+template <typename Initiation>
+struct supports_linked_timeout<Initiation,
+    void_t<typename Initiation::linked_timeout_support>>
+  : Initiation::linked_timeout_support
+{
+};
+
+// Wraps a completion handler together with the absolute deadline by which the
+// operation must complete. The I/O service that receives the handler is
+// responsible for cancelling the operation when the deadline is reached.
+template <typename Handler>
+class linked_timeout_handler
+{
+public:
+  typedef chrono::steady_clock::time_point time_point;
+
+  template <typename H>
+  linked_timeout_handler(H&& handler, const time_point& deadline)
+    : handler_(static_cast<H&&>(handler)),
+      deadline_(deadline)
+  {
+  }
+
+  template <typename... Args>
+  void operator()(Args&&... args)
+  {
+    static_cast<Handler&&>(handler_)(static_cast<Args&&>(args)...);
+  }
+
+  const time_point& deadline() const noexcept
+  {
+    return deadline_;
+  }
+
+//private:
+  Handler handler_;
+  time_point deadline_;
+};
+
+template <typename Handler>
+inline bool asio_handler_is_continuation(
+    linked_timeout_handler<Handler>* this_handler)
+{
+  return asio_handler_cont_helpers::is_continuation(
+      this_handler->handler_);
+}
+
+// Obtain the deadline associated with a handler, if any.
+template <typename Handler>
+inline const chrono::steady_clock::time_point*
+get_linked_timeout_deadline(const Handler&) noexcept
+{
+  return 0;
+}
+
+template <typename Handler>
+inline const chrono::steady_clock::time_point*
+get_linked_timeout_deadline(const linked_timeout_handler<Handler>& h) noexcept
+{
+  return &h.deadline_;
+}
+
+// Convert a relative timeout into an absolute deadline on the steady clock,
+// saturating rather than overflowing for very long timeouts.
+template <typename Rep, typename Period>
+chrono::steady_clock::time_point linked_timeout_deadline(
+    const chrono::duration<Rep, Period>& timeout)
+{
+  typedef chrono::steady_clock::time_point time_point;
+  const time_point now = chrono::steady_clock::now();
+  if (timeout <= chrono::duration<Rep, Period>::zero())
+    return now;
+  if (chrono::duration<double>(timeout)
+      >= chrono::duration<double>((time_point::max)() - now))
+    return (time_point::max)();
+  return now + chrono::duration_cast<chrono::steady_clock::duration>(timeout);
+}
+
+} // namespace detail
+
+template <template <typename, typename> class Associator,
+    typename Handler, typename DefaultCandidate>
+struct associator<Associator,
+    detail::linked_timeout_handler<Handler>, DefaultCandidate>
+  : Associator<Handler, DefaultCandidate>
+{
+  static typename Associator<Handler, DefaultCandidate>::type get(
+      const detail::linked_timeout_handler<Handler>& h) noexcept
+  {
+    return Associator<Handler, DefaultCandidate>::get(h.handler_);
+  }
+
+  static auto get(const detail::linked_timeout_handler<Handler>& h,
+      const DefaultCandidate& c) noexcept
+    -> decltype(Associator<Handler, DefaultCandidate>::get(h.handler_, c))
+  {
+    return Associator<Handler, DefaultCandidate>::get(h.handler_, c);
+  }
+};
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_DETAIL_LINKED_TIMEOUT_HANDLER_HPP
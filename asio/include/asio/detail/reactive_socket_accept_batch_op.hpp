@@ -0,0 +1,253 @@
+//
+// detail/reactive_socket_accept_batch_op.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_REACTIVE_SOCKET_ACCEPT_BATCH_OP_HPP
+#define ASIO_DETAIL_REACTIVE_SOCKET_ACCEPT_BATCH_OP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/fenced_block.hpp"
+#include "asio/detail/handler_alloc_helpers.hpp"
+#include "asio/detail/handler_work.hpp"
+#include "asio/detail/memory.hpp"
+#include "asio/detail/reactor_op.hpp"
+#include "asio/detail/socket_access.hpp"
+#include "asio/detail/socket_holder.hpp"
+#include "asio/detail/socket_ops.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+template <typename Socket, typename Protocol>
+class reactive_socket_accept_batch_op_base : public reactor_op
+{
+public:
+  // The maximum number of connections to accept in a single operation.
+  enum { max_connections = 64 };
+
+  reactive_socket_accept_batch_op_base(const asio::error_code& success_ec,
+      socket_type socket, socket_ops::state_type state, Socket* peers,
+      std::size_t count, const Protocol& protocol, func_type complete_func)
+    : reactor_op(success_ec,
+        &reactive_socket_accept_batch_op_base::do_perform, complete_func),
+      socket_(socket),
+      state_(state),
+      peers_(peers),
+      count_(count < std::size_t(max_connections)
+          ? count : std::size_t(max_connections)),
+      protocol_(protocol),
+      accepted_(0),
+      new_state_(0)
+  {
+  }
+
+  static status do_perform(reactor_op* base)
+  {
+    ASIO_ASSUME(base != 0);
+    reactive_socket_accept_batch_op_base* o(
+        static_cast<reactive_socket_accept_batch_op_base*>(base));
+
+    // Drain as many pending connections as will fit, so that a single
+    // readiness notification can service a burst of connection attempts.
+    while (o->accepted_ < o->count_)
+    {
+      socket_type new_socket = invalid_socket;
+      if (!socket_ops::non_blocking_accept(o->socket_, o->state_,
+            0, 0, o->ec_, new_socket, o->new_state_))
+      {
+        // No connections are pending. Wait for readiness unless some
+        // connections have already been accepted.
+        if (o->accepted_ == 0)
+          return not_done;
+        o->ec_ = asio::error_code();
+        break;
+      }
+
+      if (new_socket == invalid_socket)
+      {
+        // An error is reported only if it prevents any connection from being
+        // accepted. Otherwise, it is left to be reported by a subsequent
+        // operation.
+        if (o->accepted_ > 0)
+          o->ec_ = asio::error_code();
+        break;
+      }
+
+      o->new_sockets_[o->accepted_++].reset(new_socket);
+    }
+
+    ASIO_HANDLER_REACTOR_OPERATION((*o, "non_blocking_accept",
+          o->ec_, o->accepted_));
+
+    return done;
+  }
+
+  void do_assign()
+  {
+    // A connection that cannot be assigned is closed, but the remaining
+    // connections are still assigned to the next available sockets. The
+    // assignment error is reported along with the number of connections that
+    // were assigned, so that the caller knows connections have been lost.
+    std::size_t assigned = 0;
+    asio::error_code assign_ec;
+    for (std::size_t i = 0; i < accepted_; ++i)
+    {
+      asio::error_code ec;
+      socket_access::assign_accepted(peers_[assigned], protocol_,
+          new_sockets_[i].get(), new_state_, ec);
+      if (ec)
+      {
+        new_sockets_[i].reset();
+        assign_ec = ec;
+      }
+      else
+      {
+        new_sockets_[i].release();
+        ++assigned;
+      }
+    }
+    bytes_transferred_ = assigned;
+    if (assign_ec)
+      ec_ = assign_ec;
+    else if (assigned > 0)
+      ec_ = asio::error_code();
+  }
+
+private:
+  socket_type socket_;
+  socket_ops::state_type state_;
+  Socket* peers_;
+  std::size_t count_;
+  Protocol protocol_;
+  std::size_t accepted_;
+  socket_ops::state_type new_state_;
+  socket_holder new_sockets_[max_connections];
+};
+
+template <typename Socket, typename Protocol,
+    typename Handler, typename IoExecutor>
+class reactive_socket_accept_batch_op :
+  public reactive_socket_accept_batch_op_base<Socket, Protocol>
+{
+public:
+  typedef Handler handler_type;
+  typedef IoExecutor io_executor_type;
+
+  ASIO_DEFINE_HANDLER_PTR(reactive_socket_accept_batch_op);
+
+  reactive_socket_accept_batch_op(const asio::error_code& success_ec,
+      socket_type socket, socket_ops::state_type state, Socket* peers,
+      std::size_t count, const Protocol& protocol, Handler& handler,
+      const IoExecutor& io_ex)
+    : reactive_socket_accept_batch_op_base<Socket, Protocol>(
+        success_ec, socket, state, peers, count, protocol,
+        &reactive_socket_accept_batch_op::do_complete),
+      handler_(static_cast<Handler&&>(handler)),
+      work_(handler_, io_ex)
+  {
+  }
+
+  static void do_complete(void* owner, operation* base,
+      const asio::error_code& /*ec*/,
+      std::size_t /*bytes_transferred*/)
+  {
+    // Take ownership of the handler object.
+    ASIO_ASSUME(base != 0);
+    reactive_socket_accept_batch_op* o(
+        static_cast<reactive_socket_accept_batch_op*>(base));
+    ptr p = { asio::detail::addressof(o->handler_), o, o };
+
+    // On success, assign new connections to peer socket objects.
+    if (owner)
+      o->do_assign();
+
+    ASIO_HANDLER_COMPLETION((*o));
+
+    // Take ownership of the operation's outstanding work.
+    handler_work<Handler, IoExecutor> w(
+        static_cast<handler_work<Handler, IoExecutor>&&>(
+          o->work_));
+
+    ASIO_ERROR_LOCATION(o->ec_);
+
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the upcall is made. Even if we're not about to make an upcall, a
+    // sub-object of the handler may be the true owner of the memory associated
+    // with the handler. Consequently, a local copy of the handler is required
+    // to ensure that any owning sub-object remains valid until after we have
+    // deallocated the memory here.
+    detail::binder2<Handler, asio::error_code, std::size_t>
+      handler(o->handler_, o->ec_, o->bytes_transferred_);
+    p.h = asio::detail::addressof(handler.handler_);
+    p.reset();
+
+    // Make the upcall if required.
+    if (owner)
+    {
+      fenced_block b(fenced_block::half);
+      ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_, handler.arg2_));
+      w.complete(handler, handler.handler_);
+      ASIO_HANDLER_INVOCATION_END;
+    }
+  }
+
+  static void do_immediate(operation* base, bool, const void* io_ex)
+  {
+    // Take ownership of the handler object.
+    ASIO_ASSUME(base != 0);
+    reactive_socket_accept_batch_op* o(
+        static_cast<reactive_socket_accept_batch_op*>(base));
+    ptr p = { asio::detail::addressof(o->handler_), o, o };
+
+    // On success, assign new connections to peer socket objects.
+    o->do_assign();
+
+    ASIO_HANDLER_COMPLETION((*o));
+
+    // Take ownership of the operation's outstanding work.
+    immediate_handler_work<Handler, IoExecutor> w(
+        static_cast<handler_work<Handler, IoExecutor>&&>(
+          o->work_));
+
+    ASIO_ERROR_LOCATION(o->ec_);
+
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the upcall is made. Even if we're not about to make an upcall, a
+    // sub-object of the handler may be the true owner of the memory associated
+    // with the handler. Consequently, a local copy of the handler is required
+    // to ensure that any owning sub-object remains valid until after we have
+    // deallocated the memory here.
+    detail::binder2<Handler, asio::error_code, std::size_t>
+      handler(o->handler_, o->ec_, o->bytes_transferred_);
+    p.h = asio::detail::addressof(handler.handler_);
+    p.reset();
+
+    ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_, handler.arg2_));
+    w.complete(handler, handler.handler_, io_ex);
+    ASIO_HANDLER_INVOCATION_END;
+  }
+
+private:
+  Handler handler_;
+  handler_work<Handler, IoExecutor> work_;
+};
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_DETAIL_REACTIVE_SOCKET_ACCEPT_BATCH_OP_HPP
@@ -22,6 +22,7 @@
 #include "asio/detail/handler_work.hpp"
 #include "asio/detail/memory.hpp"
 #include "asio/detail/reactor_op.hpp"
+#include "asio/detail/socket_access.hpp"
 #include "asio/detail/socket_holder.hpp"
 #include "asio/detail/socket_ops.hpp"
 
@@ -45,7 +46,8 @@ public:
       peer_(peer),
       protocol_(protocol),
       peer_endpoint_(peer_endpoint),
-      addrlen_(peer_endpoint ? peer_endpoint->capacity() : 0)
+      addrlen_(peer_endpoint ? peer_endpoint->capacity() : 0),
+      new_state_(0)
   {
   }
 
@@ -58,8 +60,8 @@ public:
     socket_type new_socket = invalid_socket;
     status result = socket_ops::non_blocking_accept(o->socket_,
         o->state_, o->peer_endpoint_ ? o->peer_endpoint_->data() : 0,
-        o->peer_endpoint_ ? &o->addrlen_ : 0, o->ec_, new_socket)
-    ? done : not_done;
+        o->peer_endpoint_ ? &o->addrlen_ : 0, o->ec_, new_socket,
+        o->new_state_) ? done : not_done;
     o->new_socket_.reset(new_socket);
 
     ASIO_HANDLER_REACTOR_OPERATION((*o, "non_blocking_accept", o->ec_));
@@ -73,7 +75,8 @@ public:
     {
       if (peer_endpoint_)
         peer_endpoint_->resize(addrlen_);
-      peer_.assign(protocol_, new_socket_.get(), ec_);
+      socket_access::assign_accepted(peer_,
+          protocol_, new_socket_.get(), new_state_, ec_);
       if (!ec_)
         new_socket_.release();
     }
@@ -87,6 +90,7 @@ private:
   Protocol protocol_;
   typename Protocol::endpoint* peer_endpoint_;
   std::size_t addrlen_;
+  socket_ops::state_type new_state_;
 };
 
 template <typename Socket, typename Protocol,
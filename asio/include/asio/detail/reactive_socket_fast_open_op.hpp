@@ -0,0 +1,230 @@
+//
+// detail/reactive_socket_fast_open_op.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_REACTIVE_SOCKET_FAST_OPEN_OP_HPP
+#define ASIO_DETAIL_REACTIVE_SOCKET_FAST_OPEN_OP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_TCP_FASTOPEN)
+
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/buffer_sequence_adapter.hpp"
+#include "asio/detail/fenced_block.hpp"
+#include "asio/detail/handler_alloc_helpers.hpp"
+#include "asio/detail/handler_work.hpp"
+#include "asio/detail/memory.hpp"
+#include "asio/detail/reactor_op.hpp"
+#include "asio/detail/socket_ops.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+template <typename ConstBufferSequence, typename Endpoint>
+class reactive_socket_fast_open_op_base : public reactor_op
+{
+public:
+  reactive_socket_fast_open_op_base(const asio::error_code& success_ec,
+      socket_type socket, const Endpoint& peer_endpoint,
+      const ConstBufferSequence& buffers, func_type complete_func)
+    : reactor_op(success_ec,
+        &reactive_socket_fast_open_op_base::do_perform, complete_func),
+      socket_(socket),
+      peer_endpoint_(peer_endpoint),
+      buffers_(buffers),
+      connect_started_(false)
+  {
+  }
+
+  static status do_perform(reactor_op* base)
+  {
+    ASIO_ASSUME(base != 0);
+    reactive_socket_fast_open_op_base* o(
+        static_cast<reactive_socket_fast_open_op_base*>(base));
+
+    buffer_sequence_adapter<asio::const_buffer,
+        ConstBufferSequence> bufs(o->buffers_);
+
+    if (!o->connect_started_)
+    {
+      // Start the connection, sending as much of the data as possible in the
+      // SYN if the peer has previously issued a Fast Open cookie.
+      if (!socket_ops::non_blocking_sendto(o->socket_,
+            bufs.buffers(), bufs.count(), ASIO_OS_DEF(MSG_FASTOPEN),
+            o->peer_endpoint_.data(), o->peer_endpoint_.size(),
+            o->ec_, o->bytes_transferred_))
+        return not_done;
+
+      o->connect_started_ = true;
+
+      if (o->ec_ == asio::error::in_progress)
+      {
+        // The SYN has been sent without data. Wait for the connection to be
+        // established and then send the data normally.
+        o->ec_ = asio::error_code();
+        return not_done;
+      }
+      else if (o->ec_ == asio::error::operation_not_supported)
+      {
+        // Fast Open is disabled, so fall back to a regular connect.
+        if (socket_ops::connect(o->socket_, o->peer_endpoint_.data(),
+              o->peer_endpoint_.size(), o->ec_) != 0)
+        {
+          if (o->ec_ != asio::error::in_progress
+              && o->ec_ != asio::error::would_block)
+            return done;
+
+          o->ec_ = asio::error_code();
+          return not_done;
+        }
+      }
+      else
+      {
+        ASIO_HANDLER_REACTOR_OPERATION((*o, "non_blocking_sendto",
+              o->ec_, o->bytes_transferred_));
+
+        return done;
+      }
+    }
+
+    // The connection has been initiated. Any connection failure is reported
+    // by the send.
+    status result = socket_ops::non_blocking_send(o->socket_,
+        bufs.buffers(), bufs.count(), 0,
+        o->ec_, o->bytes_transferred_) ? done : not_done;
+
+    ASIO_HANDLER_REACTOR_OPERATION((*o, "non_blocking_send",
+          o->ec_, o->bytes_transferred_));
+
+    return result;
+  }
+
+private:
+  socket_type socket_;
+  Endpoint peer_endpoint_;
+  ConstBufferSequence buffers_;
+  bool connect_started_;
+};
+
+template <typename ConstBufferSequence, typename Endpoint,
+    typename Handler, typename IoExecutor>
+class reactive_socket_fast_open_op :
+  public reactive_socket_fast_open_op_base<ConstBufferSequence, Endpoint>
+{
+public:
+  typedef Handler handler_type;
+  typedef IoExecutor io_executor_type;
+
+  ASIO_DEFINE_HANDLER_PTR(reactive_socket_fast_open_op);
+
+  reactive_socket_fast_open_op(const asio::error_code& success_ec,
+      socket_type socket, const Endpoint& peer_endpoint,
+      const ConstBufferSequence& buffers, Handler& handler,
+      const IoExecutor& io_ex)
+    : reactive_socket_fast_open_op_base<ConstBufferSequence, Endpoint>(
+        success_ec, socket, peer_endpoint, buffers,
+        &reactive_socket_fast_open_op::do_complete),
+      handler_(static_cast<Handler&&>(handler)),
+      work_(handler_, io_ex)
+  {
+  }
+
+  static void do_complete(void* owner, operation* base,
+      const asio::error_code& /*ec*/,
+      std::size_t /*bytes_transferred*/)
+  {
+    // Take ownership of the handler object.
+    ASIO_ASSUME(base != 0);
+    reactive_socket_fast_open_op* o(
+        static_cast<reactive_socket_fast_open_op*>(base));
+    ptr p = { asio::detail::addressof(o->handler_), o, o };
+
+    ASIO_HANDLER_COMPLETION((*o));
+
+    // Take ownership of the operation's outstanding work.
+    handler_work<Handler, IoExecutor> w(
+        static_cast<handler_work<Handler, IoExecutor>&&>(
+          o->work_));
+
+    ASIO_ERROR_LOCATION(o->ec_);
+
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the upcall is made. Even if we're not about to make an upcall, a
+    // sub-object of the handler may be the true owner of the memory associated
+    // with the handler. Consequently, a local copy of the handler is required
+    // to ensure that any owning sub-object remains valid until after we have
+    // deallocated the memory here.
+    detail::binder2<Handler, asio::error_code, std::size_t>
+      handler(o->handler_, o->ec_, o->bytes_transferred_);
+    p.h = asio::detail::addressof(handler.handler_);
+    p.reset();
+
+    // Make the upcall if required.
+    if (owner)
+    {
+      fenced_block b(fenced_block::half);
+      ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_, handler.arg2_));
+      w.complete(handler, handler.handler_);
+      ASIO_HANDLER_INVOCATION_END;
+    }
+  }
+
+  static void do_immediate(operation* base, bool, const void* io_ex)
+  {
+    // Take ownership of the handler object.
+    ASIO_ASSUME(base != 0);
+    reactive_socket_fast_open_op* o(
+        static_cast<reactive_socket_fast_open_op*>(base));
+    ptr p = { asio::detail::addressof(o->handler_), o, o };
+
+    ASIO_HANDLER_COMPLETION((*o));
+
+    // Take ownership of the operation's outstanding work.
+    immediate_handler_work<Handler, IoExecutor> w(
+        static_cast<handler_work<Handler, IoExecutor>&&>(
+          o->work_));
+
+    ASIO_ERROR_LOCATION(o->ec_);
+
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the upcall is made. Even if we're not about to make an upcall, a
+    // sub-object of the handler may be the true owner of the memory associated
+    // with the handler. Consequently, a local copy of the handler is required
+    // to ensure that any owning sub-object remains valid until after we have
+    // deallocated the memory here.
+    detail::binder2<Handler, asio::error_code, std::size_t>
+      handler(o->handler_, o->ec_, o->bytes_transferred_);
+    p.h = asio::detail::addressof(handler.handler_);
+    p.reset();
+
+    ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_, handler.arg2_));
+    w.complete(handler, handler.handler_, io_ex);
+    ASIO_HANDLER_INVOCATION_END;
+  }
+
+private:
+  Handler handler_;
+  handler_work<Handler, IoExecutor> work_;
+};
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_TCP_FASTOPEN)
+
+#endif // ASIO_DETAIL_REACTIVE_SOCKET_FAST_OPEN_OP_HPP
@@ -28,8 +28,10 @@
 #include "asio/detail/memory.hpp"
 #include "asio/detail/noncopyable.hpp"
 #include "asio/detail/reactive_null_buffers_op.hpp"
+#include "asio/detail/reactive_socket_accept_batch_op.hpp"
 #include "asio/detail/reactive_socket_accept_op.hpp"
 #include "asio/detail/reactive_socket_connect_op.hpp"
+#include "asio/detail/reactive_socket_fast_open_op.hpp"
 #include "asio/detail/reactive_socket_recvfrom_op.hpp"
 #include "asio/detail/reactive_socket_sendto_op.hpp"
 #include "asio/detail/reactive_socket_service_base.hpp"
@@ -145,6 +147,22 @@ public:
     return ec;
   }
 
+  // Assign a newly accepted native socket to a socket implementation, adding
+  // the state flags that describe how the native socket was created.
+  asio::error_code assign_accepted(implementation_type& impl,
+      const protocol_type& protocol, const native_handle_type& native_socket,
+      socket_ops::state_type state, asio::error_code& ec)
+  {
+    if (!do_assign(impl, protocol.type(), native_socket, ec))
+    {
+      impl.protocol_ = protocol;
+      impl.state_ |= state;
+    }
+
+    ASIO_ERROR_LOCATION(ec);
+    return ec;
+  }
+
   // Get the native socket representation.
   native_handle_type native_handle(implementation_type& impl)
   {
@@ -541,6 +559,45 @@ public:
     p.v = p.p = 0;
   }
 
+  // Start an asynchronous accept of up to count connections. The peers array
+  // must be valid until the accept's handler is invoked.
+  template <typename Socket, typename Handler, typename IoExecutor>
+  void async_accept_batch(implementation_type& impl, Socket* peers,
+      std::size_t count, Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef reactive_socket_accept_batch_op<
+        Socket, Protocol, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_, impl.state_,
+        peers, count, impl.protocol_, handler, io_ex);
+
+    bool peers_open = false;
+    for (std::size_t i = 0; i < count && !peers_open; ++i)
+      peers_open = peers[i].is_open();
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected() && !peers_open)
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<reactor_op_cancellation>(
+            &reactor_, &impl.reactor_data_, impl.socket_, reactor::read_op);
+    }
+
+    ASIO_HANDLER_CREATION((reactor_.context(), *p.p, "socket",
+          &impl, impl.socket_, "async_accept_batch"));
+
+    start_accept_op(impl, p.p, is_continuation, peers_open, &io_ex, 0);
+    p.v = p.p = 0;
+  }
+
   // Start an asynchronous accept. The peer_endpoint object must be valid until
   // the accept's handler is invoked.
   template <typename PeerIoExecutor, typename Handler, typename IoExecutor>
@@ -620,6 +677,46 @@ public:
         peer_endpoint.data(), peer_endpoint.size(), &io_ex, 0);
     p.v = p.p = 0;
   }
+
+#if defined(ASIO_HAS_TCP_FASTOPEN)
+  // Start an asynchronous connect that carries initial data, using TCP Fast
+  // Open to send the data in the SYN where possible.
+  template <typename ConstBufferSequence, typename Handler, typename IoExecutor>
+  void async_connect(implementation_type& impl,
+      const endpoint_type& peer_endpoint,
+      const ConstBufferSequence& initial_data,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef reactive_socket_fast_open_op<ConstBufferSequence,
+        endpoint_type, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_,
+        peer_endpoint, initial_data, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<reactor_op_cancellation>(
+            &reactor_, &impl.reactor_data_, impl.socket_, reactor::connect_op);
+    }
+
+    ASIO_HANDLER_CREATION((reactor_.context(), *p.p, "socket",
+          &impl, impl.socket_, "async_connect"));
+
+    start_op(impl, reactor::connect_op, p.p,
+        is_continuation, true, false, true, &io_ex, 0);
+    p.v = p.p = 0;
+  }
+#endif // defined(ASIO_HAS_TCP_FASTOPEN)
 };
 
 } // namespace detail
@@ -31,8 +31,14 @@
 #include "asio/detail/memory.hpp"
 #include "asio/detail/reactive_null_buffers_op.hpp"
 #include "asio/detail/reactive_socket_recv_op.hpp"
+#include "asio/detail/reactive_socket_recvcmsg_op.hpp"
+#include "asio/detail/reactive_socket_recvmmsg_op.hpp"
 #include "asio/detail/reactive_socket_recvmsg_op.hpp"
 #include "asio/detail/reactive_socket_send_op.hpp"
+#include "asio/detail/reactive_socket_sendcmsg_op.hpp"
+#include "asio/detail/reactive_socket_sendfile_op.hpp"
+#include "asio/detail/reactive_socket_sendmmsg_op.hpp"
+#include "asio/detail/reactive_socket_splice_op.hpp"
 #include "asio/detail/reactive_wait_op.hpp"
 #include "asio/detail/reactor.hpp"
 #include "asio/detail/reactor_op.hpp"
@@ -352,6 +358,284 @@ public:
     p.v = p.p = 0;
   }
 
+#if defined(ASIO_HAS_SENDFILE)
+  // Start an asynchronous send of data from a file. The file must remain open
+  // for the lifetime of the asynchronous operation.
+  template <typename Handler, typename IoExecutor>
+  void async_send_file(base_implementation_type& impl, int fd,
+      uint64_t offset, std::size_t length,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef reactive_socket_sendfile_op<Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_,
+        fd, offset, length, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<reactor_op_cancellation>(
+            &reactor_, &impl.reactor_data_, impl.socket_, reactor::write_op);
+    }
+
+    ASIO_HANDLER_CREATION((reactor_.context(), *p.p, "socket",
+          &impl, impl.socket_, "async_send_file"));
+
+    start_op(impl, reactor::write_op, p.p, is_continuation,
+        true, length == 0, true, &io_ex, 0);
+    p.v = p.p = 0;
+  }
+#endif // defined(ASIO_HAS_SENDFILE)
+
+#if defined(ASIO_HAS_SPLICE)
+  // Start an asynchronous operation to move data from the socket into a
+  // pipe. The pipe must remain open for the lifetime of the asynchronous
+  // operation.
+  template <typename Handler, typename IoExecutor>
+  void async_splice_to_pipe(base_implementation_type& impl, int pipe_fd,
+      std::size_t max_size, Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef reactive_socket_splice_op<Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_,
+        pipe_fd, max_size, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<reactor_op_cancellation>(
+            &reactor_, &impl.reactor_data_, impl.socket_, reactor::read_op);
+    }
+
+    ASIO_HANDLER_CREATION((reactor_.context(), *p.p, "socket",
+          &impl, impl.socket_, "async_splice_to_pipe"));
+
+    start_op(impl, reactor::read_op, p.p, is_continuation,
+        true, max_size == 0, true, &io_ex, 0);
+    p.v = p.p = 0;
+  }
+
+  // Start an asynchronous operation to move data from a pipe to the socket.
+  // The pipe must remain open for the lifetime of the asynchronous operation.
+  template <typename Handler, typename IoExecutor>
+  void async_splice_from_pipe(base_implementation_type& impl, int pipe_fd,
+      std::size_t max_size, Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef reactive_socket_splice_op<Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, pipe_fd,
+        impl.socket_, max_size, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<reactor_op_cancellation>(
+            &reactor_, &impl.reactor_data_, impl.socket_, reactor::write_op);
+    }
+
+    ASIO_HANDLER_CREATION((reactor_.context(), *p.p, "socket",
+          &impl, impl.socket_, "async_splice_from_pipe"));
+
+    start_op(impl, reactor::write_op, p.p, is_continuation,
+        true, max_size == 0, true, &io_ex, 0);
+    p.v = p.p = 0;
+  }
+#endif // defined(ASIO_HAS_SPLICE)
+
+#if defined(ASIO_HAS_MMSG)
+  // Start an asynchronous send of a batch of datagrams. The messages and
+  // their buffers must be valid for the lifetime of the asynchronous
+  // operation.
+  template <typename Message, typename Handler, typename IoExecutor>
+  void async_send_batch(base_implementation_type& impl,
+      Message* messages, std::size_t count,
+      socket_base::message_flags flags,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef reactive_socket_sendmmsg_op<Message, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_,
+        messages, count, flags, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<reactor_op_cancellation>(
+            &reactor_, &impl.reactor_data_, impl.socket_, reactor::write_op);
+    }
+
+    ASIO_HANDLER_CREATION((reactor_.context(), *p.p, "socket",
+          &impl, impl.socket_, "async_send_batch"));
+
+    start_op(impl, reactor::write_op, p.p, is_continuation,
+        true, count == 0, true, &io_ex, 0);
+    p.v = p.p = 0;
+  }
+
+  // Start an asynchronous receive of a batch of datagrams. The messages
+  // and their buffers must be valid for the lifetime of the asynchronous
+  // operation.
+  template <typename Message, typename Handler, typename IoExecutor>
+  void async_receive_batch(base_implementation_type& impl,
+      Message* messages, std::size_t count,
+      socket_base::message_flags flags,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef reactive_socket_recvmmsg_op<Message, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_,
+        messages, count, flags, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<reactor_op_cancellation>(
+            &reactor_, &impl.reactor_data_, impl.socket_, reactor::read_op);
+    }
+
+    ASIO_HANDLER_CREATION((reactor_.context(), *p.p, "socket",
+          &impl, impl.socket_, "async_receive_batch"));
+
+    start_op(impl, reactor::read_op, p.p, is_continuation,
+        true, count == 0, true, &io_ex, 0);
+    p.v = p.p = 0;
+  }
+#endif // defined(ASIO_HAS_MMSG)
+
+#if defined(ASIO_HAS_ANCILLARY_DATA)
+  // Start an asynchronous send with ancillary data. The buffers, and the
+  // storage referenced by the control buffer, must be valid for the lifetime
+  // of the asynchronous operation. A null destination sends to the connected
+  // peer.
+  template <typename ConstBufferSequence, typename Endpoint,
+      typename Handler, typename IoExecutor>
+  void async_send_msg(base_implementation_type& impl,
+      const ConstBufferSequence& buffers, const Endpoint* destination,
+      const control_buffer& control, socket_base::message_flags flags,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef reactive_socket_sendcmsg_op<ConstBufferSequence,
+        Endpoint, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_, buffers,
+        destination, control, flags, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<reactor_op_cancellation>(
+            &reactor_, &impl.reactor_data_, impl.socket_, reactor::write_op);
+    }
+
+    ASIO_HANDLER_CREATION((reactor_.context(), *p.p, "socket",
+          &impl, impl.socket_, "async_send_msg"));
+
+    start_op(impl, reactor::write_op, p.p,
+        is_continuation, true, false, true, &io_ex, 0);
+    p.v = p.p = 0;
+  }
+
+  // Start an asynchronous receive with ancillary data. The buffers, the
+  // sender endpoint, the control buffer and the storage it references must
+  // be valid for the lifetime of the asynchronous operation. The sender may
+  // be null if the source address is not required.
+  template <typename MutableBufferSequence, typename Endpoint,
+      typename Handler, typename IoExecutor>
+  void async_receive_msg(base_implementation_type& impl,
+      const MutableBufferSequence& buffers, Endpoint* sender,
+      control_buffer& control, socket_base::message_flags in_flags,
+      socket_base::message_flags& out_flags, Handler& handler,
+      const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef reactive_socket_recvcmsg_op<MutableBufferSequence,
+        Endpoint, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_, impl.state_, buffers,
+        sender, control, in_flags, out_flags, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<reactor_op_cancellation>(
+            &reactor_, &impl.reactor_data_, impl.socket_, reactor::read_op);
+    }
+
+    ASIO_HANDLER_CREATION((reactor_.context(), *p.p, "socket",
+          &impl, impl.socket_, "async_receive_msg"));
+
+    start_op(impl,
+        (in_flags & socket_base::message_out_of_band)
+          ? reactor::except_op : reactor::read_op,
+        p.p, is_continuation,
+        (in_flags & socket_base::message_out_of_band) == 0,
+        false, true, &io_ex, 0);
+    p.v = p.p = 0;
+  }
+#endif // defined(ASIO_HAS_ANCILLARY_DATA)
+
   // Receive some data from the peer. Returns the number of bytes received.
   template <typename MutableBufferSequence>
   size_t receive(base_implementation_type& impl,
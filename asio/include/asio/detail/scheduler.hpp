@@ -19,6 +19,7 @@
 
 #include "asio/error_code.hpp"
 #include "asio/execution_context.hpp"
+#include "asio/detail/allocation_counters.hpp"
 #include "asio/detail/atomic_count.hpp"
 #include "asio/detail/conditionally_enabled_event.hpp"
 #include "asio/detail/conditionally_enabled_mutex.hpp"
@@ -226,6 +227,12 @@ private:
 
   // The thread that is running the scheduler.
   asio::detail::thread* thread_;
+
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  // The counters charged for allocations made by threads running the
+  // scheduler.
+  allocation_counters* allocation_counters_;
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
 };
 
 } // namespace detail
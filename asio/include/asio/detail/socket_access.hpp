@@ -0,0 +1,53 @@
+//
+// detail/socket_access.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_SOCKET_ACCESS_HPP
+#define ASIO_DETAIL_SOCKET_ACCESS_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include "asio/detail/socket_types.hpp"
+#include "asio/error_code.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+
+template <typename Protocol, typename Executor>
+class basic_socket;
+
+namespace detail {
+
+// Gives socket operations access to the implementation of a socket object.
+class socket_access
+{
+public:
+  // Assign a newly accepted native socket to a socket object, together with
+  // any state flags that were established when the socket was created.
+  template <typename Protocol, typename Executor, typename Protocol1,
+      typename State>
+  static void assign_accepted(basic_socket<Protocol, Executor>& peer,
+      const Protocol1& protocol, socket_type new_socket,
+      State state, asio::error_code& ec)
+  {
+    peer.impl_.get_service().assign_accepted(
+        peer.impl_.get_implementation(), protocol, new_socket, state, ec);
+  }
+};
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_DETAIL_SOCKET_ACCESS_HPP
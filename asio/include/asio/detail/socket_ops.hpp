@@ -18,6 +18,7 @@
 #include "asio/detail/config.hpp"
 
 #include "asio/error_code.hpp"
+#include "asio/detail/cstdint.hpp"
 #include "asio/detail/memory.hpp"
 #include "asio/detail/socket_types.hpp"
 
@@ -81,6 +82,14 @@ ASIO_DECL bool non_blocking_accept(socket_type s,
     state_type state, void* addr, std::size_t* addrlen,
     asio::error_code& ec, socket_type& new_socket);
 
+// Accept a connection, creating the new socket in non-blocking mode where this
+// can be done as part of the accept. On success, new_state receives the state
+// flags that describe the new socket.
+ASIO_DECL bool non_blocking_accept(socket_type s,
+    state_type state, void* addr, std::size_t* addrlen,
+    asio::error_code& ec, socket_type& new_socket,
+    state_type& new_state);
+
 #endif // defined(ASIO_HAS_IOCP)
 
 ASIO_DECL int bind(socket_type s, const void* addr,
@@ -251,6 +260,63 @@ ASIO_DECL bool non_blocking_send1(socket_type s,
 
 #endif // defined(ASIO_HAS_IOCP)
 
+#if defined(ASIO_HAS_SENDFILE)
+
+ASIO_DECL signed_size_type sendfile(socket_type s, int fd,
+    uint64_t offset, size_t size, asio::error_code& ec);
+
+ASIO_DECL bool non_blocking_sendfile(socket_type s, int fd,
+    uint64_t offset, size_t size, asio::error_code& ec,
+    size_t& bytes_transferred);
+
+#endif // defined(ASIO_HAS_SENDFILE)
+
+#if defined(ASIO_HAS_SPLICE)
+
+ASIO_DECL signed_size_type splice(int in_fd, int out_fd,
+    size_t size, asio::error_code& ec);
+
+ASIO_DECL bool non_blocking_splice(int in_fd, int out_fd,
+    size_t size, asio::error_code& ec, size_t& bytes_transferred);
+
+#endif // defined(ASIO_HAS_SPLICE)
+
+#if defined(ASIO_HAS_MMSG)
+
+ASIO_DECL signed_size_type recvmmsg(socket_type s, mmsghdr* msgs,
+    size_t count, int flags, asio::error_code& ec);
+
+ASIO_DECL bool non_blocking_recvmmsg(socket_type s, mmsghdr* msgs,
+    size_t count, int flags, asio::error_code& ec,
+    size_t& messages_transferred);
+
+ASIO_DECL signed_size_type sendmmsg(socket_type s, mmsghdr* msgs,
+    size_t count, int flags, asio::error_code& ec);
+
+ASIO_DECL bool non_blocking_sendmmsg(socket_type s, mmsghdr* msgs,
+    size_t count, int flags, asio::error_code& ec,
+    size_t& messages_transferred);
+
+#endif // defined(ASIO_HAS_MMSG)
+
+#if defined(ASIO_HAS_ANCILLARY_DATA)
+
+ASIO_DECL signed_size_type recvmsg(socket_type s,
+    msghdr* msg, int flags, asio::error_code& ec);
+
+ASIO_DECL bool non_blocking_recvmsg(socket_type s,
+    msghdr* msg, int flags, asio::error_code& ec,
+    size_t& bytes_transferred);
+
+ASIO_DECL signed_size_type sendmsg(socket_type s,
+    const msghdr* msg, int flags, asio::error_code& ec);
+
+ASIO_DECL bool non_blocking_sendmsg(socket_type s,
+    const msghdr* msg, int flags, asio::error_code& ec,
+    size_t& bytes_transferred);
+
+#endif // defined(ASIO_HAS_ANCILLARY_DATA)
+
 ASIO_DECL signed_size_type sendto(socket_type s,
     const buf* bufs, size_t count, int flags, const void* addr,
     std::size_t addrlen, asio::error_code& ec);
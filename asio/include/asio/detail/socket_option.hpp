@@ -307,6 +307,79 @@ private:
   detail::linger_type value_;
 };
 
+#if defined(ASIO_HAS_INCOMING_CPU)
+
+// Helper template for implementing a socket option that attaches a classic BPF
+// program to a SO_REUSEPORT group. The program selects the socket whose index
+// within the group is the number of the CPU that received the packet, modulo
+// the size of the group.
+template <int Level, int Name>
+class reuseport_cpu_program
+{
+public:
+  // Construct for a group with the specified number of sockets.
+  explicit reuseport_cpu_program(std::size_t group_size)
+  {
+    // A = the current CPU.
+    code_[0].code = BPF_LD | BPF_W | BPF_ABS;
+    code_[0].jt = 0;
+    code_[0].jf = 0;
+    code_[0].k = static_cast<__u32>(SKF_AD_OFF + SKF_AD_CPU);
+
+    // A = A % group_size.
+    code_[1].code = BPF_ALU | BPF_MOD | BPF_K;
+    code_[1].jt = 0;
+    code_[1].jf = 0;
+    code_[1].k = static_cast<__u32>(group_size);
+
+    // Return A as the index of the selected socket.
+    code_[2].code = BPF_RET | BPF_A;
+    code_[2].jt = 0;
+    code_[2].jf = 0;
+    code_[2].k = 0;
+
+    program_.len = 3;
+    program_.filter = code_;
+  }
+
+  // Get the level of the socket option.
+  template <typename Protocol>
+  int level(const Protocol&) const
+  {
+    return Level;
+  }
+
+  // Get the name of the socket option.
+  template <typename Protocol>
+  int name(const Protocol&) const
+  {
+    return Name;
+  }
+
+  // Get the address of the program data.
+  template <typename Protocol>
+  const sock_fprog* data(const Protocol&) const
+  {
+    // The program refers to the instructions by address, so the pointer is
+    // refreshed here in case the option object has been copied.
+    program_.filter = const_cast<sock_filter*>(code_);
+    return &program_;
+  }
+
+  // Get the size of the program data.
+  template <typename Protocol>
+  std::size_t size(const Protocol&) const
+  {
+    return sizeof(program_);
+  }
+
+private:
+  sock_filter code_[3];
+  mutable sock_fprog program_;
+};
+
+#endif // defined(ASIO_HAS_INCOMING_CPU)
+
 } // namespace socket_option
 } // namespace detail
 } // namespace asio
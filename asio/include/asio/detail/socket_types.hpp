@@ -81,6 +81,12 @@
 # if !defined(__SYMBIAN32__)
 #  include <netinet/tcp.h>
 # endif
+# if defined(ASIO_HAS_UDP_GSO)
+#  include <netinet/udp.h>
+# endif
+# if defined(ASIO_HAS_INCOMING_CPU)
+#  include <linux/filter.h>
+# endif
 # include <arpa/inet.h>
 # include <netdb.h>
 # include <net/if.h>
@@ -368,6 +374,54 @@ typedef int signed_size_type;
 # define ASIO_OS_DEF_SO_RCVLOWAT SO_RCVLOWAT
 # define ASIO_OS_DEF_SO_REUSEADDR SO_REUSEADDR
 # define ASIO_OS_DEF_TCP_NODELAY TCP_NODELAY
+# if defined(ASIO_HAS_UDP_GSO)
+#  if defined(UDP_SEGMENT)
+#   define ASIO_OS_DEF_UDP_SEGMENT UDP_SEGMENT
+#  else // defined(UDP_SEGMENT)
+#   define ASIO_OS_DEF_UDP_SEGMENT 103
+#  endif // defined(UDP_SEGMENT)
+#  if defined(UDP_GRO)
+#   define ASIO_OS_DEF_UDP_GRO UDP_GRO
+#  else // defined(UDP_GRO)
+#   define ASIO_OS_DEF_UDP_GRO 104
+#  endif // defined(UDP_GRO)
+# endif // defined(ASIO_HAS_UDP_GSO)
+# if defined(ASIO_HAS_TCP_FASTOPEN)
+#  if defined(MSG_FASTOPEN)
+#   define ASIO_OS_DEF_MSG_FASTOPEN MSG_FASTOPEN
+#  else // defined(MSG_FASTOPEN)
+#   define ASIO_OS_DEF_MSG_FASTOPEN 0x20000000
+#  endif // defined(MSG_FASTOPEN)
+#  if defined(TCP_FASTOPEN)
+#   define ASIO_OS_DEF_TCP_FASTOPEN TCP_FASTOPEN
+#  else // defined(TCP_FASTOPEN)
+#   define ASIO_OS_DEF_TCP_FASTOPEN 23
+#  endif // defined(TCP_FASTOPEN)
+#  if defined(TCP_FASTOPEN_CONNECT)
+#   define ASIO_OS_DEF_TCP_FASTOPEN_CONNECT TCP_FASTOPEN_CONNECT
+#  else // defined(TCP_FASTOPEN_CONNECT)
+#   define ASIO_OS_DEF_TCP_FASTOPEN_CONNECT 30
+#  endif // defined(TCP_FASTOPEN_CONNECT)
+# endif // defined(ASIO_HAS_TCP_FASTOPEN)
+# if defined(ASIO_HAS_REUSE_PORT)
+#  if defined(SO_REUSEPORT)
+#   define ASIO_OS_DEF_SO_REUSEPORT SO_REUSEPORT
+#  else // defined(SO_REUSEPORT)
+#   define ASIO_OS_DEF_SO_REUSEPORT 15
+#  endif // defined(SO_REUSEPORT)
+# endif // defined(ASIO_HAS_REUSE_PORT)
+# if defined(ASIO_HAS_INCOMING_CPU)
+#  if defined(SO_INCOMING_CPU)
+#   define ASIO_OS_DEF_SO_INCOMING_CPU SO_INCOMING_CPU
+#  else // defined(SO_INCOMING_CPU)
+#   define ASIO_OS_DEF_SO_INCOMING_CPU 49
+#  endif // defined(SO_INCOMING_CPU)
+#  if defined(SO_ATTACH_REUSEPORT_CBPF)
+#   define ASIO_OS_DEF_SO_ATTACH_REUSEPORT_CBPF SO_ATTACH_REUSEPORT_CBPF
+#  else // defined(SO_ATTACH_REUSEPORT_CBPF)
+#   define ASIO_OS_DEF_SO_ATTACH_REUSEPORT_CBPF 51
+#  endif // defined(SO_ATTACH_REUSEPORT_CBPF)
+# endif // defined(ASIO_HAS_INCOMING_CPU)
 # define ASIO_OS_DEF_IP_MULTICAST_IF IP_MULTICAST_IF
 # define ASIO_OS_DEF_IP_MULTICAST_TTL IP_MULTICAST_TTL
 # define ASIO_OS_DEF_IP_MULTICAST_LOOP IP_MULTICAST_LOOP
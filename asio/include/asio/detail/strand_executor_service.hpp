@@ -16,6 +16,7 @@
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
 #include "asio/detail/config.hpp"
+#include "asio/detail/allocation_counters.hpp"
 #include "asio/detail/atomic_count.hpp"
 #include "asio/detail/executor_op.hpp"
 #include "asio/detail/memory.hpp"
@@ -158,6 +159,11 @@ private:
 
   // The head of a linked list of all implementations.
   strand_impl* impl_list_;
+
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  // The counters charged for the memory used by implementations.
+  allocation_counters* allocation_counters_;
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
 };
 
 } // namespace detail
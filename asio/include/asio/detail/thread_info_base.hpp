@@ -16,11 +16,14 @@
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
 #include "asio/detail/config.hpp"
-#include <climits>
 #include <cstddef>
 #include "asio/detail/memory.hpp"
 #include "asio/detail/noncopyable.hpp"
 
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+# include "asio/detail/allocation_counters.hpp"
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+
 #if !defined(ASIO_NO_EXCEPTIONS)
 # include <exception>
 # include "asio/multiple_exceptions.hpp"
@@ -32,93 +35,75 @@ namespace asio {
 namespace detail {
 
 #ifndef ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE
-# define ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE 2
+# define ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE 16
 #endif // ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE
 
+#ifndef ASIO_RECYCLING_ALLOCATOR_DEPOT_SIZE
+# define ASIO_RECYCLING_ALLOCATOR_DEPOT_SIZE 256
+#endif // ASIO_RECYCLING_ALLOCATOR_DEPOT_SIZE
+
+// Small blocks are rounded up to one of a fixed set of size classes. Each
+// thread keeps a bounded cache of free blocks for every class, and moves
+// blocks to and from a global depot in batches when its cache for a class is
+// empty or full. Because the size of a block is determined by its class, a
+// block freed by one operation can be reused by any other operation of a
+// similar size, regardless of which thread allocated it.
+//
+// The depot is a lock-free list of batches for each size class. A thread that
+// frees blocks allocated elsewhere, such as a worker completing operations
+// started on an acceptor thread, pushes its surplus onto the list with a
+// single compare-and-swap. A thread whose cache is empty takes the entire
+// list with a single exchange and returns the batches it does not need.
 class thread_info_base
   : private noncopyable
 {
 public:
-  struct default_tag
-  {
-    enum
-    {
-      cache_size = ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE,
-      begin_mem_index = 0,
-      end_mem_index = cache_size
-    };
-  };
-
-  struct awaitable_frame_tag
-  {
-    enum
-    {
-      cache_size = ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE,
-      begin_mem_index = default_tag::end_mem_index,
-      end_mem_index = begin_mem_index + cache_size
-    };
-  };
-
-  struct executor_function_tag
-  {
-    enum
-    {
-      cache_size = ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE,
-      begin_mem_index = awaitable_frame_tag::end_mem_index,
-      end_mem_index = begin_mem_index + cache_size
-    };
-  };
-
-  struct cancellation_signal_tag
-  {
-    enum
-    {
-      cache_size = ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE,
-      begin_mem_index = executor_function_tag::end_mem_index,
-      end_mem_index = begin_mem_index + cache_size
-    };
-  };
-
-  struct parallel_group_tag
-  {
-    enum
-    {
-      cache_size = ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE,
-      begin_mem_index = cancellation_signal_tag::end_mem_index,
-      end_mem_index = begin_mem_index + cache_size
-    };
-  };
+  struct default_tag {};
+  struct awaitable_frame_tag {};
+  struct executor_function_tag {};
+  struct cancellation_signal_tag {};
+  struct parallel_group_tag {};
+  struct timed_cancel_tag {};
 
-  struct timed_cancel_tag
+  // Counters describing how allocation requests were satisfied.
+  struct statistics
   {
-    enum
-    {
-      cache_size = ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE,
-      begin_mem_index = parallel_group_tag::end_mem_index,
-      end_mem_index = begin_mem_index + cache_size
-    };
+    std::size_t allocations;
+    std::size_t deallocations;
+    std::size_t cache_hits;
+    std::size_t depot_refills;
+    std::size_t depot_flushes;
+    std::size_t heap_allocations;
+    std::size_t heap_deallocations;
   };
 
-  enum { max_mem_index = timed_cancel_tag::end_mem_index };
-
   thread_info_base()
-#if !defined(ASIO_NO_EXCEPTIONS)
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+    : allocation_counters_(0)
+# if !defined(ASIO_NO_EXCEPTIONS)
+    , has_pending_exception_(0)
+# endif // !defined(ASIO_NO_EXCEPTIONS)
+#elif !defined(ASIO_NO_EXCEPTIONS)
     : has_pending_exception_(0)
 #endif // !defined(ASIO_NO_EXCEPTIONS)
   {
-    for (int i = 0; i < max_mem_index; ++i)
-      reusable_memory_[i] = 0;
+    for (int i = 0; i < size_class_count; ++i)
+      cache_[i].count_ = 0;
+    statistics_ = statistics();
   }
 
   ~thread_info_base()
   {
-    for (int i = 0; i < max_mem_index; ++i)
+    // The following test for cached blocks is technically redundant, but it
+    // is significantly faster when using a tight io_context::poll() loop in
+    // latency sensitive applications.
+    for (int i = 0; i < size_class_count; ++i)
     {
-      // The following test for non-null pointers is technically redundant, but
-      // it is significantly faster when using a tight io_context::poll() loop
-      // in latency sensitive applications.
-      if (reusable_memory_[i])
-        aligned_delete(reusable_memory_[i]);
+      if (cache_[i].count_)
+      {
+        release_cache();
+        break;
+      }
     }
   }
 
@@ -138,70 +123,61 @@ public:
   static void* allocate(Purpose, thread_info_base* this_thread,
       std::size_t size, std::size_t align = ASIO_DEFAULT_ALIGN)
   {
-    std::size_t chunks = (size + chunk_size - 1) / chunk_size;
-
-    if (this_thread)
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+    // The counters charged for the allocation are stored after the end of the
+    // block, where they can be found again when the block is deallocated. The
+    // block holds a reference to them, as it may outlive their context.
+    allocation_counters* counters =
+      this_thread ? this_thread->allocation_counters_ : 0;
+    std::size_t offset = counters_offset(size);
+    void* pointer = allocate_block(this_thread,
+        offset + sizeof(allocation_counters*), align);
+    *reinterpret_cast<allocation_counters**>(
+        static_cast<char*>(pointer) + offset) = counters;
+    if (counters)
     {
-      for (int mem_index = Purpose::begin_mem_index;
-          mem_index < Purpose::end_mem_index; ++mem_index)
-      {
-        if (this_thread->reusable_memory_[mem_index])
-        {
-          void* const pointer = this_thread->reusable_memory_[mem_index];
-          unsigned char* const mem = static_cast<unsigned char*>(pointer);
-          if (static_cast<std::size_t>(mem[0]) >= chunks
-              && reinterpret_cast<std::size_t>(pointer) % align == 0)
-          {
-            this_thread->reusable_memory_[mem_index] = 0;
-            mem[size] = mem[0];
-            return pointer;
-          }
-        }
-      }
-
-      for (int mem_index = Purpose::begin_mem_index;
-          mem_index < Purpose::end_mem_index; ++mem_index)
-      {
-        if (this_thread->reusable_memory_[mem_index])
-        {
-          void* const pointer = this_thread->reusable_memory_[mem_index];
-          this_thread->reusable_memory_[mem_index] = 0;
-          aligned_delete(pointer);
-          break;
-        }
-      }
+      counters->add_ref();
+      counters->record_allocation(category_of(Purpose()), size);
     }
-
-    void* const pointer = aligned_new(align, chunks * chunk_size + 1);
-    unsigned char* const mem = static_cast<unsigned char*>(pointer);
-    mem[size] = (chunks <= UCHAR_MAX) ? static_cast<unsigned char>(chunks) : 0;
     return pointer;
+#else // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+    return allocate_block(this_thread, size, align);
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
   }
 
   template <typename Purpose>
   static void deallocate(Purpose, thread_info_base* this_thread,
       void* pointer, std::size_t size)
   {
-    if (size <= chunk_size * UCHAR_MAX)
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+    std::size_t offset = counters_offset(size);
+    if (allocation_counters* counters =
+        *reinterpret_cast<allocation_counters**>(
+          static_cast<char*>(pointer) + offset))
     {
-      if (this_thread)
-      {
-        for (int mem_index = Purpose::begin_mem_index;
-            mem_index < Purpose::end_mem_index; ++mem_index)
-        {
-          if (this_thread->reusable_memory_[mem_index] == 0)
-          {
-            unsigned char* const mem = static_cast<unsigned char*>(pointer);
-            mem[0] = mem[size];
-            this_thread->reusable_memory_[mem_index] = pointer;
-            return;
-          }
-        }
-      }
+      counters->record_deallocation(category_of(Purpose()), size);
+      counters->release();
     }
+    deallocate_block(this_thread, pointer,
+        offset + sizeof(allocation_counters*));
+#else // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+    deallocate_block(this_thread, pointer, size);
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  }
 
-    aligned_delete(pointer);
+  // Get the allocation counters for the thread.
+  const statistics& get_statistics() const
+  {
+    return statistics_;
+  }
+
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  // Set the counters to be charged for allocations made by the thread.
+  void set_allocation_counters(allocation_counters* counters)
+  {
+    allocation_counters_ = counters;
   }
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
 
   void capture_current_exception()
   {
@@ -239,12 +215,183 @@ public:
   }
 
 private:
-#if defined(ASIO_HAS_IO_URING)
-  enum { chunk_size = 8 };
-#else // defined(ASIO_HAS_IO_URING)
-  enum { chunk_size = 4 };
-#endif // defined(ASIO_HAS_IO_URING)
-  void* reusable_memory_[max_mem_index];
+  enum
+  {
+    // The number of blocks cached per size class.
+    cache_size = ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE < 2
+      ? 2 : ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE,
+
+    // The number of blocks moved to or from the depot at once.
+    batch_size = cache_size / 2,
+
+    // Sizes up to 64 bytes use classes in 16 byte steps. Larger sizes use four
+    // classes between each pair of powers of two, up to max_class_size.
+    size_class_count = 24,
+    max_class_size = 2048
+  };
+
+  // Get the size class for a non-zero size no greater than max_class_size.
+  static int size_class_of(std::size_t size)
+  {
+    std::size_t n = size ? size - 1 : 0;
+    if (n < 64)
+      return static_cast<int>(n >> 4);
+    int log2 = 6;
+    while (n >> (log2 + 1))
+      ++log2;
+    return 4 + (log2 - 6) * 4 + static_cast<int>((n >> (log2 - 2)) & 3);
+  }
+
+  // Get the size of the blocks in a size class.
+  static std::size_t class_size(int size_class)
+  {
+    if (size_class < 4)
+      return static_cast<std::size_t>(size_class + 1) << 4;
+    int group = (size_class - 4) / 4;
+    int step = (size_class - 4) % 4;
+    return static_cast<std::size_t>(5 + step) << (group + 4);
+  }
+
+  // Allocate a block, taking it from the cache if possible.
+  static void* allocate_block(thread_info_base* this_thread,
+      std::size_t size, std::size_t align)
+  {
+    if (size > max_class_size)
+    {
+      if (this_thread)
+      {
+        ++this_thread->statistics_.allocations;
+        ++this_thread->statistics_.heap_allocations;
+      }
+      return aligned_new(align, size);
+    }
+
+    int size_class = size_class_of(size);
+    if (this_thread)
+    {
+      ++this_thread->statistics_.allocations;
+
+      // Cached blocks are only guaranteed to have the default alignment.
+      if (align <= ASIO_DEFAULT_ALIGN)
+      {
+        class_cache& cache = this_thread->cache_[size_class];
+        if (cache.count_ > 0 || this_thread->refill_cache(size_class))
+        {
+          ++this_thread->statistics_.cache_hits;
+          return cache.blocks_[--cache.count_];
+        }
+      }
+
+      ++this_thread->statistics_.heap_allocations;
+    }
+
+    return aligned_new(align, class_size(size_class));
+  }
+
+  // Deallocate a block, returning it to the cache if possible.
+  static void deallocate_block(thread_info_base* this_thread,
+      void* pointer, std::size_t size)
+  {
+    if (this_thread)
+    {
+      ++this_thread->statistics_.deallocations;
+      if (size <= max_class_size)
+      {
+        class_cache& cache = this_thread->cache_[size_class_of(size)];
+        if (cache.count_ == cache_size)
+          this_thread->flush_cache(size_class_of(size), batch_size);
+        cache.blocks_[cache.count_++] = pointer;
+        return;
+      }
+
+      ++this_thread->statistics_.heap_deallocations;
+    }
+
+    aligned_delete(pointer);
+  }
+
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  // Get the offset of the counters stored after a block of the given size.
+  static std::size_t counters_offset(std::size_t size)
+  {
+    const std::size_t align = sizeof(allocation_counters*);
+    return (size + align - 1) / align * align;
+  }
+
+  // Get the accounting category for each purpose.
+  static int category_of(default_tag)
+  {
+    return allocation_counters::handler;
+  }
+
+  static int category_of(awaitable_frame_tag)
+  {
+    return allocation_counters::awaitable_frame;
+  }
+
+  static int category_of(executor_function_tag)
+  {
+    return allocation_counters::executor_function;
+  }
+
+  static int category_of(cancellation_signal_tag)
+  {
+    return allocation_counters::cancellation_signal;
+  }
+
+  static int category_of(parallel_group_tag)
+  {
+    return allocation_counters::parallel_group;
+  }
+
+  static int category_of(timed_cancel_tag)
+  {
+    return allocation_counters::timed_cancel;
+  }
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+
+  // A free block in the depot. The first block in each batch also links to
+  // the next batch.
+  struct free_block
+  {
+    free_block* next_;
+    free_block* next_batch_;
+  };
+
+  // The depot's lists of batches, one for each size class.
+  struct depot;
+  ASIO_DECL static depot* get_depot();
+
+  // Push a list of batches, containing the specified number of blocks, onto
+  // the depot.
+  ASIO_DECL static void push_batches(int size_class,
+      free_block* first, free_block* last, std::size_t count);
+
+  // Take all batches from the depot.
+  ASIO_DECL static free_block* take_batches(int size_class);
+
+  // Move a batch of blocks from the depot into an empty cache. Returns true
+  // if any blocks were obtained.
+  ASIO_DECL bool refill_cache(int size_class);
+
+  // Move the specified number of the oldest blocks from a cache to the depot.
+  ASIO_DECL void flush_cache(int size_class, std::size_t count);
+
+  // Move all cached blocks to the depot, freeing those that do not fit.
+  ASIO_DECL void release_cache();
+
+  struct class_cache
+  {
+    std::size_t count_;
+    void* blocks_[cache_size];
+  };
+
+  class_cache cache_[size_class_count];
+  statistics statistics_;
+
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  allocation_counters* allocation_counters_;
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
 
 #if !defined(ASIO_NO_EXCEPTIONS)
   int has_pending_exception_;
@@ -257,4 +404,8 @@ private:
 
 #include "asio/detail/pop_options.hpp"
 
+#if defined(ASIO_HEADER_ONLY)
+# include "asio/detail/impl/thread_info_base.ipp"
+#endif // defined(ASIO_HEADER_ONLY)
+
 #endif // ASIO_DETAIL_THREAD_INFO_BASE_HPP
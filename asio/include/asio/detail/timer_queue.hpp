@@ -18,6 +18,7 @@
 #include "asio/detail/config.hpp"
 #include <cstddef>
 #include <vector>
+#include "asio/detail/allocation_counters.hpp"
 #include "asio/detail/cstdint.hpp"
 #include "asio/detail/date_time_fwd.hpp"
 #include "asio/detail/limits.hpp"
@@ -73,6 +74,15 @@ public:
   {
   }
 
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  // Set the counters charged for the memory used by the timer heap.
+  void set_allocation_counters(allocation_counters* counters)
+  {
+    heap_tracker_ = allocation_tracker(counters, allocation_counters::timer,
+        heap_.capacity() * sizeof(heap_entry));
+  }
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+
   // Add a new timer to the queue. Returns true if this is the timer that is
   // earliest in the queue, in which case the reactor's event demultiplexing
   // function call may need to be interrupted and restarted.
@@ -93,6 +103,9 @@ public:
         timer.heap_index_ = heap_.size();
         heap_entry entry = { time, &timer };
         heap_.push_back(entry);
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+        heap_tracker_.resize(heap_.capacity() * sizeof(heap_entry));
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
         up_heap(heap_.size() - 1);
       }
 
@@ -379,6 +392,11 @@ private:
 
   // The heap of timers, with the earliest timer at the front.
   std::vector<heap_entry> heap_;
+
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  // Records the memory used by the heap.
+  allocation_tracker heap_tracker_;
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
 };
 
 } // namespace detail
@@ -87,6 +87,14 @@ public:
   ASIO_DECL void move_timer(per_timer_data& target,
       per_timer_data& source);
 
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  // Set the counters charged for the memory used by the timer heap.
+  void set_allocation_counters(allocation_counters* counters)
+  {
+    impl_.set_allocation_counters(counters);
+  }
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+
 private:
   timer_queue<forwarding_posix_time_traits> impl_;
 };
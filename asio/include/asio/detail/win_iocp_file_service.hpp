@@ -20,6 +20,7 @@
 #if defined(ASIO_HAS_IOCP) && defined(ASIO_HAS_FILE)
 
 #include <string>
+#include "asio/detail/blocking_op_service.hpp"
 #include "asio/detail/cstdint.hpp"
 #include "asio/detail/win_iocp_handle_service.hpp"
 #include "asio/error.hpp"
@@ -103,6 +104,19 @@ public:
       const char* path, file_base::flags open_flags,
       asio::error_code& ec);
 
+  // Start an asynchronous open. The implementation must not be used for any
+  // other operation until the open completes.
+  template <typename Handler, typename IoExecutor>
+  void async_open(implementation_type& impl,
+      const char* path, file_base::flags open_flags,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    blocking_op_service_.template async_call<false>(
+        blocking_function(this, &impl,
+          blocking_function::open_op, 0, path, open_flags),
+        handler, io_ex);
+  }
+
   // Assign a native handle to a file implementation.
   asio::error_code assign(implementation_type& impl,
       const native_handle_type& native_handle,
@@ -148,18 +162,58 @@ public:
   ASIO_DECL uint64_t size(const implementation_type& impl,
       asio::error_code& ec) const;
 
+  // Start an asynchronous operation to get the size of the file.
+  template <typename Handler, typename IoExecutor>
+  void async_size(implementation_type& impl,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    blocking_op_service_.template async_call<true>(
+        blocking_function(this, &impl, blocking_function::size_op),
+        handler, io_ex);
+  }
+
   // Alter the size of the file.
   ASIO_DECL asio::error_code resize(implementation_type& impl,
       uint64_t n, asio::error_code& ec);
 
+  // Start an asynchronous operation to alter the size of the file.
+  template <typename Handler, typename IoExecutor>
+  void async_resize(implementation_type& impl, uint64_t n,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    blocking_op_service_.template async_call<false>(
+        blocking_function(this, &impl, blocking_function::resize_op, n),
+        handler, io_ex);
+  }
+
   // Synchronise the file to disk.
   ASIO_DECL asio::error_code sync_all(implementation_type& impl,
       asio::error_code& ec);
 
+  // Start an asynchronous operation to synchronise the file to disk.
+  template <typename Handler, typename IoExecutor>
+  void async_sync_all(implementation_type& impl,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    blocking_op_service_.template async_call<false>(
+        blocking_function(this, &impl, blocking_function::sync_all_op),
+        handler, io_ex);
+  }
+
   // Synchronise the file data to disk.
   ASIO_DECL asio::error_code sync_data(implementation_type& impl,
       asio::error_code& ec);
 
+  // Start an asynchronous operation to synchronise the file data to disk.
+  template <typename Handler, typename IoExecutor>
+  void async_sync_data(implementation_type& impl,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    blocking_op_service_.template async_call<false>(
+        blocking_function(this, &impl, blocking_function::sync_data_op),
+        handler, io_ex);
+  }
+
   // Seek to a position in the file.
   ASIO_DECL uint64_t seek(implementation_type& impl, int64_t offset,
       file_base::seek_basis whence, asio::error_code& ec);
@@ -248,9 +302,65 @@ public:
   }
 
 private:
+  // Function object used to perform a blocking file operation on one of the
+  // blocking_op_service's threads.
+  class blocking_function
+  {
+  public:
+    enum op_type { open_op, size_op, resize_op, sync_all_op, sync_data_op };
+
+    blocking_function(win_iocp_file_service* service,
+        implementation_type* impl, op_type type, uint64_t n = 0,
+        const char* path = "", file_base::flags open_flags = file_base::flags())
+      : service_(service),
+        impl_(impl),
+        type_(type),
+        n_(n),
+        path_(path),
+        open_flags_(open_flags)
+    {
+    }
+
+    uint64_t operator()(asio::error_code& ec)
+    {
+      switch (type_)
+      {
+      case open_op:
+        service_->open(*impl_, path_.c_str(), open_flags_, ec);
+        return 0;
+      case size_op:
+        return service_->size(*impl_, ec);
+      case resize_op:
+        service_->resize(*impl_, n_, ec);
+        return 0;
+      case sync_all_op:
+        service_->sync_all(*impl_, ec);
+        return 0;
+      case sync_data_op:
+        service_->sync_data(*impl_, ec);
+        return 0;
+      default:
+        ec = asio::error::operation_not_supported;
+        return 0;
+      }
+    }
+
+  private:
+    win_iocp_file_service* service_;
+    implementation_type* impl_;
+    op_type type_;
+    uint64_t n_;
+    std::string path_;
+    file_base::flags open_flags_;
+  };
+
   // The implementation used for initiating asynchronous operations.
   win_iocp_handle_service handle_service_;
 
+  // The service used to perform blocking operations asynchronously. These
+  // operations are not ordered with respect to outstanding writes.
+  blocking_op_service& blocking_op_service_;
+
   // Emulation of Windows IO_STATUS_BLOCK structure.
   struct io_status_block
   {
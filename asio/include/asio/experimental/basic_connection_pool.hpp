@@ -0,0 +1,366 @@
+//
+// experimental/basic_connection_pool.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_EXPERIMENTAL_BASIC_CONNECTION_POOL_HPP
+#define ASIO_EXPERIMENTAL_BASIC_CONNECTION_POOL_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+#include <memory>
+#include "asio/any_io_executor.hpp"
+#include "asio/async_result.hpp"
+#include "asio/compose.hpp"
+#include "asio/detail/chrono.hpp"
+#include "asio/detail/non_const_lvalue.hpp"
+#include "asio/detail/type_traits.hpp"
+#include "asio/execution_context.hpp"
+#include "asio/experimental/detail/connection_pool_state.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace experimental {
+
+/// A pool of idle client connections that may be reused.
+/**
+ * The basic_connection_pool class template keeps connected sockets that are no
+ * longer in use, grouped by remote endpoint, so that later requests to the
+ * same endpoint can reuse them rather than establishing a new connection. This
+ * avoids the cost of the connection handshake, of registering a new socket
+ * with the I/O service and, for TCP, of restarting slow-start.
+ *
+ * A connection is obtained using @c async_checkout. If an idle connection to
+ * the endpoint is available, the most recently used one is handed out.
+ * Otherwise, a new connection is established. Once the application has
+ * finished with a connection, and if the connection is left in a state where
+ * it may be reused, it is returned to the pool using @c checkin.
+ *
+ * Before an idle connection is handed out, it is checked using a non-blocking
+ * peek. A connection that has been closed by the peer, or on which unsolicited
+ * data has arrived, is closed and discarded. Idle connections are also closed
+ * once they have been unused for longer than the idle timeout. Expiry is
+ * driven by a single timer, which is only active while the pool holds idle
+ * connections. As the timer is outstanding work for the pool's executor, an
+ * io_context's @c run() function does not return while idle connections
+ * remain in the pool.
+ *
+ * The pool is intended for connection-oriented protocols such as
+ * asio::ip::tcp.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe.
+ *
+ * The basic_connection_pool class template performs no locking. A pool should
+ * be used only from code running on the pool's executor, such as a single
+ * thread or a strand. Applications running multiple threads would typically
+ * create one pool per thread or strand.
+ *
+ * @par Example
+ * @code asio::experimental::basic_connection_pool<asio::ip::tcp> pool(ctx);
+ * ...
+ * pool.async_checkout(endpoint,
+ *     [&](asio::error_code ec, asio::ip::tcp::socket conn)
+ *     {
+ *       if (!ec)
+ *       {
+ *         // ... perform a request on conn ...
+ *         pool.checkin(std::move(conn));
+ *       }
+ *     }); @endcode
+ */
+template <typename Protocol, typename Executor = any_io_executor>
+class basic_connection_pool
+{
+private:
+  class initiate_async_checkout;
+  typedef detail::connection_pool_state<Protocol, Executor> state_type;
+
+public:
+  /// The type of the executor associated with the pool.
+  typedef Executor executor_type;
+
+  /// Rebinds the pool type to another executor.
+  template <typename Executor1>
+  struct rebind_executor
+  {
+    /// The pool type when rebound to the specified executor.
+    typedef basic_connection_pool<Protocol, Executor1> other;
+  };
+
+  /// The protocol type.
+  typedef Protocol protocol_type;
+
+  /// The endpoint type.
+  typedef typename Protocol::endpoint endpoint_type;
+
+  /// The type of the sockets held by the pool.
+  typedef typename state_type::socket_type socket_type;
+
+  /// The clock type used for idle timeouts.
+  typedef chrono::steady_clock clock_type;
+
+  /// The duration type used for idle timeouts.
+  typedef clock_type::duration duration;
+
+  /// The default maximum number of idle connections kept per endpoint.
+  static constexpr std::size_t default_max_idle = 8;
+
+  /// Construct a connection pool.
+  /**
+   * This constructor creates an empty connection pool.
+   *
+   * @param ex The I/O executor that the pool will use, by default, to dispatch
+   * handlers for any asynchronous operations performed on the pool. Sockets
+   * created by the pool are also associated with this executor.
+   */
+  explicit basic_connection_pool(const executor_type& ex)
+    : state_(std::make_shared<state_type>(ex,
+          std::size_t(default_max_idle), default_idle_timeout()))
+  {
+  }
+
+  /// Construct a connection pool.
+  /**
+   * This constructor creates an empty connection pool.
+   *
+   * @param context An execution context which provides the I/O executor that
+   * the pool will use, by default, to dispatch handlers for any asynchronous
+   * operations performed on the pool. Sockets created by the pool are also
+   * associated with this executor.
+   */
+  template <typename ExecutionContext>
+  explicit basic_connection_pool(ExecutionContext& context,
+      constraint_t<
+        is_convertible<ExecutionContext&, execution_context&>::value
+      > = 0)
+    : state_(std::make_shared<state_type>(context.get_executor(),
+          std::size_t(default_max_idle), default_idle_timeout()))
+  {
+  }
+
+  /// Move-construct a connection pool from another.
+  /**
+   * Following the move, the moved-from object must not be used except to be
+   * destroyed or assigned to.
+   */
+  basic_connection_pool(basic_connection_pool&& other) noexcept
+    : state_(static_cast<std::shared_ptr<state_type>&&>(other.state_))
+  {
+  }
+
+  /// Move-assign a connection pool from another.
+  /**
+   * Any idle connections held by this pool are closed.
+   */
+  basic_connection_pool& operator=(basic_connection_pool&& other)
+  {
+    if (this != &other)
+    {
+      if (state_)
+        state_->clear();
+      state_ = static_cast<std::shared_ptr<state_type>&&>(other.state_);
+    }
+    return *this;
+  }
+
+  /// Destroys the connection pool.
+  /**
+   * Any idle connections held by the pool are closed.
+   */
+  ~basic_connection_pool()
+  {
+    if (state_)
+      state_->clear();
+  }
+
+  /// Get the executor associated with the object.
+  executor_type get_executor() noexcept
+  {
+    return state_->get_executor();
+  }
+
+  /// Get the maximum number of idle connections kept per endpoint.
+  std::size_t max_idle() const noexcept
+  {
+    return state_->max_idle();
+  }
+
+  /// Set the maximum number of idle connections kept per endpoint.
+  /**
+   * The new limit applies to connections subsequently checked in. A limit of
+   * zero disables pooling, so that all checked in connections are closed.
+   */
+  void max_idle(std::size_t n) noexcept
+  {
+    state_->max_idle(n);
+  }
+
+  /// Get the time after which an unused connection is closed.
+  duration idle_timeout() const noexcept
+  {
+    return state_->idle_timeout();
+  }
+
+  /// Set the time after which an unused connection is closed.
+  /**
+   * The new timeout applies to connections subsequently checked in.
+   */
+  void idle_timeout(const duration& d) noexcept
+  {
+    state_->idle_timeout(d);
+  }
+
+  /// Get the total number of idle connections held by the pool.
+  std::size_t idle_size() const noexcept
+  {
+    return state_->idle_size();
+  }
+
+  /// Get the number of idle connections held for an endpoint.
+  std::size_t idle_size(const endpoint_type& endpoint) const
+  {
+    return state_->idle_size(endpoint);
+  }
+
+  /// Return a connection to the pool.
+  /**
+   * This function adds a connected socket to the pool's idle connections for
+   * its remote endpoint. If the pool already holds the maximum number of idle
+   * connections for that endpoint, the least recently used one is closed.
+   *
+   * The socket is closed instead if it is not connected, or if pooling has
+   * been disabled by setting the maximum number of idle connections to zero.
+   *
+   * @param socket The socket to be returned. The socket must not have any
+   * outstanding asynchronous operations. Following this call, the socket is
+   * in the same state as if constructed using the @c socket_type(ex)
+   * constructor.
+   */
+  void checkin(socket_type&& socket)
+  {
+    state_->checkin(socket);
+  }
+
+  /// Close all idle connections held by the pool.
+  void clear()
+  {
+    state_->clear();
+  }
+
+  /// Start an asynchronous operation to obtain a connection.
+  /**
+   * This function is used to asynchronously obtain a connection to the
+   * specified endpoint, reusing an idle connection from the pool where one is
+   * available. It is an initiating function for an @ref
+   * asynchronous_operation, and always returns immediately.
+   *
+   * @param endpoint The remote endpoint to which the connection is required.
+   * Copies will be made of the endpoint as required.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the connection has been
+   * obtained. Potential completion tokens include @ref use_future, @ref
+   * use_awaitable, @ref yield_context, or a function object with the correct
+   * completion signature. The function signature of the completion handler
+   * must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   socket_type socket // On success, the connected socket.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, socket_type) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * When a new connection is being established, this asynchronous operation
+   * supports cancellation for the following asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        socket_type)) CheckoutToken = default_completion_token_t<executor_type>>
+  auto async_checkout(const endpoint_type& endpoint,
+      CheckoutToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<CheckoutToken,
+        void (asio::error_code, socket_type)>(
+          declval<initiate_async_checkout>(), token, endpoint))
+  {
+    return async_initiate<CheckoutToken,
+      void (asio::error_code, socket_type)>(
+        initiate_async_checkout(this), token, endpoint);
+  }
+
+private:
+  // Disallow copying and assignment.
+  basic_connection_pool(const basic_connection_pool&) = delete;
+  basic_connection_pool& operator=(const basic_connection_pool&) = delete;
+
+  static duration default_idle_timeout()
+  {
+    return chrono::seconds(60);
+  }
+
+  class initiate_async_checkout
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_checkout(basic_connection_pool* self)
+      : self_(self)
+    {
+    }
+
+    executor_type get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename CheckoutHandler>
+    void operator()(CheckoutHandler&& handler,
+        const endpoint_type& endpoint) const
+    {
+      socket_type socket(self_->get_executor());
+      self_->state_->take(endpoint, socket);
+
+      asio::detail::non_const_lvalue<CheckoutHandler> handler2(handler);
+      asio::async_compose<decay_t<CheckoutHandler>,
+        void (asio::error_code, socket_type)>(
+          detail::connection_pool_checkout_op<Protocol, Executor>(
+            socket, endpoint), handler2.value, self_->get_executor());
+    }
+
+  private:
+    basic_connection_pool* self_;
+  };
+
+  std::shared_ptr<state_type> state_;
+};
+
+} // namespace experimental
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_EXPERIMENTAL_BASIC_CONNECTION_POOL_HPP
@@ -0,0 +1,222 @@
+//
+// experimental/connect_parallel.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_EXPERIMENTAL_CONNECT_PARALLEL_HPP
+#define ASIO_EXPERIMENTAL_CONNECT_PARALLEL_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include "asio/async_result.hpp"
+#include "asio/basic_socket.hpp"
+#include "asio/connect.hpp"
+#include "asio/detail/chrono.hpp"
+#include "asio/detail/type_traits.hpp"
+#include "asio/error.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace experimental {
+namespace detail {
+
+template <typename, typename> class initiate_async_connect_parallel;
+
+} // namespace detail
+
+/// Asynchronously establishes a socket connection by racing connection
+/// attempts to the endpoints in a sequence.
+/**
+ * This function implements the connection racing algorithm described by
+ * RFC 8305 ("Happy Eyeballs Version 2"). It is an initiating function for an
+ * @ref asynchronous_operation, and always returns immediately.
+ *
+ * The endpoints are first reordered so that address families are interleaved,
+ * starting with the family of the first endpoint in the sequence. A connection
+ * attempt is then started to the first endpoint. Each subsequent attempt is
+ * started when the previous attempt fails, or after @c attempt_delay has
+ * elapsed since the previous attempt was started, whichever happens first.
+ * Earlier attempts continue to run while later attempts are in progress.
+ *
+ * Each attempt uses its own socket. The attempts are run as a
+ * asio::experimental::parallel_group, so that the first successful connection
+ * causes the remaining attempts to be cancelled. The winning socket is then
+ * moved into @c s.
+ *
+ * @param s The socket to be connected. If the socket is already open, it will
+ * be closed when the winning socket is moved into it.
+ *
+ * @param endpoints A sequence of endpoints.
+ *
+ * @param attempt_delay The delay between starting successive connection
+ * attempts. RFC 8305 recommends a value of 250 milliseconds.
+ *
+ * @param token The @ref completion_token that will be used to produce a
+ * completion handler, which will be called when the connect completes.
+ * Potential completion tokens include @ref use_future, @ref use_awaitable,
+ * @ref yield_context, or a function object with the correct completion
+ * signature. The function signature of the completion handler must be:
+ * @code void handler(
+ *   // Result of operation. if the sequence is empty, set to
+ *   // asio::error::not_found. Otherwise, contains the
+ *   // error from the last connection attempt to complete.
+ *   const asio::error_code& error,
+ *
+ *   // On success, the successfully connected endpoint.
+ *   // Otherwise, a default-constructed endpoint.
+ *   const typename Protocol::endpoint& endpoint
+ * ); @endcode
+ * Regardless of whether the asynchronous operation completes immediately or
+ * not, the completion handler will not be invoked from within this function.
+ * On immediate completion, invocation of the handler will be performed in a
+ * manner equivalent to using asio::async_immediate().
+ *
+ * @par Completion Signature
+ * @code void(asio::error_code, typename Protocol::endpoint) @endcode
+ *
+ * @par Example
+ * @code tcp::resolver r(my_context);
+ * tcp::socket s(my_context);
+ *
+ * // ...
+ *
+ * r.async_resolve("host", "service",
+ *     [&](asio::error_code ec, tcp::resolver::results_type results)
+ *     {
+ *       if (!ec)
+ *       {
+ *         asio::experimental::async_connect_parallel(s, results,
+ *             std::chrono::milliseconds(250), connect_handler);
+ *       }
+ *     }); @endcode
+ *
+ * The connection attempts share state that is accessed only from within a
+ * strand on the socket's executor, so the socket's executor may run handlers
+ * on more than one thread.
+ *
+ * @par Per-Operation Cancellation
+ * This asynchronous operation supports cancellation for the following
+ * asio::cancellation_type values:
+ *
+ * @li @c cancellation_type::terminal
+ *
+ * @li @c cancellation_type::partial
+ *
+ * @li @c cancellation_type::total
+ *
+ * Cancellation is forwarded to all connection attempts that are in progress.
+ */
+template <typename Protocol, typename Executor, typename EndpointSequence,
+    ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+      typename Protocol::endpoint)) RangeConnectToken
+        = default_completion_token_t<Executor>>
+inline auto async_connect_parallel(basic_socket<Protocol, Executor>& s,
+    const EndpointSequence& endpoints,
+    const chrono::steady_clock::duration& attempt_delay,
+    RangeConnectToken&& token = default_completion_token_t<Executor>(),
+    constraint_t<
+      is_endpoint_sequence<EndpointSequence>::value
+    > = 0)
+  -> decltype(
+    async_initiate<RangeConnectToken,
+      void (asio::error_code, typename Protocol::endpoint)>(
+        declval<detail::initiate_async_connect_parallel<Protocol, Executor>>(),
+        token, endpoints, attempt_delay))
+{
+  return async_initiate<RangeConnectToken,
+    void (asio::error_code, typename Protocol::endpoint)>(
+      detail::initiate_async_connect_parallel<Protocol, Executor>(s),
+      token, endpoints, attempt_delay);
+}
+
+/// Asynchronously establishes a socket connection by racing connection
+/// attempts to the endpoints in a sequence.
+/**
+ * This function implements the connection racing algorithm described by
+ * RFC 8305 ("Happy Eyeballs Version 2"), using the recommended delay of 250
+ * milliseconds between successive connection attempts. It is an initiating
+ * function for an @ref asynchronous_operation, and always returns
+ * immediately.
+ *
+ * @param s The socket to be connected. If the socket is already open, it will
+ * be closed when the winning socket is moved into it.
+ *
+ * @param endpoints A sequence of endpoints.
+ *
+ * @param token The @ref completion_token that will be used to produce a
+ * completion handler, which will be called when the connect completes.
+ * Potential completion tokens include @ref use_future, @ref use_awaitable,
+ * @ref yield_context, or a function object with the correct completion
+ * signature. The function signature of the completion handler must be:
+ * @code void handler(
+ *   // Result of operation. if the sequence is empty, set to
+ *   // asio::error::not_found. Otherwise, contains the
+ *   // error from the last connection attempt to complete.
+ *   const asio::error_code& error,
+ *
+ *   // On success, the successfully connected endpoint.
+ *   // Otherwise, a default-constructed endpoint.
+ *   const typename Protocol::endpoint& endpoint
+ * ); @endcode
+ * Regardless of whether the asynchronous operation completes immediately or
+ * not, the completion handler will not be invoked from within this function.
+ * On immediate completion, invocation of the handler will be performed in a
+ * manner equivalent to using asio::async_immediate().
+ *
+ * @par Completion Signature
+ * @code void(asio::error_code, typename Protocol::endpoint) @endcode
+ *
+ * @par Per-Operation Cancellation
+ * This asynchronous operation supports cancellation for the following
+ * asio::cancellation_type values:
+ *
+ * @li @c cancellation_type::terminal
+ *
+ * @li @c cancellation_type::partial
+ *
+ * @li @c cancellation_type::total
+ */
+template <typename Protocol, typename Executor, typename EndpointSequence,
+    ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+      typename Protocol::endpoint)) RangeConnectToken
+        = default_completion_token_t<Executor>>
+inline auto async_connect_parallel(basic_socket<Protocol, Executor>& s,
+    const EndpointSequence& endpoints,
+    RangeConnectToken&& token = default_completion_token_t<Executor>(),
+    constraint_t<
+      is_endpoint_sequence<EndpointSequence>::value
+    > = 0,
+    constraint_t<
+      !is_convertible<decay_t<RangeConnectToken>,
+        chrono::steady_clock::duration>::value
+    > = 0)
+  -> decltype(
+    async_initiate<RangeConnectToken,
+      void (asio::error_code, typename Protocol::endpoint)>(
+        declval<detail::initiate_async_connect_parallel<Protocol, Executor>>(),
+        token, endpoints, declval<chrono::steady_clock::duration>()))
+{
+  return async_initiate<RangeConnectToken,
+    void (asio::error_code, typename Protocol::endpoint)>(
+      detail::initiate_async_connect_parallel<Protocol, Executor>(s),
+      token, endpoints, chrono::steady_clock::duration(
+        chrono::milliseconds(250)));
+}
+
+} // namespace experimental
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#include "asio/experimental/impl/connect_parallel.hpp"
+
+#endif // ASIO_EXPERIMENTAL_CONNECT_PARALLEL_HPP
@@ -0,0 +1,340 @@
+//
+// experimental/detail/connection_pool_state.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_EXPERIMENTAL_DETAIL_CONNECTION_POOL_STATE_HPP
+#define ASIO_EXPERIMENTAL_DETAIL_CONNECTION_POOL_STATE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <memory>
+#include "asio/basic_waitable_timer.hpp"
+#include "asio/buffer.hpp"
+#include "asio/cancellation_type.hpp"
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/chrono.hpp"
+#include "asio/error.hpp"
+#include "asio/post.hpp"
+#include "asio/socket_base.hpp"
+#include "asio/wait_traits.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace experimental {
+namespace detail {
+
+// The idle connections held by a connection pool, keyed by remote endpoint.
+// The state is shared with the reaper timer's handler so that the pool may be
+// destroyed while a wait is outstanding.
+template <typename Protocol, typename Executor>
+class connection_pool_state
+  : public std::enable_shared_from_this<
+      connection_pool_state<Protocol, Executor>>
+{
+public:
+  typedef typename Protocol::endpoint endpoint_type;
+  typedef typename Protocol::socket::template
+    rebind_executor<Executor>::other socket_type;
+  typedef chrono::steady_clock clock_type;
+  typedef basic_waitable_timer<clock_type,
+    wait_traits<clock_type>, Executor> timer_type;
+
+  connection_pool_state(const Executor& ex, std::size_t max_idle,
+      const clock_type::duration& idle_timeout)
+    : timer_(ex),
+      max_idle_(max_idle),
+      idle_timeout_(idle_timeout),
+      idle_size_(0),
+      reaper_active_(false)
+  {
+  }
+
+  Executor get_executor() noexcept
+  {
+    return timer_.get_executor();
+  }
+
+  std::size_t max_idle() const noexcept
+  {
+    return max_idle_;
+  }
+
+  void max_idle(std::size_t n) noexcept
+  {
+    max_idle_ = n;
+  }
+
+  clock_type::duration idle_timeout() const noexcept
+  {
+    return idle_timeout_;
+  }
+
+  void idle_timeout(const clock_type::duration& d) noexcept
+  {
+    idle_timeout_ = d;
+  }
+
+  std::size_t idle_size() const noexcept
+  {
+    return idle_size_;
+  }
+
+  std::size_t idle_size(const endpoint_type& endpoint) const
+  {
+    typename idle_map::const_iterator iter = idle_.find(endpoint);
+    return iter != idle_.end() ? iter->second.size() : 0;
+  }
+
+  // Take the most recently used idle connection to the endpoint, skipping any
+  // that have expired or have been closed by the peer.
+  bool take(const endpoint_type& endpoint, socket_type& socket)
+  {
+    typename idle_map::iterator iter = idle_.find(endpoint);
+    if (iter == idle_.end())
+      return false;
+
+    clock_type::time_point now = clock_type::now();
+    std::deque<entry>& entries = iter->second;
+    bool found = false;
+    while (!found && !entries.empty())
+    {
+      entry e(static_cast<entry&&>(entries.back()));
+      entries.pop_back();
+      --idle_size_;
+      if (e.expiry > now && is_reusable(e.socket))
+      {
+        socket = static_cast<socket_type&&>(e.socket);
+        found = true;
+      }
+    }
+
+    if (entries.empty())
+      idle_.erase(iter);
+
+    // There is nothing left for the reaper to do.
+    if (idle_size_ == 0)
+    {
+      reaper_active_ = false;
+      timer_.cancel();
+    }
+
+    return found;
+  }
+
+  // Add a connection to the idle set, evicting the least recently used
+  // connection to the same endpoint if the limit has been reached.
+  void checkin(socket_type& socket)
+  {
+    asio::error_code ec;
+    endpoint_type endpoint = socket.remote_endpoint(ec);
+    if (ec || max_idle_ == 0)
+    {
+      socket.close(ec);
+      return;
+    }
+
+    std::deque<entry>& entries = idle_[endpoint];
+    while (entries.size() >= max_idle_)
+    {
+      entries.pop_front();
+      --idle_size_;
+    }
+
+    entries.push_back(entry(socket, clock_type::now() + idle_timeout_));
+    ++idle_size_;
+
+    if (!reaper_active_)
+      start_reaper(entries.back().expiry);
+  }
+
+  // Close all idle connections.
+  void clear()
+  {
+    idle_.clear();
+    idle_size_ = 0;
+    reaper_active_ = false;
+    timer_.cancel();
+  }
+
+private:
+  struct entry
+  {
+    entry(socket_type& s, const clock_type::time_point& t)
+      : socket(static_cast<socket_type&&>(s)),
+        expiry(t)
+    {
+    }
+
+    entry(entry&& other)
+      : socket(static_cast<socket_type&&>(other.socket)),
+        expiry(other.expiry)
+    {
+    }
+
+    entry& operator=(entry&& other)
+    {
+      socket = static_cast<socket_type&&>(other.socket);
+      expiry = other.expiry;
+      return *this;
+    }
+
+    socket_type socket;
+    clock_type::time_point expiry;
+  };
+
+  typedef std::map<endpoint_type, std::deque<entry>> idle_map;
+
+  struct reaper_handler
+  {
+    std::weak_ptr<connection_pool_state> state;
+
+    void operator()(const asio::error_code& ec)
+    {
+      if (ec == asio::error::operation_aborted)
+        return;
+      if (std::shared_ptr<connection_pool_state> s = state.lock())
+        s->reap();
+    }
+  };
+
+  // Determine whether an idle connection is still usable. A connection that
+  // the peer has closed, or on which unsolicited data has arrived, is not.
+  static bool is_reusable(socket_type& socket)
+  {
+    asio::error_code ec;
+    bool non_blocking = socket.non_blocking();
+    socket.non_blocking(true, ec);
+    if (ec)
+      return false;
+
+    char data;
+    socket.receive(asio::buffer(&data, 1), socket_base::message_peek, ec);
+    bool reusable = (ec == asio::error::would_block);
+
+    socket.non_blocking(non_blocking, ec);
+    return reusable && !ec;
+  }
+
+  void start_reaper(const clock_type::time_point& expiry)
+  {
+    reaper_active_ = true;
+    timer_.expires_at(expiry);
+    reaper_handler handler = { this->shared_from_this() };
+    timer_.async_wait(handler);
+  }
+
+  // Close all expired connections and wait for the next one to expire.
+  void reap()
+  {
+    reaper_active_ = false;
+
+    clock_type::time_point now = clock_type::now();
+    clock_type::time_point next = (clock_type::time_point::max)();
+    typename idle_map::iterator iter = idle_.begin();
+    while (iter != idle_.end())
+    {
+      std::deque<entry>& entries = iter->second;
+      while (!entries.empty() && entries.front().expiry <= now)
+      {
+        entries.pop_front();
+        --idle_size_;
+      }
+
+      if (entries.empty())
+        idle_.erase(iter++);
+      else
+      {
+        if (entries.front().expiry < next)
+          next = entries.front().expiry;
+        ++iter;
+      }
+    }
+
+    if (next != (clock_type::time_point::max)())
+      start_reaper(next);
+  }
+
+  timer_type timer_;
+  idle_map idle_;
+  std::size_t max_idle_;
+  clock_type::duration idle_timeout_;
+  std::size_t idle_size_;
+  bool reaper_active_;
+};
+
+// Completes a checkout, either with an idle connection taken from the pool or
+// by establishing a new connection.
+template <typename Protocol, typename Executor>
+class connection_pool_checkout_op
+{
+public:
+  typedef typename Protocol::endpoint endpoint_type;
+  typedef typename connection_pool_state<Protocol,
+    Executor>::socket_type socket_type;
+
+  connection_pool_checkout_op(socket_type& socket,
+      const endpoint_type& endpoint)
+    : socket_(static_cast<socket_type&&>(socket)),
+      endpoint_(endpoint)
+  {
+  }
+
+  template <typename Self>
+  void operator()(Self& self)
+  {
+    if (socket_.is_open())
+    {
+      typename Self::io_executor_type io_ex = self.get_io_executor();
+      asio::post(io_ex, asio::detail::bind_handler(
+            static_cast<Self&&>(self), asio::error_code()));
+      return;
+    }
+
+    self.reset_cancellation_state(enable_total_cancellation());
+
+    // The connecting socket is kept at a stable address while the connect
+    // operation is outstanding.
+    connecting_ = std::allocate_shared<socket_type>(
+        self.get_allocator(), socket_.get_executor());
+    connecting_->async_connect(endpoint_, static_cast<Self&&>(self));
+  }
+
+  template <typename Self>
+  void operator()(Self& self, const asio::error_code& ec)
+  {
+    if (connecting_)
+    {
+      if (!ec)
+        socket_ = static_cast<socket_type&&>(*connecting_);
+      connecting_.reset();
+    }
+
+    self.complete(ec, static_cast<socket_type&&>(socket_));
+  }
+
+private:
+  socket_type socket_;
+  endpoint_type endpoint_;
+  std::shared_ptr<socket_type> connecting_;
+};
+
+} // namespace detail
+} // namespace experimental
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_EXPERIMENTAL_DETAIL_CONNECTION_POOL_STATE_HPP
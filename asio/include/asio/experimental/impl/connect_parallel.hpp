@@ -0,0 +1,373 @@
+//
+// experimental/impl/connect_parallel.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_EXPERIMENTAL_IMPL_CONNECT_PARALLEL_HPP
+#define ASIO_EXPERIMENTAL_IMPL_CONNECT_PARALLEL_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "asio/basic_waitable_timer.hpp"
+#include "asio/bind_executor.hpp"
+#include "asio/cancellation_type.hpp"
+#include "asio/compose.hpp"
+#include "asio/deferred.hpp"
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/handler_type_requirements.hpp"
+#include "asio/detail/non_const_lvalue.hpp"
+#include "asio/experimental/cancellation_condition.hpp"
+#include "asio/experimental/parallel_group.hpp"
+#include "asio/dispatch.hpp"
+#include "asio/post.hpp"
+#include "asio/strand.hpp"
+#include "asio/wait_traits.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace experimental {
+namespace detail {
+
+// Reorders a sequence of endpoints so that address families alternate,
+// starting with the family of the first endpoint.
+template <typename Endpoint, typename EndpointSequence>
+std::vector<Endpoint> interleave_endpoint_families(
+    const EndpointSequence& endpoints)
+{
+  std::vector<Endpoint> primary;
+  std::vector<Endpoint> secondary;
+  for (auto iter = endpoints.begin(); iter != endpoints.end(); ++iter)
+  {
+    Endpoint endpoint(*iter);
+    if (primary.empty() || endpoint.protocol().family()
+        == primary.front().protocol().family())
+      primary.push_back(endpoint);
+    else
+      secondary.push_back(endpoint);
+  }
+
+  std::vector<Endpoint> result;
+  result.reserve(primary.size() + secondary.size());
+  for (std::size_t i = 0; i < primary.size() || i < secondary.size(); ++i)
+  {
+    if (i < primary.size())
+      result.push_back(primary[i]);
+    if (i < secondary.size())
+      result.push_back(secondary[i]);
+  }
+  return result;
+}
+
+// State shared between the connection attempts of a single operation. Each
+// attempt has its own socket, and all but the first have a timer that is used
+// to wait for the attempt's turn to start. The state is accessed only from
+// within the strand.
+template <typename Protocol, typename Executor>
+class connect_parallel_state
+{
+public:
+  typedef typename Protocol::endpoint endpoint_type;
+  typedef typename Protocol::socket::template
+    rebind_executor<Executor>::other socket_type;
+  typedef basic_waitable_timer<chrono::steady_clock,
+    wait_traits<chrono::steady_clock>, Executor> timer_type;
+
+  connect_parallel_state(const Executor& ex,
+      std::vector<endpoint_type> endpoints,
+      const chrono::steady_clock::duration& attempt_delay)
+    : strand_(ex),
+      endpoints_(static_cast<std::vector<endpoint_type>&&>(endpoints)),
+      ready_(endpoints_.size(), false),
+      attempt_delay_(attempt_delay)
+  {
+    sockets_.reserve(endpoints_.size());
+    timers_.reserve(endpoints_.size());
+    for (std::size_t i = 0; i < endpoints_.size(); ++i)
+    {
+      sockets_.emplace_back(ex);
+      timers_.emplace_back(ex, (chrono::steady_clock::time_point::max)());
+    }
+  }
+
+  const strand<Executor>& get_strand() const
+  {
+    return strand_;
+  }
+
+  std::size_t size() const
+  {
+    return endpoints_.size();
+  }
+
+  const endpoint_type& endpoint(std::size_t i) const
+  {
+    return endpoints_[i];
+  }
+
+  socket_type& socket(std::size_t i)
+  {
+    return sockets_[i];
+  }
+
+  timer_type& timer(std::size_t i)
+  {
+    return timers_[i];
+  }
+
+  // Determine whether the specified attempt may be started.
+  bool is_ready(std::size_t i) const
+  {
+    return i == 0 || ready_[i]
+      || timers_[i].expiry() <= chrono::steady_clock::now();
+  }
+
+  // Called when an attempt is started, to schedule the next attempt.
+  void attempt_started(std::size_t i)
+  {
+    if (i + 1 < timers_.size())
+      timers_[i + 1].expires_after(attempt_delay_);
+  }
+
+  // Called when an attempt fails, so that the next attempt is started without
+  // waiting for the remainder of its delay.
+  void attempt_failed(std::size_t i)
+  {
+    if (i + 1 < timers_.size())
+    {
+      ready_[i + 1] = true;
+      timers_[i + 1].cancel();
+    }
+  }
+
+private:
+  strand<Executor> strand_;
+  std::vector<endpoint_type> endpoints_;
+  std::vector<socket_type> sockets_;
+  std::vector<timer_type> timers_;
+  std::vector<bool> ready_;
+  chrono::steady_clock::duration attempt_delay_;
+};
+
+// A single connection attempt. The attempt waits until it is its turn to
+// start, and then connects its socket to the corresponding endpoint. The
+// attempts may complete concurrently on a multi-threaded executor, so each
+// step of an attempt runs in the shared state's strand.
+template <typename Protocol, typename Executor>
+class connect_parallel_attempt_op
+{
+public:
+  typedef connect_parallel_state<Protocol, Executor> state_type;
+
+  connect_parallel_attempt_op(const std::shared_ptr<state_type>& state,
+      std::size_t index)
+    : state_(state),
+      index_(index),
+      connecting_(false)
+  {
+  }
+
+  template <typename Self>
+  void operator()(Self& self, asio::error_code ec = asio::error_code())
+  {
+    // The shared state is kept alive by the moved-to operation, so it is
+    // accessed through a reference once self has been moved.
+    state_type& state = *state_;
+
+    if (!state.get_strand().running_in_this_thread())
+    {
+      asio::dispatch(asio::bind_executor(
+            state.get_strand(), static_cast<Self&&>(self)));
+      return;
+    }
+
+    if (connecting_)
+    {
+      if (ec)
+      {
+        asio::error_code ignored_ec;
+        state.socket(index_).close(ignored_ec);
+        if (self.cancelled() == cancellation_type::none)
+          state.attempt_failed(index_);
+      }
+      self.complete(ec);
+      return;
+    }
+
+    if (self.cancelled() != cancellation_type::none)
+    {
+      self.complete(asio::error::operation_aborted);
+      return;
+    }
+
+    // The timer wait also completes when the timer is rescheduled, or when the
+    // previous attempt fails, so the attempt's readiness is rechecked on each
+    // completion.
+    if (!state.is_ready(index_))
+    {
+      state.timer(index_).async_wait(asio::bind_executor(
+            state.get_strand(), static_cast<Self&&>(self)));
+      return;
+    }
+
+    connecting_ = true;
+    state.attempt_started(index_);
+    state.socket(index_).async_connect(state.endpoint(index_),
+        asio::bind_executor(state.get_strand(), static_cast<Self&&>(self)));
+  }
+
+private:
+  std::shared_ptr<state_type> state_;
+  std::size_t index_;
+  bool connecting_;
+};
+
+// Launches the connection attempts as a parallel group, and moves the winning
+// socket into the caller's socket object.
+template <typename Protocol, typename Executor>
+class connect_parallel_op
+{
+public:
+  typedef connect_parallel_state<Protocol, Executor> state_type;
+  typedef typename Protocol::endpoint endpoint_type;
+
+  connect_parallel_op(basic_socket<Protocol, Executor>& sock,
+      std::vector<endpoint_type> endpoints,
+      const chrono::steady_clock::duration& attempt_delay)
+    : socket_(sock),
+      endpoints_(static_cast<std::vector<endpoint_type>&&>(endpoints)),
+      attempt_delay_(attempt_delay)
+  {
+  }
+
+  template <typename Self>
+  void operator()(Self& self)
+  {
+    self.reset_cancellation_state(enable_total_cancellation());
+
+    if (endpoints_.empty())
+    {
+      typename Self::io_executor_type io_ex = self.get_io_executor();
+      asio::post(io_ex, asio::detail::bind_handler(static_cast<Self&&>(self),
+            asio::error_code(asio::error::not_found)));
+      return;
+    }
+
+    state_ = std::allocate_shared<state_type>(self.get_allocator(),
+        socket_.get_executor(),
+        static_cast<std::vector<endpoint_type>&&>(endpoints_),
+        attempt_delay_);
+
+    typedef decltype(
+        asio::async_compose<const deferred_t, void (asio::error_code)>(
+          declval<connect_parallel_attempt_op<Protocol, Executor>>(),
+          asio::deferred, declval<typename state_type::socket_type&>())
+      ) attempt_type;
+
+    std::vector<attempt_type> attempts;
+    attempts.reserve(state_->size());
+    for (std::size_t i = 0; i < state_->size(); ++i)
+    {
+      attempts.push_back(
+          asio::async_compose<const deferred_t, void (asio::error_code)>(
+            connect_parallel_attempt_op<Protocol, Executor>(state_, i),
+            asio::deferred, state_->socket(i)));
+    }
+
+    make_parallel_group(static_cast<std::vector<attempt_type>&&>(attempts))
+      .async_wait(wait_for_one_success(), static_cast<Self&&>(self));
+  }
+
+  template <typename Self>
+  void operator()(Self& self, const asio::error_code& ec)
+  {
+    self.complete(ec, endpoint_type());
+  }
+
+  template <typename Self>
+  void operator()(Self& self, std::vector<std::size_t> completion_order,
+      std::vector<asio::error_code> errors)
+  {
+    asio::error_code ec;
+    for (std::size_t i = 0; i < completion_order.size(); ++i)
+    {
+      std::size_t index = completion_order[i];
+      if (!errors[index])
+      {
+        socket_ = static_cast<typename state_type::socket_type&&>(
+            state_->socket(index));
+        self.complete(asio::error_code(), state_->endpoint(index));
+        return;
+      }
+      ec = errors[index];
+    }
+
+    self.complete(ec, endpoint_type());
+  }
+
+private:
+  basic_socket<Protocol, Executor>& socket_;
+  std::vector<endpoint_type> endpoints_;
+  chrono::steady_clock::duration attempt_delay_;
+  std::shared_ptr<state_type> state_;
+};
+
+template <typename Protocol, typename Executor>
+class initiate_async_connect_parallel
+{
+public:
+  typedef Executor executor_type;
+
+  explicit initiate_async_connect_parallel(
+      basic_socket<Protocol, Executor>& s)
+    : socket_(s)
+  {
+  }
+
+  executor_type get_executor() const noexcept
+  {
+    return socket_.get_executor();
+  }
+
+  template <typename RangeConnectHandler, typename EndpointSequence>
+  void operator()(RangeConnectHandler&& handler,
+      const EndpointSequence& endpoints,
+      const chrono::steady_clock::duration& attempt_delay) const
+  {
+    // If you get an error on the following line it means that your
+    // handler does not meet the documented type requirements for an
+    // RangeConnectHandler.
+    ASIO_RANGE_CONNECT_HANDLER_CHECK(RangeConnectHandler,
+        handler, typename Protocol::endpoint) type_check;
+
+    asio::detail::non_const_lvalue<RangeConnectHandler> handler2(handler);
+    asio::async_compose<decay_t<RangeConnectHandler>,
+      void (asio::error_code, typename Protocol::endpoint)>(
+        connect_parallel_op<Protocol, Executor>(socket_,
+          interleave_endpoint_families<typename Protocol::endpoint>(
+            endpoints), attempt_delay),
+        handler2.value, socket_);
+  }
+
+private:
+  basic_socket<Protocol, Executor>& socket_;
+};
+
+} // namespace detail
+} // namespace experimental
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_EXPERIMENTAL_IMPL_CONNECT_PARALLEL_HPP
@@ -0,0 +1,135 @@
+//
+// impl/buffer_pool.hpp
+// ~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_IMPL_BUFFER_POOL_HPP
+#define ASIO_IMPL_BUFFER_POOL_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include "asio/cancellation_type.hpp"
+#include "asio/compose.hpp"
+#include "asio/detail/non_const_lvalue.hpp"
+#include "asio/socket_base.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+template <typename AsyncReadStream>
+class read_some_pooled_op
+{
+public:
+  read_some_pooled_op(AsyncReadStream& s, buffer_pool& pool)
+    : stream_(s),
+      pool_(pool)
+  {
+  }
+
+  template <typename Self>
+  void operator()(Self& self)
+  {
+    self.reset_cancellation_state(enable_total_cancellation());
+    stream_.async_wait(socket_base::wait_read, static_cast<Self&&>(self));
+  }
+
+  template <typename Self>
+  void operator()(Self& self, asio::error_code ec)
+  {
+    if (ec)
+    {
+      self.complete(ec, pooled_buffer());
+      return;
+    }
+
+    // The stream is ready, so a block is needed only now. The read is
+    // performed as an asynchronous operation, which leaves the stream's
+    // blocking mode untouched and waits again if the readiness was spurious.
+    buffer_ = pool_.allocate();
+    stream_.async_read_some(buffer_.block(), static_cast<Self&&>(self));
+  }
+
+  template <typename Self>
+  void operator()(Self& self, asio::error_code ec, std::size_t n)
+  {
+    if (ec)
+    {
+      buffer_.reset();
+      self.complete(ec, pooled_buffer());
+      return;
+    }
+
+    buffer_.resize(n);
+    self.complete(ec, static_cast<pooled_buffer&&>(buffer_));
+  }
+
+private:
+  AsyncReadStream& stream_;
+  buffer_pool& pool_;
+  pooled_buffer buffer_;
+};
+
+template <typename AsyncReadStream>
+class initiate_async_read_some_pooled
+{
+public:
+  typedef typename AsyncReadStream::executor_type executor_type;
+
+  explicit initiate_async_read_some_pooled(AsyncReadStream& stream)
+    : stream_(stream)
+  {
+  }
+
+  executor_type get_executor() const noexcept
+  {
+    return stream_.get_executor();
+  }
+
+  template <typename ReadHandler>
+  void operator()(ReadHandler&& handler, buffer_pool* pool) const
+  {
+    non_const_lvalue<ReadHandler> handler2(handler);
+    asio::async_compose<decay_t<ReadHandler>,
+      void (asio::error_code, pooled_buffer)>(
+        read_some_pooled_op<AsyncReadStream>(stream_, *pool),
+        handler2.value, stream_);
+  }
+
+private:
+  AsyncReadStream& stream_;
+};
+
+} // namespace detail
+
+template <typename AsyncReadStream,
+    ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+      pooled_buffer)) ReadToken>
+inline auto async_read_some_pooled(AsyncReadStream& s, buffer_pool& pool,
+    ReadToken&& token)
+  -> decltype(
+    async_initiate<ReadToken,
+      void (asio::error_code, pooled_buffer)>(
+        declval<detail::initiate_async_read_some_pooled<AsyncReadStream>>(),
+        token, declval<buffer_pool*>()))
+{
+  return async_initiate<ReadToken,
+    void (asio::error_code, pooled_buffer)>(
+      detail::initiate_async_read_some_pooled<AsyncReadStream>(s),
+      token, &pool);
+}
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_IMPL_BUFFER_POOL_HPP
@@ -19,6 +19,7 @@
 #include "asio/associated_executor.hpp"
 #include "asio/async_result.hpp"
 #include "asio/detail/initiation_base.hpp"
+#include "asio/detail/linked_timeout_handler.hpp"
 #include "asio/detail/timed_cancel_op.hpp"
 
 #include "asio/detail/push_options.hpp"
@@ -37,26 +38,28 @@ struct initiate_cancel_after : initiation_base<Initiation>
       const chrono::duration<Rep, Period>& timeout,
       cancellation_type_t cancel_type, Args&&... args) &&
   {
-    using op = detail::timed_cancel_op<decay_t<Handler>,
-        basic_waitable_timer<Clock, WaitTraits>, Signatures...>;
-
-    non_const_lvalue<Handler> handler2(handler);
-    typename op::ptr p = { asio::detail::addressof(handler2.value),
-        op::ptr::allocate(handler2.value), 0 };
-    p.p = new (p.v) op(handler2.value,
-        basic_waitable_timer<Clock, WaitTraits,
-          typename Initiation::executor_type>(this->get_executor(), timeout),
-        cancel_type);
-
-    op* o = p.p;
-    p.v = p.p = 0;
-    o->start(static_cast<Initiation&&>(*this), static_cast<Args&&>(args)...);
+    this->initiate(supports_linked_timeout<Initiation>(),
+        static_cast<Initiation&&>(*this), static_cast<Handler&&>(handler),
+        timeout, cancel_type, static_cast<Args&&>(args)...);
   }
 
   template <typename Handler, typename Rep, typename Period, typename... Args>
   void operator()(Handler&& handler,
       const chrono::duration<Rep, Period>& timeout,
       cancellation_type_t cancel_type, Args&&... args) const &
+  {
+    this->initiate(supports_linked_timeout<Initiation>(),
+        static_cast<const Initiation&>(*this),
+        static_cast<Handler&&>(handler), timeout, cancel_type,
+        static_cast<Args&&>(args)...);
+  }
+
+private:
+  template <typename Init, typename Handler,
+      typename Rep, typename Period, typename... Args>
+  static void initiate(false_type, Init&& initiation, Handler&& handler,
+      const chrono::duration<Rep, Period>& timeout,
+      cancellation_type_t cancel_type, Args&&... args)
   {
     using op = detail::timed_cancel_op<decay_t<Handler>,
         basic_waitable_timer<Clock, WaitTraits>, Signatures...>;
@@ -66,12 +69,41 @@ struct initiate_cancel_after : initiation_base<Initiation>
         op::ptr::allocate(handler2.value), 0 };
     p.p = new (p.v) op(handler2.value,
         basic_waitable_timer<Clock, WaitTraits,
-          typename Initiation::executor_type>(this->get_executor(), timeout),
+          typename Initiation::executor_type>(
+            initiation.get_executor(), timeout),
         cancel_type);
 
     op* o = p.p;
     p.v = p.p = 0;
-    o->start(static_cast<const Initiation&>(*this),
+    o->start(static_cast<Init&&>(initiation), static_cast<Args&&>(args)...);
+  }
+
+  // The initiation is able to enforce the deadline itself, so hand it the
+  // handler together with the deadline rather than starting a timer. The
+  // deadline cancels the operation outright, so it is used only when terminal
+  // cancellation is permitted. It is also used only when the operation will be
+  // submitted immediately, as an operation queued behind others on the same
+  // object would not have its deadline armed until it reached the front.
+  template <typename Init, typename Handler,
+      typename Rep, typename Period, typename... Args>
+  static void initiate(true_type, Init&& initiation, Handler&& handler,
+      const chrono::duration<Rep, Period>& timeout,
+      cancellation_type_t cancel_type, Args&&... args)
+  {
+    if ((cancel_type & cancellation_type::terminal)
+        == cancellation_type::none
+        || !initiation.linked_timeout_available(args...))
+    {
+      return initiate(false_type(), static_cast<Init&&>(initiation),
+          static_cast<Handler&&>(handler), timeout, cancel_type,
+          static_cast<Args&&>(args)...);
+    }
+
+    linked_timeout_handler<decay_t<Handler>> handler2(
+        static_cast<Handler&&>(handler), linked_timeout_deadline(timeout));
+
+    async_initiate<linked_timeout_handler<decay_t<Handler>>, Signatures...>(
+        static_cast<Init&&>(initiation), handler2,
         static_cast<Args&&>(args)...);
   }
 };
@@ -0,0 +1,419 @@
+//
+// impl/coalescing_write_stream.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_IMPL_COALESCING_WRITE_STREAM_HPP
+#define ASIO_IMPL_COALESCING_WRITE_STREAM_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/compose.hpp"
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/handler_type_requirements.hpp"
+#include "asio/detail/non_const_lvalue.hpp"
+#include "asio/dispatch.hpp"
+#include "asio/post.hpp"
+#include "asio/write.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+template <typename Stream>
+class coalescing_timer_handler
+{
+public:
+  explicit coalescing_timer_handler(
+      const std::shared_ptr<coalescing_write_stream<Stream>*>& stream)
+    : stream_(stream)
+  {
+  }
+
+  void operator()(const asio::error_code& ec)
+  {
+    if (coalescing_write_stream<Stream>* stream = *stream_)
+      stream->handle_timer(ec);
+  }
+
+private:
+  std::shared_ptr<coalescing_write_stream<Stream>*> stream_;
+};
+
+template <typename Stream>
+class coalescing_write_handler
+{
+public:
+  coalescing_write_handler(
+      const std::shared_ptr<coalescing_write_stream<Stream>*>& stream,
+      const std::shared_ptr<std::vector<unsigned char>>& buffer)
+    : stream_(stream),
+      buffer_(buffer)
+  {
+  }
+
+  void operator()(const asio::error_code& ec, std::size_t n)
+  {
+    if (coalescing_write_stream<Stream>* stream = *stream_)
+      stream->handle_write(ec, n);
+  }
+
+private:
+  std::shared_ptr<coalescing_write_stream<Stream>*> stream_;
+  std::shared_ptr<std::vector<unsigned char>> buffer_;
+};
+
+template <typename Stream, typename ConstBufferSequence>
+class coalescing_write_some_op
+{
+public:
+  coalescing_write_some_op(coalescing_write_stream<Stream>& stream,
+      const ConstBufferSequence& buffers)
+    : stream_(stream),
+      buffers_(buffers)
+  {
+  }
+
+  template <typename Self>
+  void operator()(Self& self)
+  {
+    stream_.write_some(buffers_, self);
+  }
+
+  // Called when space may have become available in the buffer.
+  template <typename Self>
+  void operator()(Self& self, const asio::error_code&)
+  {
+    stream_.write_some(buffers_, self);
+  }
+
+  template <typename Self>
+  void operator()(Self& self, const asio::error_code& ec, std::size_t n)
+  {
+    self.complete(ec, n);
+  }
+
+private:
+  coalescing_write_stream<Stream>& stream_;
+  ConstBufferSequence buffers_;
+};
+
+template <typename Stream>
+class coalescing_flush_op
+{
+public:
+  explicit coalescing_flush_op(coalescing_write_stream<Stream>& stream)
+    : stream_(stream)
+  {
+  }
+
+  template <typename Self>
+  void operator()(Self& self)
+  {
+    stream_.flush(self);
+  }
+
+  template <typename Self>
+  void operator()(Self& self, const asio::error_code& ec, std::size_t n)
+  {
+    self.complete(ec, n);
+  }
+
+private:
+  coalescing_write_stream<Stream>& stream_;
+};
+
+template <typename Stream>
+class initiate_async_coalescing_write_some
+{
+public:
+  typedef typename coalescing_write_stream<Stream>::executor_type
+    executor_type;
+
+  explicit initiate_async_coalescing_write_some(
+      coalescing_write_stream<Stream>& stream)
+    : stream_(stream)
+  {
+  }
+
+  executor_type get_executor() const noexcept
+  {
+    return stream_.get_executor();
+  }
+
+  template <typename WriteHandler, typename ConstBufferSequence>
+  void operator()(WriteHandler&& handler,
+      const ConstBufferSequence& buffers) const
+  {
+    // If you get an error on the following line it means that your handler
+    // does not meet the documented type requirements for a WriteHandler.
+    ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+    non_const_lvalue<WriteHandler> handler2(handler);
+    asio::async_compose<decay_t<WriteHandler>,
+      void (asio::error_code, std::size_t)>(
+        coalescing_write_some_op<Stream, ConstBufferSequence>(
+          stream_, buffers), handler2.value, stream_.next_layer());
+  }
+
+private:
+  coalescing_write_stream<Stream>& stream_;
+};
+
+template <typename Stream>
+class initiate_async_coalescing_flush
+{
+public:
+  typedef typename coalescing_write_stream<Stream>::executor_type
+    executor_type;
+
+  explicit initiate_async_coalescing_flush(
+      coalescing_write_stream<Stream>& stream)
+    : stream_(stream)
+  {
+  }
+
+  executor_type get_executor() const noexcept
+  {
+    return stream_.get_executor();
+  }
+
+  template <typename WriteHandler>
+  void operator()(WriteHandler&& handler) const
+  {
+    // If you get an error on the following line it means that your handler
+    // does not meet the documented type requirements for a WriteHandler.
+    ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+    non_const_lvalue<WriteHandler> handler2(handler);
+    asio::async_compose<decay_t<WriteHandler>,
+      void (asio::error_code, std::size_t)>(
+        coalescing_flush_op<Stream>(stream_),
+        handler2.value, stream_.next_layer());
+  }
+
+private:
+  coalescing_write_stream<Stream>& stream_;
+};
+
+} // namespace detail
+
+template <typename Stream>
+template <
+    ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+      std::size_t)) WriteToken>
+inline auto coalescing_write_stream<Stream>::async_flush(WriteToken&& token)
+  -> decltype(
+    async_initiate<WriteToken,
+      void (asio::error_code, std::size_t)>(
+        declval<detail::initiate_async_coalescing_flush<Stream>>(),
+        token))
+{
+  return async_initiate<WriteToken,
+    void (asio::error_code, std::size_t)>(
+      detail::initiate_async_coalescing_flush<Stream>(*this), token);
+}
+
+template <typename Stream>
+template <typename ConstBufferSequence,
+    ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+      std::size_t)) WriteToken>
+inline auto coalescing_write_stream<Stream>::async_write_some(
+    const ConstBufferSequence& buffers, WriteToken&& token)
+  -> decltype(
+    async_initiate<WriteToken,
+      void (asio::error_code, std::size_t)>(
+        declval<detail::initiate_async_coalescing_write_some<Stream>>(),
+        token, buffers))
+{
+  return async_initiate<WriteToken,
+    void (asio::error_code, std::size_t)>(
+      detail::initiate_async_coalescing_write_some<Stream>(*this),
+      token, buffers);
+}
+
+template <typename Stream>
+template <typename ConstBufferSequence, typename Handler>
+void coalescing_write_stream<Stream>::write_some(
+    const ConstBufferSequence& buffers, Handler& handler)
+{
+  std::size_t bytes_copied = 0;
+  if (!error_)
+  {
+    std::size_t size = asio::buffer_size(buffers);
+    std::size_t space = flush_threshold_ - pending_.size();
+    if (size > 0 && space == 0)
+    {
+      // The buffer can only be full while a write is in progress. The write
+      // operation is resumed when the write completes.
+      write_waiters_.push_back(
+          any_completion_handler<void (asio::error_code)>(
+            static_cast<Handler&&>(handler)));
+      return;
+    }
+
+    if (size > 0)
+    {
+      if (pending_.empty())
+        deadline_ = clock_type::now() + max_latency_;
+
+      std::size_t orig_size = pending_.size();
+      std::size_t length = size < space ? size : space;
+      pending_.resize(orig_size + length);
+      bytes_copied = asio::buffer_copy(
+          asio::buffer(&pending_[orig_size], length), buffers, length);
+      bytes_buffered_ += bytes_copied;
+
+      if (pending_.size() >= flush_threshold_)
+        start_write();
+      else
+        start_timer();
+    }
+  }
+
+  // The handler is always posted, so that an operation that completes
+  // immediately is not completed inside the initiating function.
+  asio::post(next_layer_.get_executor(),
+      asio::detail::bind_handler(static_cast<Handler&&>(handler),
+        error_, bytes_copied));
+}
+
+template <typename Stream>
+template <typename Handler>
+void coalescing_write_stream<Stream>::flush(Handler& handler)
+{
+  std::size_t size = pending();
+  if (error_ || size == 0)
+  {
+    asio::post(next_layer_.get_executor(),
+        asio::detail::bind_handler(static_cast<Handler&&>(handler),
+          error_, std::size_t(0)));
+    return;
+  }
+
+  flush_waiters_.push_back(
+      flush_waiter(size, bytes_buffered_,
+        handler_type(static_cast<Handler&&>(handler))));
+  start_write();
+}
+
+template <typename Stream>
+void coalescing_write_stream<Stream>::start_write()
+{
+  if (writing_ || pending_.empty())
+    return;
+
+  // Swap the buffers, so that further writes are copied into the buffer that
+  // was used for the previous write.
+  writing_ = true;
+  writing_buffer_->swap(pending_);
+  asio::async_write(next_layer_, asio::buffer(*writing_buffer_),
+      detail::coalescing_write_handler<Stream>(self_, writing_buffer_));
+}
+
+template <typename Stream>
+void coalescing_write_stream<Stream>::start_timer()
+{
+  if (timer_active_ || pending_.empty())
+    return;
+
+  // If the timer expires for data that has already been written, it is simply
+  // rearmed for the new deadline.
+  timer_active_ = true;
+  timer_.expires_at(deadline_);
+  timer_.async_wait(detail::coalescing_timer_handler<Stream>(self_));
+}
+
+template <typename Stream>
+void coalescing_write_stream<Stream>::handle_timer(const asio::error_code& ec)
+{
+  timer_active_ = false;
+  if (ec || error_ || pending_.empty())
+    return;
+
+  if (clock_type::now() >= deadline_)
+  {
+    // If a write is in progress, the data is written when it completes.
+    start_write();
+  }
+  else
+  {
+    start_timer();
+  }
+}
+
+template <typename Stream>
+void coalescing_write_stream<Stream>::handle_write(
+    const asio::error_code& ec, std::size_t n)
+{
+  writing_ = false;
+  writing_buffer_->clear();
+  bytes_written_ += n;
+
+  // Complete the flushes whose data has now been written, in order. If the
+  // write failed, all flushes complete.
+  std::vector<flush_waiter> completed;
+  while (!flush_waiters_.empty())
+  {
+    flush_waiter& f = flush_waiters_.front();
+    uint64_t remaining = f.target > bytes_written_
+      ? f.target - bytes_written_ : 0;
+    if (remaining > 0 && !ec)
+      break;
+    f.size -= static_cast<std::size_t>(remaining);
+    completed.push_back(static_cast<flush_waiter&&>(f));
+    flush_waiters_.pop_front();
+  }
+
+  if (ec)
+  {
+    // The buffered data can no longer be written, and all current and future
+    // operations fail with the error.
+    error_ = ec;
+    pending_.clear();
+    timer_.cancel();
+  }
+  else if (!pending_.empty())
+  {
+    // Write the next buffer immediately if it is full, if a flush is waiting
+    // for it, or if its oldest byte has already reached the latency bound.
+    if (pending_.size() >= flush_threshold_ || !flush_waiters_.empty()
+        || clock_type::now() >= deadline_)
+      start_write();
+    else
+      start_timer();
+  }
+
+  std::deque<any_completion_handler<void (asio::error_code)>> waiters;
+  waiters.swap(write_waiters_);
+
+  // The state has been updated, so the handlers may now be called. They may
+  // start new operations on the stream.
+  for (std::size_t i = 0; i < completed.size(); ++i)
+  {
+    flush_waiter& f = completed[i];
+    asio::dispatch(asio::detail::bind_handler(
+          static_cast<handler_type&&>(f.handler), ec, f.size));
+  }
+
+  for (std::size_t i = 0; i < waiters.size(); ++i)
+  {
+    asio::dispatch(asio::detail::bind_handler(
+          static_cast<any_completion_handler<void (asio::error_code)>&&>(
+            waiters[i]), ec));
+  }
+}
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_IMPL_COALESCING_WRITE_STREAM_HPP
@@ -412,6 +412,178 @@ namespace detail
     basic_socket<Protocol, Executor>& socket_;
   };
 
+#if defined(ASIO_HAS_TCP_FASTOPEN)
+  template <typename Protocol, typename Executor, typename EndpointSequence,
+      typename ConstBufferSequence, typename RangeConnectHandler>
+  class range_connect_with_data_op
+    : public base_from_cancellation_state<RangeConnectHandler>
+  {
+  public:
+    range_connect_with_data_op(basic_stream_socket<Protocol, Executor>& sock,
+        const EndpointSequence& endpoints,
+        const ConstBufferSequence& initial_data,
+        RangeConnectHandler& handler)
+      : base_from_cancellation_state<RangeConnectHandler>(
+          handler, enable_partial_cancellation()),
+        socket_(sock),
+        endpoints_(endpoints),
+        initial_data_(initial_data),
+        index_(0),
+        start_(0),
+        handler_(static_cast<RangeConnectHandler&&>(handler))
+    {
+    }
+
+    range_connect_with_data_op(const range_connect_with_data_op& other)
+      : base_from_cancellation_state<RangeConnectHandler>(other),
+        socket_(other.socket_),
+        endpoints_(other.endpoints_),
+        initial_data_(other.initial_data_),
+        index_(other.index_),
+        start_(other.start_),
+        handler_(other.handler_)
+    {
+    }
+
+    range_connect_with_data_op(range_connect_with_data_op&& other)
+      : base_from_cancellation_state<RangeConnectHandler>(
+          static_cast<base_from_cancellation_state<RangeConnectHandler>&&>(
+            other)),
+        socket_(other.socket_),
+        endpoints_(other.endpoints_),
+        initial_data_(other.initial_data_),
+        index_(other.index_),
+        start_(other.start_),
+        handler_(static_cast<RangeConnectHandler&&>(other.handler_))
+    {
+    }
+
+    void operator()(asio::error_code ec,
+        std::size_t bytes_transferred, int start = 0)
+    {
+      this->process(ec, bytes_transferred, start,
+          const_cast<const EndpointSequence&>(endpoints_).begin(),
+          const_cast<const EndpointSequence&>(endpoints_).end());
+    }
+
+  //private:
+    template <typename Iterator>
+    void process(asio::error_code ec, std::size_t bytes_transferred,
+        int start, Iterator begin, Iterator end)
+    {
+      Iterator iter = begin;
+      std::advance(iter, index_);
+
+      switch (start_ = start)
+      {
+        case 1:
+        for (;;)
+        {
+          if (iter != end)
+          {
+            socket_.close(ec);
+            ASIO_HANDLER_LOCATION((__FILE__, __LINE__, "async_connect"));
+            socket_.async_connect(*iter, initial_data_,
+                static_cast<range_connect_with_data_op&&>(*this));
+            return;
+          }
+
+          if (start)
+          {
+            ec = asio::error::not_found;
+            ASIO_HANDLER_LOCATION((__FILE__, __LINE__, "async_connect"));
+            asio::post(socket_.get_executor(),
+                detail::bind_handler(
+                  static_cast<range_connect_with_data_op&&>(*this),
+                  ec, std::size_t(0)));
+            return;
+          }
+
+          /* fall-through */ default:
+
+          if (iter == end)
+            break;
+
+          if (!socket_.is_open())
+          {
+            ec = asio::error::operation_aborted;
+            break;
+          }
+
+          if (!ec)
+            break;
+
+          if (this->cancelled() != cancellation_type::none)
+          {
+            ec = asio::error::operation_aborted;
+            break;
+          }
+
+          ++iter;
+          ++index_;
+        }
+
+        static_cast<RangeConnectHandler&&>(handler_)(
+            static_cast<const asio::error_code&>(ec),
+            static_cast<const typename Protocol::endpoint&>(
+              ec || iter == end ? typename Protocol::endpoint() : *iter),
+            static_cast<std::size_t>(ec ? 0 : bytes_transferred));
+      }
+    }
+
+    basic_stream_socket<Protocol, Executor>& socket_;
+    EndpointSequence endpoints_;
+    ConstBufferSequence initial_data_;
+    std::size_t index_;
+    int start_;
+    RangeConnectHandler handler_;
+  };
+
+  template <typename Protocol, typename Executor, typename EndpointSequence,
+      typename ConstBufferSequence, typename RangeConnectHandler>
+  inline bool asio_handler_is_continuation(
+      range_connect_with_data_op<Protocol, Executor, EndpointSequence,
+        ConstBufferSequence, RangeConnectHandler>* this_handler)
+  {
+    return asio_handler_cont_helpers::is_continuation(
+        this_handler->handler_);
+  }
+
+  template <typename Protocol, typename Executor>
+  class initiate_async_range_connect_with_data
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_range_connect_with_data(
+        basic_stream_socket<Protocol, Executor>& s)
+      : socket_(s)
+    {
+    }
+
+    executor_type get_executor() const noexcept
+    {
+      return socket_.get_executor();
+    }
+
+    template <typename RangeConnectHandler,
+        typename EndpointSequence, typename ConstBufferSequence>
+    void operator()(RangeConnectHandler&& handler,
+        const EndpointSequence& endpoints,
+        const ConstBufferSequence& initial_data) const
+    {
+      non_const_lvalue<RangeConnectHandler> handler2(handler);
+      range_connect_with_data_op<Protocol, Executor, EndpointSequence,
+        ConstBufferSequence, decay_t<RangeConnectHandler>>(socket_,
+          endpoints, initial_data, handler2.value)(
+            asio::error_code(), 0, 1);
+    }
+
+  private:
+    basic_stream_socket<Protocol, Executor>& socket_;
+  };
+#endif // defined(ASIO_HAS_TCP_FASTOPEN)
+
   template <typename Protocol, typename Executor, typename Iterator,
       typename ConnectCondition, typename IteratorConnectHandler>
   class iterator_connect_op
@@ -605,6 +777,41 @@ struct associator<Associator,
   }
 };
 
+#if defined(ASIO_HAS_TCP_FASTOPEN)
+
+template <template <typename, typename> class Associator,
+    typename Protocol, typename Executor, typename EndpointSequence,
+    typename ConstBufferSequence, typename RangeConnectHandler,
+    typename DefaultCandidate>
+struct associator<Associator,
+    detail::range_connect_with_data_op<Protocol, Executor,
+      EndpointSequence, ConstBufferSequence, RangeConnectHandler>,
+    DefaultCandidate>
+  : Associator<RangeConnectHandler, DefaultCandidate>
+{
+  static typename Associator<RangeConnectHandler, DefaultCandidate>::type get(
+      const detail::range_connect_with_data_op<Protocol, Executor,
+        EndpointSequence, ConstBufferSequence, RangeConnectHandler>& h)
+    noexcept
+  {
+    return Associator<RangeConnectHandler, DefaultCandidate>::get(h.handler_);
+  }
+
+  static auto get(
+      const detail::range_connect_with_data_op<Protocol, Executor,
+        EndpointSequence, ConstBufferSequence, RangeConnectHandler>& h,
+      const DefaultCandidate& c) noexcept
+    -> decltype(
+      Associator<RangeConnectHandler, DefaultCandidate>::get(
+        h.handler_, c))
+  {
+    return Associator<RangeConnectHandler, DefaultCandidate>::get(
+        h.handler_, c);
+  }
+};
+
+#endif // defined(ASIO_HAS_TCP_FASTOPEN)
+
 template <template <typename, typename> class Associator,
     typename Protocol, typename Executor, typename Iterator,
     typename ConnectCondition, typename IteratorConnectHandler,
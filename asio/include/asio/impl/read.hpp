@@ -16,6 +16,7 @@
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
 #include <algorithm>
+#include "asio/associated_allocator.hpp"
 #include "asio/associator.hpp"
 #include "asio/buffer.hpp"
 #include "asio/detail/array_fwd.hpp"
@@ -28,6 +29,7 @@
 #include "asio/detail/handler_tracking.hpp"
 #include "asio/detail/handler_type_requirements.hpp"
 #include "asio/detail/non_const_lvalue.hpp"
+#include "asio/detail/recycling_allocator.hpp"
 #include "asio/detail/throw_error.hpp"
 #include "asio/error.hpp"
 
@@ -354,7 +356,10 @@ namespace detail
           handler, enable_partial_cancellation()),
         base_from_completion_cond<CompletionCondition>(completion_condition),
         stream_(stream),
-        buffers_(buffers),
+        buffers_(buffers,
+            get_recycling_allocator<associated_allocator_t<ReadHandler>,
+              thread_info_base::default_tag>::get(
+                asio::get_associated_allocator(handler))),
         start_(0),
         handler_(static_cast<ReadHandler&&>(handler))
     {
@@ -411,6 +416,7 @@ namespace detail
           }
         }
 
+        buffers_.release();
         static_cast<ReadHandler&&>(handler_)(
             static_cast<const asio::error_code&>(ec),
             static_cast<const std::size_t&>(buffers_.total_consumed()));
@@ -418,8 +424,12 @@ namespace detail
     }
 
   //private:
+    typedef typename get_recycling_allocator<
+        associated_allocator_t<ReadHandler>,
+        thread_info_base::default_tag>::type buffers_allocator_type;
     typedef asio::detail::consuming_buffers<mutable_buffer,
-        MutableBufferSequence, MutableBufferIterator> buffers_type;
+        MutableBufferSequence, MutableBufferIterator,
+        buffers_allocator_type> buffers_type;
 
     AsyncReadStream& stream_;
     buffers_type buffers_;
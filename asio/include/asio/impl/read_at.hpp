@@ -16,6 +16,7 @@
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
 #include <algorithm>
+#include "asio/associated_allocator.hpp"
 #include "asio/associator.hpp"
 #include "asio/buffer.hpp"
 #include "asio/detail/array_fwd.hpp"
@@ -28,6 +29,7 @@
 #include "asio/detail/handler_tracking.hpp"
 #include "asio/detail/handler_type_requirements.hpp"
 #include "asio/detail/non_const_lvalue.hpp"
+#include "asio/detail/recycling_allocator.hpp"
 #include "asio/detail/throw_error.hpp"
 #include "asio/error.hpp"
 
@@ -197,7 +199,10 @@ namespace detail
         base_from_completion_cond<CompletionCondition>(completion_condition),
         device_(device),
         offset_(offset),
-        buffers_(buffers),
+        buffers_(buffers,
+            get_recycling_allocator<associated_allocator_t<ReadHandler>,
+              thread_info_base::default_tag>::get(
+                asio::get_associated_allocator(handler))),
         start_(0),
         handler_(static_cast<ReadHandler&&>(handler))
     {
@@ -257,6 +262,7 @@ namespace detail
           }
         }
 
+        buffers_.release();
         static_cast<ReadHandler&&>(handler_)(
             static_cast<const asio::error_code&>(ec),
             static_cast<const std::size_t&>(buffers_.total_consumed()));
@@ -264,8 +270,12 @@ namespace detail
     }
 
   //private:
+    typedef typename get_recycling_allocator<
+        associated_allocator_t<ReadHandler>,
+        thread_info_base::default_tag>::type buffers_allocator_type;
     typedef asio::detail::consuming_buffers<mutable_buffer,
-        MutableBufferSequence, MutableBufferIterator> buffers_type;
+        MutableBufferSequence, MutableBufferIterator,
+        buffers_allocator_type> buffers_type;
 
     AsyncRandomAccessReadDevice& device_;
     uint64_t offset_;
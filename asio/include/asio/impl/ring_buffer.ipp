@@ -0,0 +1,109 @@
+//
+// impl/ring_buffer.ipp
+// ~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_IMPL_RING_BUFFER_IPP
+#define ASIO_IMPL_RING_BUFFER_IPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_MEMFD)
+
+#include <cerrno>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "asio/detail/throw_error.hpp"
+#include "asio/error.hpp"
+#include "asio/ring_buffer.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+
+ring_buffer::ring_buffer(std::size_t capacity)
+  : data_(0),
+    capacity_(0),
+    head_(0),
+    size_(0)
+{
+  std::size_t page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  if (capacity == 0)
+    capacity = page_size;
+  else if (capacity > (std::numeric_limits<std::size_t>::max)() / 2
+      - page_size)
+  {
+    std::length_error ex("ring_buffer too long");
+    asio::detail::throw_exception(ex);
+  }
+  capacity = (capacity + page_size - 1) / page_size * page_size;
+
+  int fd = ::memfd_create("asio_ring_buffer", MFD_CLOEXEC);
+  if (fd == -1)
+  {
+    asio::error_code ec(errno,
+        asio::error::get_system_category());
+    asio::detail::throw_error(ec, "memfd_create");
+  }
+
+  if (::ftruncate(fd, static_cast<off_t>(capacity)) == -1)
+  {
+    asio::error_code ec(errno,
+        asio::error::get_system_category());
+    ::close(fd);
+    asio::detail::throw_error(ec, "ftruncate");
+  }
+
+  // Reserve a region of address space large enough for both mappings, and
+  // then map the file into each half of it.
+  void* base = ::mmap(0, capacity * 2,
+      PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (base == MAP_FAILED)
+  {
+    asio::error_code ec(errno,
+        asio::error::get_system_category());
+    ::close(fd);
+    asio::detail::throw_error(ec, "mmap");
+  }
+
+  char* first = static_cast<char*>(base);
+  if (::mmap(first, capacity, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED
+      || ::mmap(first + capacity, capacity, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+  {
+    asio::error_code ec(errno,
+        asio::error::get_system_category());
+    ::munmap(base, capacity * 2);
+    ::close(fd);
+    asio::detail::throw_error(ec, "mmap");
+  }
+
+  // The mappings keep the memory alive after the descriptor is closed.
+  ::close(fd);
+
+  data_ = first;
+  capacity_ = capacity;
+}
+
+ring_buffer::~ring_buffer()
+{
+  ::munmap(data_, capacity_ * 2);
+}
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_MEMFD)
+
+#endif // ASIO_IMPL_RING_BUFFER_IPP
@@ -0,0 +1,234 @@
+//
+// impl/splice.hpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_IMPL_SPLICE_HPP
+#define ASIO_IMPL_SPLICE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/associator.hpp"
+#include "asio/connect_pipe.hpp"
+#include "asio/post.hpp"
+#include "asio/detail/base_from_cancellation_state.hpp"
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/handler_cont_helpers.hpp"
+#include "asio/detail/handler_tracking.hpp"
+#include "asio/detail/handler_type_requirements.hpp"
+#include "asio/detail/non_const_lvalue.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+
+namespace detail
+{
+  template <typename FromStream, typename ToStream, typename SpliceHandler>
+  class splice_op
+    : public base_from_cancellation_state<SpliceHandler>
+  {
+  public:
+    typedef typename FromStream::executor_type pipe_executor_type;
+
+    splice_op(FromStream& from, ToStream& to,
+        std::size_t max_bytes, SpliceHandler& handler)
+      : base_from_cancellation_state<SpliceHandler>(
+          handler, enable_partial_cancellation()),
+        from_(from),
+        to_(to),
+        pipe_read_(from.get_executor()),
+        pipe_write_(from.get_executor()),
+        max_bytes_(max_bytes),
+        pipe_bytes_(0),
+        total_transferred_(0),
+        start_(0),
+        handler_(static_cast<SpliceHandler&&>(handler))
+    {
+    }
+
+    splice_op(splice_op&& other)
+      : base_from_cancellation_state<SpliceHandler>(
+          static_cast<base_from_cancellation_state<SpliceHandler>&&>(other)),
+        from_(other.from_),
+        to_(other.to_),
+        pipe_read_(static_cast<basic_readable_pipe<pipe_executor_type>&&>(
+              other.pipe_read_)),
+        pipe_write_(static_cast<basic_writable_pipe<pipe_executor_type>&&>(
+              other.pipe_write_)),
+        max_bytes_(other.max_bytes_),
+        pipe_bytes_(other.pipe_bytes_),
+        total_transferred_(other.total_transferred_),
+        start_(other.start_),
+        handler_(static_cast<SpliceHandler&&>(other.handler_))
+    {
+    }
+
+    void operator()(asio::error_code ec,
+        std::size_t bytes_transferred, int start = 0)
+    {
+      switch (start_ = start)
+      {
+        case 1:
+        if (max_bytes_ != 0)
+          asio::connect_pipe(pipe_read_, pipe_write_, ec);
+        if (ec || max_bytes_ == 0)
+        {
+          ASIO_HANDLER_LOCATION((__FILE__, __LINE__, "async_splice"));
+          asio::post(from_.get_executor(),
+              detail::bind_handler(
+                static_cast<splice_op&&>(*this), ec, std::size_t(0)));
+          return;
+        }
+        for (;;)
+        {
+          {
+            ASIO_HANDLER_LOCATION((__FILE__, __LINE__, "async_splice"));
+            if (pipe_bytes_ == 0)
+            {
+              from_.async_splice_to_pipe(pipe_write_,
+                  max_bytes_ - total_transferred_,
+                  static_cast<splice_op&&>(*this));
+            }
+            else
+            {
+              to_.async_splice_from_pipe(pipe_read_,
+                  pipe_bytes_, static_cast<splice_op&&>(*this));
+            }
+          }
+          return; default:
+          if (!pipe_write_.is_open())
+          {
+            // The pipe could not be created, or there was nothing to move.
+            break;
+          }
+          if (pipe_bytes_ == 0)
+          {
+            // Data has been moved from the source socket into the pipe.
+            if (ec)
+              break;
+            if (bytes_transferred == 0)
+            {
+              ec = error::eof;
+              break;
+            }
+            pipe_bytes_ = bytes_transferred;
+          }
+          else
+          {
+            // Data has been moved from the pipe to the destination socket.
+            pipe_bytes_ -= bytes_transferred;
+            total_transferred_ += bytes_transferred;
+            if (ec)
+              break;
+            if (pipe_bytes_ == 0 && total_transferred_ == max_bytes_)
+              break;
+          }
+          if (this->cancelled() != cancellation_type::none)
+          {
+            ec = error::operation_aborted;
+            break;
+          }
+        }
+
+        static_cast<SpliceHandler&&>(handler_)(
+            static_cast<const asio::error_code&>(ec),
+            static_cast<const std::size_t&>(total_transferred_));
+      }
+    }
+
+  //private:
+    FromStream& from_;
+    ToStream& to_;
+    basic_readable_pipe<pipe_executor_type> pipe_read_;
+    basic_writable_pipe<pipe_executor_type> pipe_write_;
+    std::size_t max_bytes_;
+    std::size_t pipe_bytes_;
+    std::size_t total_transferred_;
+    int start_;
+    SpliceHandler handler_;
+  };
+
+  template <typename FromStream, typename ToStream, typename SpliceHandler>
+  inline bool asio_handler_is_continuation(
+      splice_op<FromStream, ToStream, SpliceHandler>* this_handler)
+  {
+    return this_handler->start_ == 0 ? true
+      : asio_handler_cont_helpers::is_continuation(
+          this_handler->handler_);
+  }
+
+  template <typename FromStream>
+  class initiate_async_splice
+  {
+  public:
+    typedef typename FromStream::executor_type executor_type;
+
+    explicit initiate_async_splice(FromStream& from)
+      : from_(from)
+    {
+    }
+
+    executor_type get_executor() const noexcept
+    {
+      return from_.get_executor();
+    }
+
+    template <typename SpliceHandler, typename ToStream>
+    void operator()(SpliceHandler&& handler,
+        ToStream* to, std::size_t max_bytes) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a WriteHandler.
+      ASIO_WRITE_HANDLER_CHECK(SpliceHandler, handler) type_check;
+
+      non_const_lvalue<SpliceHandler> handler2(handler);
+      splice_op<FromStream, ToStream, decay_t<SpliceHandler>>(
+          from_, *to, max_bytes, handler2.value)(
+            asio::error_code(), 0, 1);
+    }
+
+  private:
+    FromStream& from_;
+  };
+} // namespace detail
+
+#if !defined(GENERATING_DOCUMENTATION)
+
+template <template <typename, typename> class Associator,
+    typename FromStream, typename ToStream,
+    typename SpliceHandler, typename DefaultCandidate>
+struct associator<Associator,
+    detail::splice_op<FromStream, ToStream, SpliceHandler>,
+    DefaultCandidate>
+  : Associator<SpliceHandler, DefaultCandidate>
+{
+  static typename Associator<SpliceHandler, DefaultCandidate>::type get(
+      const detail::splice_op<FromStream, ToStream, SpliceHandler>& h) noexcept
+  {
+    return Associator<SpliceHandler, DefaultCandidate>::get(h.handler_);
+  }
+
+  static auto get(
+      const detail::splice_op<FromStream, ToStream, SpliceHandler>& h,
+      const DefaultCandidate& c) noexcept
+    -> decltype(Associator<SpliceHandler, DefaultCandidate>::get(h.handler_, c))
+  {
+    return Associator<SpliceHandler, DefaultCandidate>::get(h.handler_, c);
+  }
+};
+
+#endif // !defined(GENERATING_DOCUMENTATION)
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_IMPL_SPLICE_HPP
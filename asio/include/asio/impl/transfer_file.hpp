@@ -0,0 +1,203 @@
+//
+// impl/transfer_file.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_IMPL_TRANSFER_FILE_HPP
+#define ASIO_IMPL_TRANSFER_FILE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/associator.hpp"
+#include "asio/detail/base_from_cancellation_state.hpp"
+#include "asio/detail/handler_cont_helpers.hpp"
+#include "asio/detail/handler_tracking.hpp"
+#include "asio/detail/handler_type_requirements.hpp"
+#include "asio/detail/non_const_lvalue.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+
+namespace detail
+{
+  template <typename AsyncSendFileStream, typename File,
+      typename TransferHandler>
+  class transfer_file_op
+    : public base_from_cancellation_state<TransferHandler>
+  {
+  public:
+    transfer_file_op(AsyncSendFileStream& stream, File& file,
+        uint64_t offset, std::size_t length, TransferHandler& handler)
+      : base_from_cancellation_state<TransferHandler>(
+          handler, enable_partial_cancellation()),
+        stream_(stream),
+        file_(file),
+        offset_(offset),
+        length_(length),
+        total_transferred_(0),
+        start_(0),
+        handler_(static_cast<TransferHandler&&>(handler))
+    {
+    }
+
+    transfer_file_op(const transfer_file_op& other)
+      : base_from_cancellation_state<TransferHandler>(other),
+        stream_(other.stream_),
+        file_(other.file_),
+        offset_(other.offset_),
+        length_(other.length_),
+        total_transferred_(other.total_transferred_),
+        start_(other.start_),
+        handler_(other.handler_)
+    {
+    }
+
+    transfer_file_op(transfer_file_op&& other)
+      : base_from_cancellation_state<TransferHandler>(
+          static_cast<base_from_cancellation_state<TransferHandler>&&>(other)),
+        stream_(other.stream_),
+        file_(other.file_),
+        offset_(other.offset_),
+        length_(other.length_),
+        total_transferred_(other.total_transferred_),
+        start_(other.start_),
+        handler_(static_cast<TransferHandler&&>(other.handler_))
+    {
+    }
+
+    void operator()(asio::error_code ec,
+        std::size_t bytes_transferred, int start = 0)
+    {
+      switch (start_ = start)
+      {
+        case 1:
+        for (;;)
+        {
+          {
+            ASIO_HANDLER_LOCATION((__FILE__, __LINE__,
+                  "async_transfer_file"));
+            stream_.async_send_file(file_, offset_ + total_transferred_,
+                length_ - total_transferred_,
+                static_cast<transfer_file_op&&>(*this));
+          }
+          return; default:
+          total_transferred_ += bytes_transferred;
+          if (ec || total_transferred_ == length_)
+            break;
+          if (bytes_transferred == 0)
+          {
+            ec = error::eof;
+            break;
+          }
+          if (this->cancelled() != cancellation_type::none)
+          {
+            ec = error::operation_aborted;
+            break;
+          }
+        }
+
+        static_cast<TransferHandler&&>(handler_)(
+            static_cast<const asio::error_code&>(ec),
+            static_cast<const std::size_t&>(total_transferred_));
+      }
+    }
+
+  //private:
+    AsyncSendFileStream& stream_;
+    File& file_;
+    uint64_t offset_;
+    std::size_t length_;
+    std::size_t total_transferred_;
+    int start_;
+    TransferHandler handler_;
+  };
+
+  template <typename AsyncSendFileStream, typename File,
+      typename TransferHandler>
+  inline bool asio_handler_is_continuation(
+      transfer_file_op<AsyncSendFileStream, File,
+        TransferHandler>* this_handler)
+  {
+    return this_handler->start_ == 0 ? true
+      : asio_handler_cont_helpers::is_continuation(
+          this_handler->handler_);
+  }
+
+  template <typename AsyncSendFileStream>
+  class initiate_async_transfer_file
+  {
+  public:
+    typedef typename AsyncSendFileStream::executor_type executor_type;
+
+    explicit initiate_async_transfer_file(AsyncSendFileStream& stream)
+      : stream_(stream)
+    {
+    }
+
+    executor_type get_executor() const noexcept
+    {
+      return stream_.get_executor();
+    }
+
+    template <typename TransferHandler, typename File>
+    void operator()(TransferHandler&& handler, File* file,
+        uint64_t offset, std::size_t length) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a WriteHandler.
+      ASIO_WRITE_HANDLER_CHECK(TransferHandler, handler) type_check;
+
+      non_const_lvalue<TransferHandler> handler2(handler);
+      transfer_file_op<AsyncSendFileStream, File,
+        decay_t<TransferHandler>>(stream_, *file,
+          offset, length, handler2.value)(asio::error_code(), 0, 1);
+    }
+
+  private:
+    AsyncSendFileStream& stream_;
+  };
+} // namespace detail
+
+#if !defined(GENERATING_DOCUMENTATION)
+
+template <template <typename, typename> class Associator,
+    typename AsyncSendFileStream, typename File,
+    typename TransferHandler, typename DefaultCandidate>
+struct associator<Associator,
+    detail::transfer_file_op<AsyncSendFileStream, File, TransferHandler>,
+    DefaultCandidate>
+  : Associator<TransferHandler, DefaultCandidate>
+{
+  static typename Associator<TransferHandler, DefaultCandidate>::type get(
+      const detail::transfer_file_op<AsyncSendFileStream,
+        File, TransferHandler>& h) noexcept
+  {
+    return Associator<TransferHandler, DefaultCandidate>::get(h.handler_);
+  }
+
+  static auto get(
+      const detail::transfer_file_op<AsyncSendFileStream,
+        File, TransferHandler>& h,
+      const DefaultCandidate& c) noexcept
+    -> decltype(
+      Associator<TransferHandler, DefaultCandidate>::get(h.handler_, c))
+  {
+    return Associator<TransferHandler, DefaultCandidate>::get(h.handler_, c);
+  }
+};
+
+#endif // !defined(GENERATING_DOCUMENTATION)
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_IMPL_TRANSFER_FILE_HPP
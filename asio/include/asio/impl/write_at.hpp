@@ -15,6 +15,7 @@
 # pragma once
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
+#include "asio/associated_allocator.hpp"
 #include "asio/associator.hpp"
 #include "asio/buffer.hpp"
 #include "asio/detail/array_fwd.hpp"
@@ -27,6 +28,7 @@
 #include "asio/detail/handler_tracking.hpp"
 #include "asio/detail/handler_type_requirements.hpp"
 #include "asio/detail/non_const_lvalue.hpp"
+#include "asio/detail/recycling_allocator.hpp"
 #include "asio/detail/throw_error.hpp"
 
 #include "asio/detail/push_options.hpp"
@@ -182,7 +184,10 @@ namespace detail
         base_from_completion_cond<CompletionCondition>(completion_condition),
         device_(device),
         offset_(offset),
-        buffers_(buffers),
+        buffers_(buffers,
+            get_recycling_allocator<associated_allocator_t<WriteHandler>,
+              thread_info_base::default_tag>::get(
+                asio::get_associated_allocator(handler))),
         start_(0),
         handler_(static_cast<WriteHandler&&>(handler))
     {
@@ -242,6 +247,7 @@ namespace detail
           }
         }
 
+        buffers_.release();
         static_cast<WriteHandler&&>(handler_)(
             static_cast<const asio::error_code&>(ec),
             static_cast<const std::size_t&>(buffers_.total_consumed()));
@@ -249,8 +255,11 @@ namespace detail
     }
 
   //private:
-    typedef asio::detail::consuming_buffers<const_buffer,
-        ConstBufferSequence, ConstBufferIterator> buffers_type;
+    typedef typename get_recycling_allocator<
+        associated_allocator_t<WriteHandler>,
+        thread_info_base::default_tag>::type buffers_allocator_type;
+    typedef asio::detail::consuming_buffers<const_buffer, ConstBufferSequence,
+        ConstBufferIterator, buffers_allocator_type> buffers_type;
 
     AsyncRandomAccessWriteDevice& device_;
     uint64_t offset_;
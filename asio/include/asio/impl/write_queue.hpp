@@ -0,0 +1,334 @@
+//
+// impl/write_queue.hpp
+// ~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_IMPL_WRITE_QUEUE_HPP
+#define ASIO_IMPL_WRITE_QUEUE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/compose.hpp"
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/handler_type_requirements.hpp"
+#include "asio/detail/non_const_lvalue.hpp"
+#include "asio/dispatch.hpp"
+#include "asio/post.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+// A view of the buffers gathered for a single write.
+class write_queue_batch
+{
+public:
+  typedef const_buffer value_type;
+  typedef const const_buffer* const_iterator;
+
+  write_queue_batch(const const_buffer* buffers, std::size_t count)
+    : begin_(buffers),
+      end_(buffers + count)
+  {
+  }
+
+  const_iterator begin() const
+  {
+    return begin_;
+  }
+
+  const_iterator end() const
+  {
+    return end_;
+  }
+
+private:
+  const const_buffer* begin_;
+  const const_buffer* end_;
+};
+
+template <typename AsyncWriteStream>
+class write_queue_start_handler
+{
+public:
+  explicit write_queue_start_handler(write_queue<AsyncWriteStream>& queue)
+    : queue_(queue)
+  {
+  }
+
+  void operator()()
+  {
+    queue_.start_write();
+  }
+
+private:
+  write_queue<AsyncWriteStream>& queue_;
+};
+
+template <typename AsyncWriteStream>
+class write_queue_write_handler
+{
+public:
+  explicit write_queue_write_handler(write_queue<AsyncWriteStream>& queue)
+    : queue_(queue)
+  {
+  }
+
+  void operator()(const asio::error_code& ec, std::size_t n)
+  {
+    queue_.handle_write(ec, n);
+  }
+
+private:
+  write_queue<AsyncWriteStream>& queue_;
+};
+
+template <typename AsyncWriteStream, typename ConstBufferSequence>
+class write_queue_op
+{
+public:
+  write_queue_op(write_queue<AsyncWriteStream>& queue,
+      const ConstBufferSequence& buffers)
+    : queue_(queue),
+      buffers_(buffers)
+  {
+  }
+
+  template <typename Self>
+  void operator()(Self& self)
+  {
+    queue_.enqueue(buffers_, self);
+  }
+
+  template <typename Self>
+  void operator()(Self& self, const asio::error_code& ec, std::size_t n)
+  {
+    self.complete(ec, n);
+  }
+
+private:
+  write_queue<AsyncWriteStream>& queue_;
+  ConstBufferSequence buffers_;
+};
+
+template <typename AsyncWriteStream>
+class initiate_async_write_queue
+{
+public:
+  typedef typename write_queue<AsyncWriteStream>::executor_type executor_type;
+
+  explicit initiate_async_write_queue(write_queue<AsyncWriteStream>& queue)
+    : queue_(queue)
+  {
+  }
+
+  executor_type get_executor() const noexcept
+  {
+    return queue_.get_executor();
+  }
+
+  template <typename WriteHandler, typename ConstBufferSequence>
+  void operator()(WriteHandler&& handler,
+      const ConstBufferSequence& buffers) const
+  {
+    // If you get an error on the following line it means that your handler
+    // does not meet the documented type requirements for a WriteHandler.
+    ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+    non_const_lvalue<WriteHandler> handler2(handler);
+    asio::async_compose<decay_t<WriteHandler>,
+      void (asio::error_code, std::size_t)>(
+        write_queue_op<AsyncWriteStream, ConstBufferSequence>(
+          queue_, buffers), handler2.value, queue_.next_layer());
+  }
+
+private:
+  write_queue<AsyncWriteStream>& queue_;
+};
+
+} // namespace detail
+
+template <typename AsyncWriteStream>
+template <typename ConstBufferSequence,
+    ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+      std::size_t)) WriteToken>
+inline auto write_queue<AsyncWriteStream>::async_write(
+    const ConstBufferSequence& buffers, WriteToken&& token)
+  -> decltype(
+    async_initiate<WriteToken,
+      void (asio::error_code, std::size_t)>(
+        declval<detail::initiate_async_write_queue<AsyncWriteStream>>(),
+        token, buffers))
+{
+  return async_initiate<WriteToken,
+    void (asio::error_code, std::size_t)>(
+      detail::initiate_async_write_queue<AsyncWriteStream>(*this),
+      token, buffers);
+}
+
+template <typename AsyncWriteStream>
+template <typename ConstBufferSequence, typename Handler>
+void write_queue<AsyncWriteStream>::enqueue(
+    const ConstBufferSequence& buffers, Handler& handler)
+{
+  bool start = false;
+  {
+    detail::mutex::scoped_lock lock(mutex_);
+
+    std::size_t size = 0;
+    for (auto iter = asio::buffer_sequence_begin(buffers),
+        end = asio::buffer_sequence_end(buffers); iter != end; ++iter)
+    {
+      const_buffer buffer(*iter);
+      if (buffer.size() > 0)
+      {
+        buffers_.push_back(buffer);
+        size += buffer.size();
+      }
+    }
+
+    // The buffers are no longer needed, so the handler may now be moved.
+    messages_.push_back(message(size,
+          handler_type(static_cast<Handler&&>(handler))));
+
+    start = !writing_;
+    writing_ = true;
+  }
+
+  // The write loop is always started using post, so that a message that is
+  // completed without a write is not completed inside the initiating
+  // function.
+  if (start)
+  {
+    asio::post(next_layer_.get_executor(),
+        detail::write_queue_start_handler<AsyncWriteStream>(*this));
+  }
+}
+
+template <typename AsyncWriteStream>
+void write_queue<AsyncWriteStream>::start_write()
+{
+  std::size_t count = 0;
+  {
+    detail::mutex::scoped_lock lock(mutex_);
+
+    // Messages with no bytes remaining are complete.
+    while (!messages_.empty() && messages_.front().remaining == 0)
+    {
+      completed_.push_back(completion(
+            static_cast<handler_type&&>(messages_.front().handler),
+            messages_.front().size));
+      messages_.pop_front();
+    }
+
+    if (buffers_.empty())
+    {
+      // Once the loop goes idle, a new loop may be started by another thread,
+      // so the completed messages must be moved out of the shared state.
+      writing_ = false;
+      std::vector<completion> completions;
+      completions.swap(completed_);
+      lock.unlock();
+      deliver(completions, asio::error_code());
+      return;
+    }
+
+    // Gather as many queued buffers as fit into a single write.
+    for (std::deque<const_buffer>::iterator iter = buffers_.begin(),
+        end = buffers_.end(); iter != end && count < max_buffers; ++iter)
+      batch_[count++] = *iter;
+  }
+
+  deliver(completed_, asio::error_code());
+
+  next_layer_.async_write_some(detail::write_queue_batch(batch_, count),
+      detail::write_queue_write_handler<AsyncWriteStream>(*this));
+}
+
+template <typename AsyncWriteStream>
+void write_queue<AsyncWriteStream>::handle_write(
+    const asio::error_code& ec, std::size_t n)
+{
+  {
+    detail::mutex::scoped_lock lock(mutex_);
+
+    if (ec)
+    {
+      // All queued messages fail with the error.
+      while (!messages_.empty())
+      {
+        message& m = messages_.front();
+        completed_.push_back(completion(
+              static_cast<handler_type&&>(m.handler),
+              m.size - m.remaining));
+        messages_.pop_front();
+      }
+      buffers_.clear();
+    }
+    else
+    {
+      // Consume the bytes written from the queued buffers.
+      std::size_t bytes = n;
+      while (bytes > 0 && !buffers_.empty())
+      {
+        const_buffer& buffer = buffers_.front();
+        if (bytes < buffer.size())
+        {
+          buffer += bytes;
+          bytes = 0;
+        }
+        else
+        {
+          bytes -= buffer.size();
+          buffers_.pop_front();
+        }
+      }
+
+      // Attribute the bytes written to the messages, in order.
+      bytes = n;
+      while (bytes > 0 && !messages_.empty())
+      {
+        message& m = messages_.front();
+        std::size_t k = bytes < m.remaining ? bytes : m.remaining;
+        m.remaining -= k;
+        bytes -= k;
+        if (m.remaining == 0)
+        {
+          completed_.push_back(completion(
+                static_cast<handler_type&&>(m.handler), m.size));
+          messages_.pop_front();
+        }
+      }
+    }
+  }
+
+  deliver(completed_, ec);
+  start_write();
+}
+
+template <typename AsyncWriteStream>
+void write_queue<AsyncWriteStream>::deliver(
+    std::vector<completion>& completions, const asio::error_code& ec)
+{
+  for (std::size_t i = 0; i < completions.size(); ++i)
+  {
+    completion& c = completions[i];
+    asio::dispatch(asio::detail::bind_handler(
+          static_cast<handler_type&&>(c.handler), ec, c.bytes_transferred));
+  }
+  completions.clear();
+}
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_IMPL_WRITE_QUEUE_HPP
@@ -125,6 +125,84 @@ public:
     ASIO_OS_DEF(IPPROTO_TCP), ASIO_OS_DEF(TCP_NODELAY)> no_delay;
 #endif
 
+#if defined(ASIO_HAS_TCP_FASTOPEN) \
+  || defined(GENERATING_DOCUMENTATION)
+  /// Socket option to enable TCP Fast Open on a listening socket.
+  /**
+   * Implements the IPPROTO_TCP/TCP_FASTOPEN socket option. The value is the
+   * maximum length of the queue of connections that have been accepted with
+   * data in the SYN, but that have not yet completed the three-way handshake.
+   * The option must be set on an acceptor before it starts listening.
+   *
+   * @par Examples
+   * Setting the option:
+   * @code
+   * asio::ip::tcp::acceptor acceptor(my_context);
+   * ...
+   * asio::ip::tcp::fast_open option(16);
+   * acceptor.set_option(option);
+   * @endcode
+   *
+   * @par
+   * Getting the current option value:
+   * @code
+   * asio::ip::tcp::acceptor acceptor(my_context);
+   * ...
+   * asio::ip::tcp::fast_open option;
+   * acceptor.get_option(option);
+   * int queue_length = option.value();
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Integer_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined fast_open;
+#else
+  typedef asio::detail::socket_option::integer<
+    ASIO_OS_DEF(IPPROTO_TCP), ASIO_OS_DEF(TCP_FASTOPEN)> fast_open;
+#endif
+
+  /// Socket option to enable TCP Fast Open on connect.
+  /**
+   * Implements the IPPROTO_TCP/TCP_FASTOPEN_CONNECT socket option. When
+   * enabled, a connect operation completes immediately and the SYN is
+   * deferred until the first data is written, so that the data may be carried
+   * in the SYN. The asio::basic_stream_socket::async_connect() overload that
+   * takes initial data does not require this option to be set.
+   *
+   * @par Examples
+   * Setting the option:
+   * @code
+   * asio::ip::tcp::socket socket(my_context);
+   * ...
+   * asio::ip::tcp::fast_open_connect option(true);
+   * socket.set_option(option);
+   * @endcode
+   *
+   * @par
+   * Getting the current option value:
+   * @code
+   * asio::ip::tcp::socket socket(my_context);
+   * ...
+   * asio::ip::tcp::fast_open_connect option;
+   * socket.get_option(option);
+   * bool is_set = option.value();
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Boolean_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined fast_open_connect;
+#else
+  typedef asio::detail::socket_option::boolean<
+    ASIO_OS_DEF(IPPROTO_TCP), ASIO_OS_DEF(TCP_FASTOPEN_CONNECT)>
+      fast_open_connect;
+#endif
+#endif // defined(ASIO_HAS_TCP_FASTOPEN)
+       //   || defined(GENERATING_DOCUMENTATION)
+
   /// Compare two protocols for equality.
   friend bool operator==(const tcp& p1, const tcp& p2)
   {
@@ -17,6 +17,7 @@
 
 #include "asio/detail/config.hpp"
 #include "asio/basic_datagram_socket.hpp"
+#include "asio/detail/socket_option.hpp"
 #include "asio/detail/socket_types.hpp"
 #include "asio/ip/basic_endpoint.hpp"
 #include "asio/ip/basic_resolver.hpp"
@@ -81,6 +82,85 @@ public:
   /// The UDP resolver type.
   typedef basic_resolver<udp> resolver;
 
+#if defined(ASIO_HAS_UDP_GSO) \
+  || defined(GENERATING_DOCUMENTATION)
+  /// Socket option for UDP generic segmentation offload.
+  /**
+   * Implements the IPPROTO_UDP/UDP_SEGMENT socket option. When set to a
+   * non-zero value, each buffer sent on the socket is split by the kernel, or
+   * by the network interface, into datagrams of the specified size. Only the
+   * last datagram may be smaller. A per-message segment size may also be
+   * specified for batched send operations by using
+   * asio::datagram_message::segment_size().
+   *
+   * @par Examples
+   * Setting the option:
+   * @code
+   * asio::ip::udp::socket socket(my_context);
+   * ...
+   * asio::ip::udp::segment_size option(1200);
+   * socket.set_option(option);
+   * @endcode
+   *
+   * @par
+   * Getting the current option value:
+   * @code
+   * asio::ip::udp::socket socket(my_context);
+   * ...
+   * asio::ip::udp::segment_size option;
+   * socket.get_option(option);
+   * int size = option.value();
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Integer_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined segment_size;
+#else
+  typedef asio::detail::socket_option::integer<
+    ASIO_OS_DEF(IPPROTO_UDP), ASIO_OS_DEF(UDP_SEGMENT)> segment_size;
+#endif
+
+  /// Socket option for UDP generic receive offload.
+  /**
+   * Implements the IPPROTO_UDP/UDP_GRO socket option. When enabled, the kernel
+   * may coalesce a train of equally sized datagrams from the same flow into a
+   * single receive. Use asio::basic_datagram_socket::async_receive_batch() to
+   * obtain the size of the original datagrams, which is reported by
+   * asio::datagram_message::segment_size().
+   *
+   * @par Examples
+   * Setting the option:
+   * @code
+   * asio::ip::udp::socket socket(my_context);
+   * ...
+   * asio::ip::udp::generic_receive_offload option(true);
+   * socket.set_option(option);
+   * @endcode
+   *
+   * @par
+   * Getting the current option value:
+   * @code
+   * asio::ip::udp::socket socket(my_context);
+   * ...
+   * asio::ip::udp::generic_receive_offload option;
+   * socket.get_option(option);
+   * bool is_set = option.value();
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Boolean_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined generic_receive_offload;
+#else
+  typedef asio::detail::socket_option::boolean<
+    ASIO_OS_DEF(IPPROTO_UDP), ASIO_OS_DEF(UDP_GRO)> generic_receive_offload;
+#endif
+#endif // defined(ASIO_HAS_UDP_GSO)
+       //   || defined(GENERATING_DOCUMENTATION)
+
   /// Compare two protocols for equality.
   friend bool operator==(const udp& p1, const udp& p2)
   {
@@ -0,0 +1,266 @@
+//
+// local/fd_passing.hpp
+// ~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_LOCAL_FD_PASSING_HPP
+#define ASIO_LOCAL_FD_PASSING_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if (defined(ASIO_HAS_LOCAL_SOCKETS) \
+    && defined(ASIO_HAS_ANCILLARY_DATA)) \
+  || defined(GENERATING_DOCUMENTATION)
+
+#include <cstddef>
+#include "asio/async_result.hpp"
+#include "asio/basic_socket.hpp"
+#include "asio/basic_stream_socket.hpp"
+#include "asio/error.hpp"
+#include "asio/local/stream_protocol.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace local {
+namespace detail {
+
+template <typename> class initiate_async_send_with_fds;
+template <typename> class initiate_async_receive_with_fds;
+
+} // namespace detail
+
+/// Start an asynchronous send of data together with native handles.
+/**
+ * This function is used to asynchronously send data on a UNIX domain stream
+ * socket, together with a set of open native handles (file descriptors) that
+ * are passed to the peer using an @c SCM_RIGHTS control message. It is an
+ * initiating function for an @ref asynchronous_operation, and always returns
+ * immediately.
+ *
+ * The peer receives new descriptors that refer to the same open file
+ * descriptions as @c handles. The sender retains ownership of its own handles,
+ * and may close them once the operation has completed successfully.
+ *
+ * @param s The socket on which the data and handles are to be sent.
+ *
+ * @param buffers One or more data buffers to be sent on the socket. At least
+ * one byte of data must be sent for the handles to be delivered. Although the
+ * buffers object may be copied as necessary, ownership of the underlying
+ * memory blocks is retained by the caller, which must guarantee that they
+ * remain valid until the completion handler is called.
+ *
+ * @param handles A pointer to an array of native handles to be sent. The
+ * handles are copied before this function returns.
+ *
+ * @param count The number of handles in the array. If zero, no control message
+ * is sent.
+ *
+ * @param token The @ref completion_token that will be used to produce a
+ * completion handler, which will be called when the send completes.
+ * Potential completion tokens include @ref use_future, @ref use_awaitable,
+ * @ref yield_context, or a function object with the correct completion
+ * signature. The function signature of the completion handler must be:
+ * @code void handler(
+ *   const asio::error_code& error, // Result of operation.
+ *   std::size_t bytes_transferred // Number of bytes sent.
+ * ); @endcode
+ * Regardless of whether the asynchronous operation completes immediately or
+ * not, the completion handler will not be invoked from within this function.
+ * On immediate completion, invocation of the handler will be performed in a
+ * manner equivalent to using asio::async_immediate().
+ *
+ * @par Completion Signature
+ * @code void(asio::error_code, std::size_t) @endcode
+ *
+ * @note The send operation may not transmit all of the data to the peer. The
+ * handles are delivered with the first byte that is sent.
+ *
+ * @par Example
+ * Handing an accepted connection to a worker process:
+ * @code asio::ip::tcp::socket::native_handle_type fd = conn.native_handle();
+ * asio::local::async_send_with_fds(channel,
+ *     asio::buffer("c", 1), &fd, 1,
+ *     [&](asio::error_code ec, std::size_t)
+ *     {
+ *       if (!ec)
+ *         conn.close();
+ *     }); @endcode
+ *
+ * @par Per-Operation Cancellation
+ * This asynchronous operation supports cancellation for the following
+ * asio::cancellation_type values:
+ *
+ * @li @c cancellation_type::terminal
+ *
+ * @li @c cancellation_type::partial
+ *
+ * @li @c cancellation_type::total
+ */
+template <typename Executor, typename ConstBufferSequence,
+    ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+      std::size_t)) WriteToken = default_completion_token_t<Executor>>
+inline auto async_send_with_fds(
+    basic_stream_socket<stream_protocol, Executor>& s,
+    const ConstBufferSequence& buffers,
+    const typename basic_stream_socket<stream_protocol,
+      Executor>::native_handle_type* handles, std::size_t count,
+    WriteToken&& token = default_completion_token_t<Executor>())
+  -> decltype(
+    async_initiate<WriteToken, void (asio::error_code, std::size_t)>(
+      declval<detail::initiate_async_send_with_fds<Executor>>(),
+      token, buffers, handles, count))
+{
+  return async_initiate<WriteToken, void (asio::error_code, std::size_t)>(
+      detail::initiate_async_send_with_fds<Executor>(s),
+      token, buffers, handles, count);
+}
+
+/// Start an asynchronous receive of data together with native handles.
+/**
+ * This function is used to asynchronously receive data from a UNIX domain
+ * stream socket, together with any native handles (file descriptors) passed by
+ * the peer using an @c SCM_RIGHTS control message. It is an initiating
+ * function for an @ref asynchronous_operation, and always returns immediately.
+ *
+ * Where supported, received handles are created with the close-on-exec flag
+ * set. Ownership of the received handles passes to the caller, who is
+ * responsible for closing them or adopting them into an I/O object using
+ * asio::local::adopt_socket().
+ *
+ * @param s The socket from which the data and handles are to be received.
+ *
+ * @param buffers One or more buffers into which the data will be received.
+ * Although the buffers object may be copied as necessary, ownership of the
+ * underlying memory blocks is retained by the caller, which must guarantee
+ * that they remain valid until the completion handler is called.
+ *
+ * @param handles A pointer to an array into which the received handles will be
+ * stored. Ownership of the array is retained by the caller, which must
+ * guarantee that it remains valid until the completion handler is called.
+ *
+ * @param max_handles The number of elements in the @c handles array. Space for
+ * this many handles is made available to the kernel. Any additional handles
+ * sent by the peer are discarded and closed.
+ *
+ * @param token The @ref completion_token that will be used to produce a
+ * completion handler, which will be called when the receive completes.
+ * Potential completion tokens include @ref use_future, @ref use_awaitable,
+ * @ref yield_context, or a function object with the correct completion
+ * signature. The function signature of the completion handler must be:
+ * @code void handler(
+ *   const asio::error_code& error, // Result of operation.
+ *   std::size_t bytes_transferred, // Number of bytes received.
+ *   std::size_t handles_received // Number of handles stored in the array.
+ * ); @endcode
+ * Regardless of whether the asynchronous operation completes immediately or
+ * not, the completion handler will not be invoked from within this function.
+ * On immediate completion, invocation of the handler will be performed in a
+ * manner equivalent to using asio::async_immediate().
+ *
+ * @par Completion Signature
+ * @code void(asio::error_code, std::size_t, std::size_t) @endcode
+ *
+ * @par Per-Operation Cancellation
+ * This asynchronous operation supports cancellation for the following
+ * asio::cancellation_type values:
+ *
+ * @li @c cancellation_type::terminal
+ *
+ * @li @c cancellation_type::partial
+ *
+ * @li @c cancellation_type::total
+ */
+template <typename Executor, typename MutableBufferSequence,
+    ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+      std::size_t, std::size_t)) ReadToken
+        = default_completion_token_t<Executor>>
+inline auto async_receive_with_fds(
+    basic_stream_socket<stream_protocol, Executor>& s,
+    const MutableBufferSequence& buffers,
+    typename basic_stream_socket<stream_protocol,
+      Executor>::native_handle_type* handles, std::size_t max_handles,
+    ReadToken&& token = default_completion_token_t<Executor>())
+  -> decltype(
+    async_initiate<ReadToken,
+      void (asio::error_code, std::size_t, std::size_t)>(
+        declval<detail::initiate_async_receive_with_fds<Executor>>(),
+        token, buffers, handles, max_handles))
+{
+  return async_initiate<ReadToken,
+    void (asio::error_code, std::size_t, std::size_t)>(
+      detail::initiate_async_receive_with_fds<Executor>(s),
+      token, buffers, handles, max_handles);
+}
+
+/// Adopt a received native handle into a socket.
+/**
+ * This function determines the address family and socket type of an existing
+ * native socket, such as one received using async_receive_with_fds(), and
+ * assigns it to the socket object. The handle is registered with the socket's
+ * I/O service so that asynchronous operations may be performed on it.
+ *
+ * @param s The socket object into which the handle is adopted. The socket must
+ * not already be open.
+ *
+ * @param handle The native socket to be adopted. On success, ownership of the
+ * handle passes to @c s.
+ *
+ * @throws asio::system_error Thrown on failure. The error
+ * asio::error::invalid_argument indicates that the handle does not refer to a
+ * socket of the family and type required by @c Protocol. On failure, ownership
+ * of the handle is retained by the caller.
+ *
+ * @par Example
+ * @code asio::ip::tcp::socket conn(my_context);
+ * asio::local::adopt_socket(conn, handles[0]); @endcode
+ */
+template <typename Protocol, typename Executor>
+void adopt_socket(basic_socket<Protocol, Executor>& s,
+    const typename basic_socket<Protocol,
+      Executor>::native_handle_type& handle);
+
+/// Adopt a received native handle into a socket.
+/**
+ * This function determines the address family and socket type of an existing
+ * native socket, such as one received using async_receive_with_fds(), and
+ * assigns it to the socket object. The handle is registered with the socket's
+ * I/O service so that asynchronous operations may be performed on it.
+ *
+ * @param s The socket object into which the handle is adopted. The socket must
+ * not already be open.
+ *
+ * @param handle The native socket to be adopted. On success, ownership of the
+ * handle passes to @c s.
+ *
+ * @param ec Set to indicate what error occurred, if any. The error
+ * asio::error::invalid_argument indicates that the handle does not refer to a
+ * socket of the family and type required by @c Protocol. On failure, ownership
+ * of the handle is retained by the caller.
+ */
+template <typename Protocol, typename Executor>
+ASIO_SYNC_OP_VOID adopt_socket(basic_socket<Protocol, Executor>& s,
+    const typename basic_socket<Protocol, Executor>::native_handle_type& handle,
+    asio::error_code& ec);
+
+} // namespace local
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#include "asio/local/impl/fd_passing.hpp"
+
+#endif // (defined(ASIO_HAS_LOCAL_SOCKETS)
+       //     && defined(ASIO_HAS_ANCILLARY_DATA))
+       //   || defined(GENERATING_DOCUMENTATION)
+
+#endif // ASIO_LOCAL_FD_PASSING_HPP
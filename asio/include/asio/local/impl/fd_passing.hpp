@@ -0,0 +1,307 @@
+//
+// local/impl/fd_passing.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_LOCAL_IMPL_FD_PASSING_HPP
+#define ASIO_LOCAL_IMPL_FD_PASSING_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstring>
+#include <memory>
+#include <vector>
+#include "asio/cancellation_type.hpp"
+#include "asio/compose.hpp"
+#include "asio/control_buffer.hpp"
+#include "asio/detail/handler_type_requirements.hpp"
+#include "asio/detail/non_const_lvalue.hpp"
+#include "asio/detail/socket_ops.hpp"
+#include "asio/detail/throw_error.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace local {
+namespace detail {
+
+template <typename Executor, typename ConstBufferSequence>
+class send_with_fds_op
+{
+public:
+  typedef basic_stream_socket<stream_protocol, Executor> socket_type;
+  typedef typename socket_type::native_handle_type native_handle_type;
+
+  send_with_fds_op(socket_type& s, const ConstBufferSequence& buffers,
+      const native_handle_type* handles, std::size_t count)
+    : socket_(s),
+      buffers_(buffers),
+      storage_(count > 0
+          ? control_buffer::space(count * sizeof(native_handle_type)) : 0)
+  {
+    // The control message is built in storage owned by the operation, so that
+    // the caller's array need not outlive the call to the initiating function.
+    // The storage is heap allocated and so remains at a stable address as the
+    // operation is moved.
+    if (count > 0)
+    {
+      control_ = control_buffer(storage_.data(), storage_.size());
+      control_.push_back(ASIO_OS_DEF(SOL_SOCKET), SCM_RIGHTS,
+          handles, count * sizeof(native_handle_type));
+    }
+  }
+
+  template <typename Self>
+  void operator()(Self& self)
+  {
+    self.reset_cancellation_state(enable_total_cancellation());
+    socket_.async_send_msg(buffers_, control_, 0, static_cast<Self&&>(self));
+  }
+
+  template <typename Self>
+  void operator()(Self& self, const asio::error_code& ec, std::size_t n)
+  {
+    self.complete(ec, n);
+  }
+
+private:
+  socket_type& socket_;
+  ConstBufferSequence buffers_;
+  std::vector<char> storage_;
+  control_buffer control_;
+};
+
+// State for a receive operation that must remain at a stable address while
+// the underlying receive is outstanding.
+class receive_with_fds_state
+{
+public:
+  explicit receive_with_fds_state(std::size_t max_handles)
+    : storage_(control_buffer::space(max_handles * sizeof(int))),
+      control_(storage_.data(), storage_.size()),
+      out_flags_(0)
+  {
+  }
+
+  control_buffer& control()
+  {
+    return control_;
+  }
+
+  socket_base::message_flags& out_flags()
+  {
+    return out_flags_;
+  }
+
+private:
+  std::vector<char> storage_;
+  control_buffer control_;
+  socket_base::message_flags out_flags_;
+};
+
+template <typename Executor, typename MutableBufferSequence>
+class receive_with_fds_op
+{
+public:
+  typedef basic_stream_socket<stream_protocol, Executor> socket_type;
+  typedef typename socket_type::native_handle_type native_handle_type;
+
+  receive_with_fds_op(socket_type& s, const MutableBufferSequence& buffers,
+      native_handle_type* handles, std::size_t max_handles)
+    : socket_(s),
+      buffers_(buffers),
+      handles_(handles),
+      max_handles_(max_handles)
+  {
+  }
+
+  template <typename Self>
+  void operator()(Self& self)
+  {
+    self.reset_cancellation_state(enable_total_cancellation());
+
+    state_ = std::allocate_shared<receive_with_fds_state>(
+        self.get_allocator(), max_handles_ > 0 ? max_handles_ : 1);
+
+    socket_base::message_flags in_flags = 0;
+#if defined(MSG_CMSG_CLOEXEC)
+    in_flags |= MSG_CMSG_CLOEXEC;
+#endif // defined(MSG_CMSG_CLOEXEC)
+
+    socket_.async_receive_msg(buffers_, state_->control(), in_flags,
+        state_->out_flags(), static_cast<Self&&>(self));
+  }
+
+  template <typename Self>
+  void operator()(Self& self, const asio::error_code& ec, std::size_t n)
+  {
+    std::size_t count = 0;
+    for (control_buffer::const_iterator iter = state_->control().begin(),
+        end = state_->control().end(); iter != end; ++iter)
+    {
+      if (!iter->is(ASIO_OS_DEF(SOL_SOCKET), SCM_RIGHTS))
+        continue;
+
+      const char* data = static_cast<const char*>(iter->data());
+      std::size_t handles = iter->size() / sizeof(native_handle_type);
+      for (std::size_t i = 0; i < handles; ++i)
+      {
+        native_handle_type handle;
+        std::memcpy(&handle, data + i * sizeof(native_handle_type),
+            sizeof(native_handle_type));
+
+        // Handles that cannot be given to the caller must not be leaked.
+        if (!ec && count < max_handles_)
+          handles_[count++] = handle;
+        else
+        {
+          asio::error_code close_ec;
+          asio::detail::socket_ops::state_type state = 0;
+          asio::detail::socket_ops::close(handle, state, true, close_ec);
+        }
+      }
+    }
+
+    state_.reset();
+    self.complete(ec, n, count);
+  }
+
+private:
+  socket_type& socket_;
+  MutableBufferSequence buffers_;
+  native_handle_type* handles_;
+  std::size_t max_handles_;
+  std::shared_ptr<receive_with_fds_state> state_;
+};
+
+template <typename Executor>
+class initiate_async_send_with_fds
+{
+public:
+  typedef Executor executor_type;
+  typedef basic_stream_socket<stream_protocol, Executor> socket_type;
+  typedef typename socket_type::native_handle_type native_handle_type;
+
+  explicit initiate_async_send_with_fds(socket_type& s)
+    : socket_(s)
+  {
+  }
+
+  executor_type get_executor() const noexcept
+  {
+    return socket_.get_executor();
+  }
+
+  template <typename WriteHandler, typename ConstBufferSequence>
+  void operator()(WriteHandler&& handler,
+      const ConstBufferSequence& buffers,
+      const native_handle_type* handles, std::size_t count) const
+  {
+    // If you get an error on the following line it means that your handler
+    // does not meet the documented type requirements for a WriteHandler.
+    ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+    asio::detail::non_const_lvalue<WriteHandler> handler2(handler);
+    asio::async_compose<decay_t<WriteHandler>,
+      void (asio::error_code, std::size_t)>(
+        send_with_fds_op<Executor, ConstBufferSequence>(
+          socket_, buffers, handles, count),
+        handler2.value, socket_);
+  }
+
+private:
+  socket_type& socket_;
+};
+
+template <typename Executor>
+class initiate_async_receive_with_fds
+{
+public:
+  typedef Executor executor_type;
+  typedef basic_stream_socket<stream_protocol, Executor> socket_type;
+  typedef typename socket_type::native_handle_type native_handle_type;
+
+  explicit initiate_async_receive_with_fds(socket_type& s)
+    : socket_(s)
+  {
+  }
+
+  executor_type get_executor() const noexcept
+  {
+    return socket_.get_executor();
+  }
+
+  template <typename ReadHandler, typename MutableBufferSequence>
+  void operator()(ReadHandler&& handler,
+      const MutableBufferSequence& buffers,
+      native_handle_type* handles, std::size_t max_handles) const
+  {
+    asio::detail::non_const_lvalue<ReadHandler> handler2(handler);
+    asio::async_compose<decay_t<ReadHandler>,
+      void (asio::error_code, std::size_t, std::size_t)>(
+        receive_with_fds_op<Executor, MutableBufferSequence>(
+          socket_, buffers, handles, max_handles),
+        handler2.value, socket_);
+  }
+
+private:
+  socket_type& socket_;
+};
+
+} // namespace detail
+
+template <typename Protocol, typename Executor>
+inline void adopt_socket(basic_socket<Protocol, Executor>& s,
+    const typename basic_socket<Protocol, Executor>::native_handle_type& handle)
+{
+  asio::error_code ec;
+  adopt_socket(s, handle, ec);
+  asio::detail::throw_error(ec, "adopt_socket");
+}
+
+template <typename Protocol, typename Executor>
+ASIO_SYNC_OP_VOID adopt_socket(basic_socket<Protocol, Executor>& s,
+    const typename basic_socket<Protocol, Executor>::native_handle_type& handle,
+    asio::error_code& ec)
+{
+  // Determine the address family from the socket's local address. The length
+  // returned may exceed the endpoint's capacity when the handle refers to a
+  // socket of a different family, so only the family field is examined.
+  typename Protocol::endpoint endpoint;
+  std::size_t addr_len = endpoint.capacity();
+  if (asio::detail::socket_ops::getsockname(handle,
+        endpoint.data(), &addr_len, ec) != 0)
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+
+  int type = 0;
+  std::size_t type_len = sizeof(type);
+  if (asio::detail::socket_ops::getsockopt(handle, 0,
+        ASIO_OS_DEF(SOL_SOCKET), SO_TYPE, &type, &type_len, ec) != 0)
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+
+  Protocol protocol = endpoint.protocol();
+  if (endpoint.data()->sa_family != protocol.family()
+      || type != protocol.type())
+  {
+    ec = asio::error::invalid_argument;
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  s.assign(protocol, handle, ec);
+  ASIO_SYNC_OP_VOID_RETURN(ec);
+}
+
+} // namespace local
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_LOCAL_IMPL_FD_PASSING_HPP
@@ -24,9 +24,11 @@ namespace asio {
 
 /// An allocator that caches memory blocks in thread-local storage for reuse.
 /**
- * The @recycling_allocator uses a simple strategy where a limited number of
- * small memory blocks are cached in thread-local storage, if the current
- * thread is running an @c io_context or is part of a @c thread_pool.
+ * The @recycling_allocator rounds small memory blocks up to one of a set of
+ * size classes, and caches a limited number of blocks of each class in
+ * thread-local storage, if the current thread is running an @c io_context or
+ * is part of a @c thread_pool. Blocks are exchanged in batches with a global
+ * depot when a thread's cache for a size class is empty or full.
  */
 template <typename T>
 class recycling_allocator
@@ -85,9 +87,11 @@ public:
 /// A proto-allocator that caches memory blocks in thread-local storage for
 /// reuse.
 /**
- * The @recycling_allocator uses a simple strategy where a limited number of
- * small memory blocks are cached in thread-local storage, if the current
- * thread is running an @c io_context or is part of a @c thread_pool.
+ * The @recycling_allocator rounds small memory blocks up to one of a set of
+ * size classes, and caches a limited number of blocks of each class in
+ * thread-local storage, if the current thread is running an @c io_context or
+ * is part of a @c thread_pool. Blocks are exchanged in batches with a global
+ * depot when a thread's cache for a size class is empty or full.
  */
 template <>
 class recycling_allocator<void>
@@ -131,6 +135,61 @@ public:
   }
 };
 
+/// Statistics that describe how the recycling allocator has satisfied the
+/// requests made on a thread.
+struct recycling_allocator_statistics
+{
+  /// The number of blocks allocated.
+  std::size_t allocations;
+
+  /// The number of blocks deallocated.
+  std::size_t deallocations;
+
+  /// The number of allocations satisfied from the thread's cache.
+  std::size_t cache_hits;
+
+  /// The number of batches of blocks moved from the global depot to the
+  /// thread's cache.
+  std::size_t depot_refills;
+
+  /// The number of batches of blocks moved from the thread's cache to the
+  /// global depot.
+  std::size_t depot_flushes;
+
+  /// The number of allocations passed to the underlying heap.
+  std::size_t heap_allocations;
+
+  /// The number of deallocations passed to the underlying heap.
+  std::size_t heap_deallocations;
+};
+
+/// Get the recycling allocator statistics for the calling thread.
+/**
+ * The statistics are collected separately for each call to a function such as
+ * @c io_context::run() or @c io_context::poll(), and for each thread that is
+ * part of a @c thread_pool. If the calling thread is not running an
+ * @c io_context or part of a @c thread_pool, all of the counters are zero.
+ */
+inline recycling_allocator_statistics
+this_thread_recycling_allocator_statistics() noexcept
+{
+  recycling_allocator_statistics result = recycling_allocator_statistics();
+  if (detail::thread_info_base* this_thread =
+      detail::thread_context::top_of_thread_call_stack())
+  {
+    const detail::thread_info_base::statistics& s =
+      this_thread->get_statistics();
+    result.allocations = s.allocations;
+    result.deallocations = s.deallocations;
+    result.cache_hits = s.cache_hits;
+    result.depot_refills = s.depot_refills;
+    result.depot_flushes = s.depot_flushes;
+    result.heap_allocations = s.heap_allocations;
+    result.heap_deallocations = s.heap_deallocations;
+  }
+  return result;
+}
+
 } // namespace asio
 
 #include "asio/detail/pop_options.hpp"
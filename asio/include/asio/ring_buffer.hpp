@@ -0,0 +1,361 @@
+//
+// ring_buffer.hpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_RING_BUFFER_HPP
+#define ASIO_RING_BUFFER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_MEMFD) \
+  || defined(GENERATING_DOCUMENTATION)
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include "asio/buffer.hpp"
+#include "asio/detail/noncopyable.hpp"
+#include "asio/detail/throw_exception.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+
+/// Fixed-capacity circular storage whose data is always contiguous.
+/**
+ * The @c ring_buffer class stores its data in a circular buffer that is
+ * mapped into memory twice, back to back. A region that wraps around the end
+ * of the buffer is therefore also visible as a single contiguous region of
+ * memory, starting in the first mapping and ending in the second. This means
+ * that:
+ *
+ * @li The stored data is always represented by a single buffer, so parsers do
+ * not need to handle data that is split across buffers.
+ *
+ * @li Consuming data from the front never moves the remaining data.
+ *
+ * @li No memory is allocated after construction.
+ *
+ * The capacity is fixed when the ring buffer is constructed, and is rounded up
+ * to a multiple of the system page size. A ring_buffer object is used with the
+ * DynamicBuffer_v2 requirements through the dynamic_ring_buffer class, which
+ * is created by calling asio::dynamic_buffer().
+ *
+ * This class is implemented using @c memfd_create and @c mmap, and is
+ * available on Linux only.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe.
+ */
+class ring_buffer
+  : private noncopyable
+{
+public:
+  /// The type used to represent a sequence of constant buffers that refers to
+  /// the stored data.
+  typedef const_buffer const_buffers_type;
+
+  /// The type used to represent a sequence of mutable buffers that refers to
+  /// the stored data.
+  typedef mutable_buffer mutable_buffers_type;
+
+  /// Construct a ring buffer.
+  /**
+   * @param capacity The minimum capacity of the ring buffer, in bytes. The
+   * capacity is rounded up to a multiple of the system page size.
+   *
+   * @throws asio::system_error Thrown on failure to create or map the
+   * underlying memory.
+   */
+  ASIO_DECL explicit ring_buffer(std::size_t capacity);
+
+  /// Destructor releases the underlying memory.
+  ASIO_DECL ~ring_buffer();
+
+  /// Get the size of the stored data.
+  std::size_t size() const noexcept
+  {
+    return size_;
+  }
+
+  /// Get the maximum size of the stored data.
+  /**
+   * @returns The capacity of the ring buffer.
+   */
+  std::size_t max_size() const noexcept
+  {
+    return capacity_;
+  }
+
+  /// Get the capacity of the ring buffer.
+  std::size_t capacity() const noexcept
+  {
+    return capacity_;
+  }
+
+  /// Get a buffer that represents the stored data.
+  /**
+   * @param pos Position of the first byte to represent in the buffer.
+   *
+   * @param n The number of bytes to represent in the buffer. If the stored
+   * data is shorter, the buffer represents as many bytes as are available.
+   *
+   * @note The returned object is invalidated by any ring_buffer member
+   * function that modifies the stored data.
+   */
+  mutable_buffers_type data(std::size_t pos, std::size_t n) noexcept
+  {
+    pos = (std::min)(pos, size_);
+    return mutable_buffer(data_ + head_ + pos, (std::min)(n, size_ - pos));
+  }
+
+  /// Get a buffer that represents the stored data.
+  /**
+   * @param pos Position of the first byte to represent in the buffer.
+   *
+   * @param n The number of bytes to represent in the buffer. If the stored
+   * data is shorter, the buffer represents as many bytes as are available.
+   *
+   * @note The returned object is invalidated by any ring_buffer member
+   * function that modifies the stored data.
+   */
+  const_buffers_type data(std::size_t pos, std::size_t n) const noexcept
+  {
+    pos = (std::min)(pos, size_);
+    return const_buffer(data_ + head_ + pos, (std::min)(n, size_ - pos));
+  }
+
+  /// Grow the stored data by the specified number of bytes.
+  /**
+   * @throws std::length_error If <tt>size() + n > capacity()</tt>.
+   */
+  void grow(std::size_t n)
+  {
+    if (capacity_ - size_ < n)
+    {
+      std::length_error ex("ring_buffer too long");
+      asio::detail::throw_exception(ex);
+    }
+
+    size_ += n;
+  }
+
+  /// Shrink the stored data by the specified number of bytes.
+  /**
+   * Removes @c n bytes from the end of the stored data. If @c n is greater
+   * than the size of the stored data, the data is emptied.
+   */
+  void shrink(std::size_t n) noexcept
+  {
+    size_ -= (std::min)(n, size_);
+  }
+
+  /// Consume the specified number of bytes from the beginning of the stored
+  /// data.
+  /**
+   * Removes @c n bytes from the beginning of the stored data. If @c n is
+   * greater than the size of the stored data, the data is emptied. The
+   * remaining data is not moved.
+   */
+  void consume(std::size_t n) noexcept
+  {
+    n = (std::min)(n, size_);
+    size_ -= n;
+    head_ = size_ == 0 ? 0 : (head_ + n) % capacity_;
+  }
+
+private:
+  // The first of the two mappings of the underlying memory.
+  char* data_;
+
+  // The size of each mapping.
+  std::size_t capacity_;
+
+  // The offset of the first byte of data in the first mapping.
+  std::size_t head_;
+
+  // The size of the data.
+  std::size_t size_;
+};
+
+/// Adapt a ring_buffer to the DynamicBuffer_v2 requirements.
+/**
+ * The dynamic_ring_buffer class stores a reference to a ring_buffer. Copies
+ * of a dynamic_ring_buffer object refer to the same underlying storage.
+ */
+class dynamic_ring_buffer
+{
+public:
+  /// The type used to represent a sequence of constant buffers that refers to
+  /// the underlying memory.
+  typedef const_buffer const_buffers_type;
+
+  /// The type used to represent a sequence of mutable buffers that refers to
+  /// the underlying memory.
+  typedef mutable_buffer mutable_buffers_type;
+
+  /// Construct a dynamic buffer from a ring_buffer.
+  /**
+   * @param b The ring buffer to be used as backing storage for the dynamic
+   * buffer. The object stores a reference to the ring buffer and the user is
+   * responsible for ensuring that the ring buffer object remains valid while
+   * the dynamic_ring_buffer object, and copies of the object, are in use.
+   *
+   * @param maximum_size Specifies a maximum size for the buffer, in bytes.
+   * The smaller of this value and the ring buffer's capacity is used.
+   */
+  explicit dynamic_ring_buffer(ring_buffer& b,
+      std::size_t maximum_size =
+        (std::numeric_limits<std::size_t>::max)()) noexcept
+    : ring_(b),
+      max_size_((std::min)(maximum_size, b.capacity()))
+  {
+  }
+
+  /// Copy construct a dynamic buffer.
+  dynamic_ring_buffer(const dynamic_ring_buffer& other) noexcept
+    : ring_(other.ring_),
+      max_size_(other.max_size_)
+  {
+  }
+
+  /// Get the current size of the underlying memory.
+  std::size_t size() const noexcept
+  {
+    return ring_.size();
+  }
+
+  /// Get the maximum size of the dynamic buffer.
+  std::size_t max_size() const noexcept
+  {
+    return max_size_;
+  }
+
+  /// Get the maximum size that the buffer may grow to.
+  std::size_t capacity() const noexcept
+  {
+    return max_size_;
+  }
+
+  /// Get a buffer that represents the underlying memory.
+  /**
+   * @param pos Position of the first byte to represent in the buffer.
+   *
+   * @param n The number of bytes to represent in the buffer. If the
+   * underlying memory is shorter, the buffer represents as many bytes as are
+   * available.
+   *
+   * @note The returned object is invalidated by any dynamic_ring_buffer or
+   * ring_buffer member function that modifies the underlying memory.
+   */
+  mutable_buffers_type data(std::size_t pos, std::size_t n) noexcept
+  {
+    return ring_.data(pos, n);
+  }
+
+  /// Get a buffer that represents the underlying memory.
+  /**
+   * @param pos Position of the first byte to represent in the buffer.
+   *
+   * @param n The number of bytes to represent in the buffer. If the
+   * underlying memory is shorter, the buffer represents as many bytes as are
+   * available.
+   *
+   * @note The returned object is invalidated by any dynamic_ring_buffer or
+   * ring_buffer member function that modifies the underlying memory.
+   */
+  const_buffers_type data(std::size_t pos, std::size_t n) const noexcept
+  {
+    return const_cast<const ring_buffer&>(ring_).data(pos, n);
+  }
+
+  /// Grow the underlying memory by the specified number of bytes.
+  /**
+   * @throws std::length_error If <tt>size() + n > max_size()</tt>.
+   */
+  void grow(std::size_t n)
+  {
+    if (size() > max_size_ || max_size_ - size() < n)
+    {
+      std::length_error ex("dynamic_ring_buffer too long");
+      asio::detail::throw_exception(ex);
+    }
+
+    ring_.grow(n);
+  }
+
+  /// Shrink the underlying memory by the specified number of bytes.
+  /**
+   * Erases @c n bytes from the end of the underlying memory. If @c n is
+   * greater than the current size, the underlying memory is emptied.
+   */
+  void shrink(std::size_t n) noexcept
+  {
+    ring_.shrink(n);
+  }
+
+  /// Consume the specified number of bytes from the beginning of the
+  /// underlying memory.
+  /**
+   * Erases @c n bytes from the beginning of the underlying memory. If @c n is
+   * greater than the current size, the underlying memory is emptied.
+   */
+  void consume(std::size_t n) noexcept
+  {
+    ring_.consume(n);
+  }
+
+private:
+  ring_buffer& ring_;
+  const std::size_t max_size_;
+};
+
+/** @addtogroup dynamic_buffer */
+/*@{*/
+
+/// Create a new dynamic buffer that represents the given ring buffer.
+/**
+ * @returns <tt>dynamic_ring_buffer(data)</tt>.
+ */
+ASIO_NODISCARD inline dynamic_ring_buffer dynamic_buffer(
+    ring_buffer& data) noexcept
+{
+  return dynamic_ring_buffer(data);
+}
+
+/// Create a new dynamic buffer that represents the given ring buffer.
+/**
+ * @returns <tt>dynamic_ring_buffer(data, max_size)</tt>.
+ */
+ASIO_NODISCARD inline dynamic_ring_buffer dynamic_buffer(
+    ring_buffer& data, std::size_t max_size) noexcept
+{
+  return dynamic_ring_buffer(data, max_size);
+}
+
+/*@}*/
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#if defined(ASIO_HEADER_ONLY)
+# include "asio/impl/ring_buffer.ipp"
+#endif // defined(ASIO_HEADER_ONLY)
+
+#endif // defined(ASIO_HAS_MEMFD)
+       //   || defined(GENERATING_DOCUMENTATION)
+
+#endif // ASIO_RING_BUFFER_HPP
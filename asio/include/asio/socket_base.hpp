@@ -396,6 +396,91 @@ public:
       reuse_address;
 #endif
 
+#if defined(ASIO_HAS_REUSE_PORT) \
+  || defined(GENERATING_DOCUMENTATION)
+  /// Socket option to allow multiple sockets to be bound to the same address
+  /// and port.
+  /**
+   * Implements the SOL_SOCKET/SO_REUSEPORT socket option. On Linux, incoming
+   * connections or datagrams are distributed across the sockets in the group.
+   * This allows each thread or io_context to have its own listening socket.
+   * Other platforms may deliver them to only one of the sockets.
+   *
+   * @par Examples
+   * Setting the option:
+   * @code
+   * asio::ip::tcp::acceptor acceptor(my_context);
+   * ...
+   * asio::socket_base::reuse_port option(true);
+   * acceptor.set_option(option);
+   * @endcode
+   *
+   * @par
+   * Getting the current option value:
+   * @code
+   * asio::ip::tcp::acceptor acceptor(my_context);
+   * ...
+   * asio::socket_base::reuse_port option;
+   * acceptor.get_option(option);
+   * bool is_set = option.value();
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Boolean_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined reuse_port;
+#else
+  typedef asio::detail::socket_option::boolean<
+    ASIO_OS_DEF(SOL_SOCKET), ASIO_OS_DEF(SO_REUSEPORT)>
+      reuse_port;
+#endif
+#endif // defined(ASIO_HAS_REUSE_PORT)
+       //   || defined(GENERATING_DOCUMENTATION)
+
+#if defined(ASIO_HAS_INCOMING_CPU) \
+  || defined(GENERATING_DOCUMENTATION)
+
+  /// Socket option for the CPU affinity of a socket.
+  /**
+   * Implements the SOL_SOCKET/SO_INCOMING_CPU socket option. When set on a
+   * socket in a SO_REUSEPORT group, connections or datagrams received on the
+   * specified CPU are preferentially delivered to that socket. When read from
+   * an accepted socket, the value is the CPU on which the connection's packets
+   * were last received.
+   *
+   * @par Examples
+   * Setting the option:
+   * @code
+   * asio::ip::tcp::acceptor acceptor(my_context);
+   * ...
+   * asio::socket_base::incoming_cpu option(3);
+   * acceptor.set_option(option);
+   * @endcode
+   *
+   * @par
+   * Getting the current option value:
+   * @code
+   * asio::ip::tcp::socket socket(my_context);
+   * ...
+   * asio::socket_base::incoming_cpu option;
+   * socket.get_option(option);
+   * int cpu = option.value();
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Integer_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined incoming_cpu;
+#else
+  typedef asio::detail::socket_option::integer<
+    ASIO_OS_DEF(SOL_SOCKET), ASIO_OS_DEF(SO_INCOMING_CPU)>
+      incoming_cpu;
+#endif
+#endif // defined(ASIO_HAS_INCOMING_CPU)
+       //   || defined(GENERATING_DOCUMENTATION)
+
   /// Socket option to specify whether the socket lingers on close if unsent
   /// data is present.
   /**
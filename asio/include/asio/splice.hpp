@@ -0,0 +1,148 @@
+//
+// splice.hpp
+// ~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_SPLICE_HPP
+#define ASIO_SPLICE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_SPLICE) \
+  || defined(GENERATING_DOCUMENTATION)
+
+#include <cstddef>
+#include "asio/async_result.hpp"
+#include "asio/basic_readable_pipe.hpp"
+#include "asio/basic_stream_socket.hpp"
+#include "asio/basic_writable_pipe.hpp"
+#include "asio/error.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+template <typename> class initiate_async_splice;
+
+} // namespace detail
+
+/**
+ * @defgroup async_splice asio::async_splice
+ *
+ * @brief The @c async_splice function is a composed asynchronous operation
+ * that moves data from one stream socket to another, without copying the data
+ * through user space.
+ */
+/*@{*/
+
+/// Start an asynchronous operation to move data from one stream socket to
+/// another.
+/**
+ * This function is used to asynchronously move a certain number of bytes of
+ * data from one stream socket to another, by way of an internal pipe. It is an
+ * initiating function for an @ref asynchronous_operation, and always returns
+ * immediately. The asynchronous operation will continue until one of the
+ * following conditions is true:
+ *
+ * @li The requested number of bytes has been moved.
+ *
+ * @li The peer of the source socket closed the connection, in which case the
+ * operation completes with the error asio::error::eof.
+ *
+ * @li An error occurred.
+ *
+ * This operation is implemented in terms of zero or more calls to the source
+ * socket's async_splice_to_pipe function and the destination socket's
+ * async_splice_from_pipe function, and is known as a <em>composed
+ * operation</em>. The program must ensure that the source socket performs no
+ * other read operations, and that the destination socket performs no other
+ * write operations, until this operation completes.
+ *
+ * @param from The socket from which the data is to be read.
+ *
+ * @param to The socket to which the data is to be written.
+ *
+ * @param max_bytes The number of bytes to be moved. To move data until the
+ * source connection is closed, specify the maximum value of @c std::size_t.
+ *
+ * @param token The @ref completion_token that will be used to produce a
+ * completion handler, which will be called when the operation completes.
+ * Potential completion tokens include @ref use_future, @ref use_awaitable,
+ * @ref yield_context, or a function object with the correct completion
+ * signature. The function signature of the completion handler must be:
+ * @code void handler(
+ *   // Result of operation.
+ *   const asio::error_code& error,
+ *
+ *   // Number of bytes written to the destination socket.
+ *   std::size_t bytes_transferred
+ * ); @endcode
+ * Regardless of whether the asynchronous operation completes immediately or
+ * not, the completion handler will not be invoked from within this function.
+ * On immediate completion, invocation of the handler will be performed in a
+ * manner equivalent to using asio::async_immediate().
+ *
+ * @par Completion Signature
+ * @code void(asio::error_code, std::size_t) @endcode
+ *
+ * @par Example
+ * To forward data from a client to a server until the client disconnects:
+ * @code
+ * asio::async_splice(client, server,
+ *     std::numeric_limits<std::size_t>::max(), handler);
+ * @endcode
+ *
+ * @par Per-Operation Cancellation
+ * This asynchronous operation supports cancellation for the following
+ * asio::cancellation_type values:
+ *
+ * @li @c cancellation_type::terminal
+ *
+ * @li @c cancellation_type::partial
+ *
+ * Data that has been read from the source socket, but not yet written to the
+ * destination socket, is discarded when the operation is cancelled.
+ */
+template <typename Protocol, typename Executor,
+    typename Protocol1, typename Executor1,
+    ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+      std::size_t)) SpliceToken = default_completion_token_t<Executor>>
+inline auto async_splice(basic_stream_socket<Protocol, Executor>& from,
+    basic_stream_socket<Protocol1, Executor1>& to, std::size_t max_bytes,
+    SpliceToken&& token = default_completion_token_t<Executor>())
+  -> decltype(
+    async_initiate<SpliceToken,
+      void (asio::error_code, std::size_t)>(
+        declval<detail::initiate_async_splice<
+          basic_stream_socket<Protocol, Executor>>>(),
+        token, &to, max_bytes))
+{
+  return async_initiate<SpliceToken,
+    void (asio::error_code, std::size_t)>(
+      detail::initiate_async_splice<
+        basic_stream_socket<Protocol, Executor>>(from),
+      token, &to, max_bytes);
+}
+
+/*@}*/
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#include "asio/impl/splice.hpp"
+
+#endif // defined(ASIO_HAS_SPLICE)
+       //   || defined(GENERATING_DOCUMENTATION)
+
+#endif // ASIO_SPLICE_HPP
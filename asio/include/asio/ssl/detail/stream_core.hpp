@@ -21,6 +21,10 @@
 #include "asio/buffer.hpp"
 #include "asio/steady_timer.hpp"
 
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+# include "asio/detail/allocation_accounting_service.hpp"
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+
 #include "asio/detail/push_options.hpp"
 
 namespace asio {
@@ -42,6 +46,10 @@ struct stream_core
       output_buffer_(asio::buffer(output_buffer_space_)),
       input_buffer_space_(max_tls_record_size),
       input_buffer_(asio::buffer(input_buffer_space_))
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+      , buffer_tracker_(&asio::detail::get_allocation_counters(ex),
+          asio::detail::allocation_counters::ssl, 2 * max_tls_record_size)
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
   {
     pending_read_.expires_at(neg_infin());
     pending_write_.expires_at(neg_infin());
@@ -56,6 +64,10 @@ struct stream_core
       output_buffer_(asio::buffer(output_buffer_space_)),
       input_buffer_space_(max_tls_record_size),
       input_buffer_(asio::buffer(input_buffer_space_))
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+      , buffer_tracker_(&asio::detail::get_allocation_counters(ex),
+          asio::detail::allocation_counters::ssl, 2 * max_tls_record_size)
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
   {
     pending_read_.expires_at(neg_infin());
     pending_write_.expires_at(neg_infin());
@@ -78,6 +90,11 @@ struct stream_core
             other.input_buffer_space_)),
       input_buffer_(other.input_buffer_),
       input_(other.input_)
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+      , buffer_tracker_(
+          static_cast<asio::detail::allocation_tracker&&>(
+            other.buffer_tracker_))
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
   {
     other.output_buffer_ = asio::mutable_buffer(0, 0);
     other.input_buffer_ = asio::mutable_buffer(0, 0);
@@ -108,6 +125,11 @@ struct stream_core
           other.input_buffer_space_);
       input_buffer_ = other.input_buffer_;
       input_ = other.input_;
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+      buffer_tracker_ =
+        static_cast<asio::detail::allocation_tracker&&>(
+          other.buffer_tracker_);
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
       other.output_buffer_ = asio::mutable_buffer(0, 0);
       other.input_buffer_ = asio::mutable_buffer(0, 0);
       other.input_ = asio::const_buffer(0, 0);
@@ -157,6 +179,11 @@ struct stream_core
 
   // The buffer pointing to the engine's unconsumed input.
   asio::const_buffer input_;
+
+#if defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
+  // Records the memory used by the input and output buffer space.
+  asio::detail::allocation_tracker buffer_tracker_;
+#endif // defined(ASIO_ENABLE_ALLOCATION_ACCOUNTING)
 };
 
 } // namespace detail
@@ -0,0 +1,148 @@
+//
+// transfer_file.hpp
+// ~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_TRANSFER_FILE_HPP
+#define ASIO_TRANSFER_FILE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_SENDFILE) \
+  || defined(GENERATING_DOCUMENTATION)
+
+#include <cstddef>
+#include "asio/async_result.hpp"
+#include "asio/basic_random_access_file.hpp"
+#include "asio/basic_stream_socket.hpp"
+#include "asio/detail/cstdint.hpp"
+#include "asio/error.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+template <typename> class initiate_async_transfer_file;
+
+} // namespace detail
+
+/**
+ * @defgroup async_transfer_file asio::async_transfer_file
+ *
+ * @brief The @c async_transfer_file function is a composed asynchronous
+ * operation that writes a range of a file to a stream socket, without copying
+ * the file's contents through user space.
+ */
+/*@{*/
+
+/// Start an asynchronous operation to write a range of a file to a stream
+/// socket.
+/**
+ * This function is used to asynchronously write a certain number of bytes of
+ * data from a file to a stream socket. It is an initiating function for an
+ * @ref asynchronous_operation, and always returns immediately. The
+ * asynchronous operation will continue until one of the following conditions
+ * is true:
+ *
+ * @li The requested number of bytes has been written.
+ *
+ * @li The end of the file was reached, in which case the operation completes
+ * with the error asio::error::eof.
+ *
+ * @li An error occurred.
+ *
+ * This operation is implemented in terms of zero or more calls to the socket's
+ * async_send_file function, and is known as a <em>composed operation</em>. The
+ * program must ensure that the socket performs no other write operations (such
+ * as async_write, the socket's async_write_some function, or any other composed
+ * operations that perform writes) until this operation completes.
+ *
+ * @param s The socket to which the data is to be written.
+ *
+ * @param file The file from which the data is to be read. Ownership of the
+ * file object is retained by the caller, which must guarantee that it remains
+ * open until the completion handler is called.
+ *
+ * @param offset The offset in the file at which the data will be read.
+ *
+ * @param length The number of bytes to be written.
+ *
+ * @param token The @ref completion_token that will be used to produce a
+ * completion handler, which will be called when the transfer completes.
+ * Potential completion tokens include @ref use_future, @ref use_awaitable,
+ * @ref yield_context, or a function object with the correct completion
+ * signature. The function signature of the completion handler must be:
+ * @code void handler(
+ *   // Result of operation.
+ *   const asio::error_code& error,
+ *
+ *   // Number of bytes written to the socket. If an error
+ *   // occurred, this will be less than the requested length.
+ *   std::size_t bytes_transferred
+ * ); @endcode
+ * Regardless of whether the asynchronous operation completes immediately or
+ * not, the completion handler will not be invoked from within this function.
+ * On immediate completion, invocation of the handler will be performed in a
+ * manner equivalent to using asio::async_immediate().
+ *
+ * @par Completion Signature
+ * @code void(asio::error_code, std::size_t) @endcode
+ *
+ * @par Example
+ * @code
+ * asio::random_access_file file(my_io_context, "index.html",
+ *     asio::random_access_file::read_only);
+ * asio::async_transfer_file(socket, file, 0, file.size(), handler);
+ * @endcode
+ *
+ * @par Per-Operation Cancellation
+ * This asynchronous operation supports cancellation for the following
+ * asio::cancellation_type values:
+ *
+ * @li @c cancellation_type::terminal
+ *
+ * @li @c cancellation_type::partial
+ */
+template <typename Protocol, typename Executor, typename FileExecutor,
+    ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+      std::size_t)) TransferToken = default_completion_token_t<Executor>>
+inline auto async_transfer_file(basic_stream_socket<Protocol, Executor>& s,
+    basic_random_access_file<FileExecutor>& file,
+    uint64_t offset, std::size_t length,
+    TransferToken&& token = default_completion_token_t<Executor>())
+  -> decltype(
+    async_initiate<TransferToken,
+      void (asio::error_code, std::size_t)>(
+        declval<detail::initiate_async_transfer_file<
+          basic_stream_socket<Protocol, Executor>>>(),
+        token, &file, offset, length))
+{
+  return async_initiate<TransferToken,
+    void (asio::error_code, std::size_t)>(
+      detail::initiate_async_transfer_file<
+        basic_stream_socket<Protocol, Executor>>(s),
+      token, &file, offset, length);
+}
+
+/*@}*/
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#include "asio/impl/transfer_file.hpp"
+
+#endif // defined(ASIO_HAS_SENDFILE)
+       //   || defined(GENERATING_DOCUMENTATION)
+
+#endif // ASIO_TRANSFER_FILE_HPP
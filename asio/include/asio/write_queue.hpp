@@ -0,0 +1,255 @@
+//
+// write_queue.hpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_WRITE_QUEUE_HPP
+#define ASIO_WRITE_QUEUE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+#include <deque>
+#include <vector>
+#include "asio/any_completion_handler.hpp"
+#include "asio/async_result.hpp"
+#include "asio/buffer.hpp"
+#include "asio/detail/buffer_sequence_adapter.hpp"
+#include "asio/detail/mutex.hpp"
+#include "asio/detail/noncopyable.hpp"
+#include "asio/detail/type_traits.hpp"
+#include "asio/error.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+template <typename> class initiate_async_write_queue;
+template <typename, typename> class write_queue_op;
+template <typename> class write_queue_start_handler;
+template <typename> class write_queue_write_handler;
+
+} // namespace detail
+
+/// Serialises and coalesces asynchronous writes to a stream.
+/**
+ * The write_queue class template allows any number of messages to be
+ * written to a stream without waiting for earlier writes to complete. Only
+ * one write is outstanding on the underlying stream at a time. While it is in
+ * progress, newly submitted messages are queued. When the write completes,
+ * all queued messages are gathered into a single scatter-gather write of up
+ * to @c max_buffers buffers. This reduces the number of system calls when
+ * many small messages are sent, such as on a socket where Nagle's algorithm
+ * has been disabled using asio::ip::tcp::no_delay.
+ *
+ * Messages are written in the order in which they were submitted, and each
+ * message's completion handler is called once all of its bytes have been
+ * written.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Safe, for @c async_write only.
+ *
+ * The @c async_write function may be called concurrently from multiple
+ * threads. Writes to the underlying stream are started on, and their
+ * completions run in, the stream's executor. If other operations are
+ * performed on the stream concurrently, such as reads, the stream's executor
+ * should be a strand.
+ *
+ * @par Concepts:
+ * AsyncWriteStream.
+ */
+template <typename AsyncWriteStream>
+class write_queue
+  : private noncopyable
+{
+public:
+  /// The type of the next layer.
+  typedef remove_reference_t<AsyncWriteStream> next_layer_type;
+
+  /// The type of the executor associated with the object.
+  typedef typename next_layer_type::executor_type executor_type;
+
+#if defined(GENERATING_DOCUMENTATION)
+  /// The maximum number of buffers written in a single operation.
+  static const std::size_t max_buffers = implementation_defined;
+#else
+  ASIO_STATIC_CONSTANT(std::size_t, max_buffers
+      = detail::buffer_sequence_adapter_base::max_buffers);
+#endif
+
+  /// Construct, passing the specified argument to initialise the next layer.
+  template <typename Arg>
+  explicit write_queue(Arg&& a)
+    : next_layer_(static_cast<Arg&&>(a)),
+      writing_(false)
+  {
+  }
+
+  /// Destructor.
+  /**
+   * The write_queue must not be destroyed while a write is in progress.
+   */
+  ~write_queue()
+  {
+  }
+
+  /// Get a reference to the next layer.
+  next_layer_type& next_layer()
+  {
+    return next_layer_;
+  }
+
+  /// Get the executor associated with the object.
+  executor_type get_executor() noexcept
+  {
+    return next_layer_.get_executor();
+  }
+
+  /// Get the number of messages that have not yet been completely written.
+  std::size_t pending() const
+  {
+    detail::mutex::scoped_lock lock(mutex_);
+    return messages_.size();
+  }
+
+  /// Start an asynchronous operation to write a message to the stream.
+  /**
+   * This function is used to asynchronously write a complete message to the
+   * stream. It is an initiating function for an @ref asynchronous_operation,
+   * and always returns immediately.
+   *
+   * Unlike asio::async_write(), this function may be called again before the
+   * previous operation has completed. The message is written after all
+   * previously submitted messages.
+   *
+   * @param buffers One or more buffers containing the message to be written.
+   * Although the buffers object may be copied as necessary, ownership of the
+   * underlying memory blocks is retained by the caller, which must guarantee
+   * that they remain valid until the completion handler is called.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the write completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   // Result of operation.
+   *   const asio::error_code& error,
+   *
+   *   // Number of bytes of the message written. If an error occurred, this
+   *   // will be less than the size of the message.
+   *   std::size_t bytes_transferred
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @note If a write to the stream fails, all messages queued at that time
+   * complete with the error.
+   */
+  template <typename ConstBufferSequence,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) WriteToken = default_completion_token_t<executor_type>>
+  auto async_write(const ConstBufferSequence& buffers,
+      WriteToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<WriteToken,
+        void (asio::error_code, std::size_t)>(
+          declval<detail::initiate_async_write_queue<AsyncWriteStream>>(),
+          token, buffers));
+
+private:
+  template <typename> friend class detail::initiate_async_write_queue;
+  template <typename, typename> friend class detail::write_queue_op;
+  template <typename> friend class detail::write_queue_start_handler;
+  template <typename> friend class detail::write_queue_write_handler;
+
+  typedef any_completion_handler<
+    void (asio::error_code, std::size_t)> handler_type;
+
+  // A message that has not been completely written.
+  struct message
+  {
+    message(std::size_t n, handler_type&& h)
+      : size(n),
+        remaining(n),
+        handler(static_cast<handler_type&&>(h))
+    {
+    }
+
+    std::size_t size;
+    std::size_t remaining;
+    handler_type handler;
+  };
+
+  // A message that is ready to be completed.
+  struct completion
+  {
+    completion(handler_type&& h, std::size_t n)
+      : handler(static_cast<handler_type&&>(h)),
+        bytes_transferred(n)
+    {
+    }
+
+    handler_type handler;
+    std::size_t bytes_transferred;
+  };
+
+  // Add a message to the queue, starting the write loop if it is idle.
+  template <typename ConstBufferSequence, typename Handler>
+  void enqueue(const ConstBufferSequence& buffers, Handler& handler);
+
+  // Gather queued buffers and start a write, or go idle.
+  void start_write();
+
+  // Consume the bytes written and continue the write loop.
+  void handle_write(const asio::error_code& ec, std::size_t n);
+
+  // Invoke the handlers for completed messages.
+  static void deliver(std::vector<completion>& completions,
+      const asio::error_code& ec);
+
+  // The next layer.
+  AsyncWriteStream next_layer_;
+
+  // Protects the queued buffers and messages, and the writing flag.
+  mutable detail::mutex mutex_;
+
+  // The buffers that have not yet been written, in order.
+  std::deque<const_buffer> buffers_;
+
+  // The messages that have not yet been completely written, in order.
+  std::deque<message> messages_;
+
+  // Whether a write loop is active.
+  bool writing_;
+
+  // The buffers passed to the write that is in progress. Only accessed by the
+  // write loop.
+  const_buffer batch_[max_buffers];
+
+  // Messages completed by the write loop. Only accessed by the write loop.
+  std::vector<completion> completed_;
+};
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#include "asio/impl/write_queue.hpp"
+
+#endif // ASIO_WRITE_QUEUE_HPP
@@ -68,6 +68,15 @@ void file_handler::operator()(const request& req, reply& rep)
 
   // Fill out the reply to be sent to the client.
   rep.status = reply::ok;
+#if defined(ASIO_HAS_SENDFILE)
+  // Leave the file's contents to be transferred directly from the file to the
+  // socket, without being copied into the reply. The server adds the
+  // Content-Length header once it has opened the file.
+  rep.content_file = full_path;
+  rep.headers.resize(1);
+  rep.headers[0].name = "Content-Type";
+  rep.headers[0].value = mime_types::extension_to_type(extension);
+#else // defined(ASIO_HAS_SENDFILE)
   char buf[512];
   while (is.read(buf, sizeof(buf)).gcount() > 0)
     rep.content.append(buf, is.gcount());
@@ -76,6 +85,7 @@ void file_handler::operator()(const request& req, reply& rep)
   rep.headers[0].value = std::to_string(rep.content.size());
   rep.headers[1].name = "Content-Type";
   rep.headers[1].value = mime_types::extension_to_type(extension);
+#endif // defined(ASIO_HAS_SENDFILE)
 }
 
 bool file_handler::url_decode(const std::string& in, std::string& out)
@@ -49,6 +49,14 @@ struct reply
   /// The content to be sent in the reply.
   std::string content;
 
+  /// The path of a file whose contents are to be sent after the content, or
+  /// empty if there is no such file.
+  std::string content_file;
+
+  /// The number of bytes to be sent from the content file. This is determined
+  /// when the file is opened for sending.
+  std::size_t content_file_size = 0;
+
   /// Convert the reply into a vector of buffers. The buffers do not own the
   /// underlying memory blocks, therefore the reply object must remain valid and
   /// not be changed until the write operation has completed.
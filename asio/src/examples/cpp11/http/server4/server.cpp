@@ -101,9 +101,51 @@ void server::operator()(std::error_code ec, std::size_t length)
         *reply_ = reply::stock_reply(reply::bad_request);
       }
 
+#if defined(ASIO_HAS_SENDFILE)
+      // Open the requested file, if any, and determine its size before the
+      // headers are sent, so that a failure can still be reported.
+      if (!reply_->content_file.empty())
+      {
+        file_.reset(new asio::random_access_file(socket_->get_executor()));
+        file_->open(reply_->content_file,
+            asio::random_access_file::read_only, ec);
+        if (ec)
+        {
+          *reply_ = reply::stock_reply(reply::not_found);
+        }
+        else
+        {
+          reply_->content_file_size =
+            static_cast<std::size_t>(file_->size(ec));
+          if (ec)
+          {
+            *reply_ = reply::stock_reply(reply::internal_server_error);
+          }
+          else
+          {
+            header content_length;
+            content_length.name = "Content-Length";
+            content_length.value =
+              std::to_string(reply_->content_file_size);
+            reply_->headers.push_back(content_length);
+          }
+        }
+      }
+#endif // defined(ASIO_HAS_SENDFILE)
+
       // Send the reply back to the client.
       yield asio::async_write(*socket_, reply_->to_buffers(), *this);
 
+#if defined(ASIO_HAS_SENDFILE)
+      // Send the contents of the requested file, if any, directly from the
+      // file to the socket.
+      if (!reply_->content_file.empty())
+      {
+        yield asio::async_transfer_file(*socket_, *file_,
+            0, reply_->content_file_size, *this);
+      }
+#endif // defined(ASIO_HAS_SENDFILE)
+
       // Initiate graceful connection closure.
       socket_->shutdown(tcp::socket::shutdown_both, ec);
     }
@@ -65,6 +65,11 @@ private:
 
   /// The reply to be sent back to the client.
   std::shared_ptr<reply> reply_;
+
+#if defined(ASIO_HAS_SENDFILE)
+  /// The file whose contents are sent as part of the reply.
+  std::shared_ptr<asio::random_access_file> file_;
+#endif // defined(ASIO_HAS_SENDFILE)
 };
 
 } // namespace server4
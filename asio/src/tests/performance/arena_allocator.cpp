@@ -0,0 +1,150 @@
+//
+// arena_allocator.cpp
+// ~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "asio.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+
+using asio::local::stream_protocol;
+
+// Produces the allocator for each session's handlers. The default recycling
+// allocator is shared by all sessions.
+struct use_recycling_allocator
+{
+  typedef asio::recycling_allocator<void> allocator_type;
+
+  allocator_type get_allocator()
+  {
+    return allocator_type();
+  }
+
+};
+
+// Each session has an arena of its own.
+struct use_arena_allocator
+{
+  typedef asio::arena_allocator<void> allocator_type;
+
+  allocator_type get_allocator()
+  {
+    return allocator_type(arena_);
+  }
+
+  asio::arena arena_;
+};
+
+// One end of an echo session that uses the composed read and write
+// operations, with handlers that carry Padding bytes of state. Each session's
+// memory is released when the session is destroyed.
+template <std::size_t Padding, typename Memory>
+class session
+  : public std::enable_shared_from_this<session<Padding, Memory>>
+{
+public:
+  session(stream_protocol::socket socket, int exchanges)
+    : socket_(std::move(socket)),
+      exchanges_(exchanges)
+  {
+  }
+
+  void start_write()
+  {
+    auto self(this->shared_from_this());
+    char padding[Padding] = {};
+    asio::async_write(socket_, asio::buffer(data_),
+        asio::bind_allocator(memory_.get_allocator(),
+          [this, self, padding](asio::error_code ec, std::size_t)
+          {
+            (void)padding;
+            if (!ec)
+              start_read();
+          }));
+  }
+
+  void start_read()
+  {
+    auto self(this->shared_from_this());
+    char padding[Padding] = {};
+    asio::async_read(socket_, asio::buffer(data_),
+        asio::bind_allocator(memory_.get_allocator(),
+          [this, self, padding](asio::error_code ec, std::size_t)
+          {
+            (void)padding;
+            if (!ec && --exchanges_ > 0)
+              start_write();
+          }));
+  }
+
+private:
+  stream_protocol::socket socket_;
+  Memory memory_;
+  int exchanges_;
+  char data_[64];
+};
+
+template <std::size_t Padding, typename Memory>
+void run(const char* name, int session_count, int exchanges)
+{
+  typedef session<Padding, Memory> session_type;
+
+  asio::io_context io_context(1);
+
+  for (int i = 0; i < session_count; ++i)
+  {
+    stream_protocol::socket s1(io_context);
+    stream_protocol::socket s2(io_context);
+    asio::local::connect_pair(s1, s2);
+
+    auto a = std::make_shared<session_type>(std::move(s1), exchanges);
+    auto b = std::make_shared<session_type>(std::move(s2), exchanges);
+    a->start_write();
+    b->start_read();
+  }
+
+  typedef std::chrono::steady_clock clock;
+  clock::time_point start = clock::now();
+  std::size_t handlers = io_context.run();
+  clock::duration elapsed = clock::now() - start;
+  double seconds = std::chrono::duration<double>(elapsed).count();
+
+  std::cout << "  " << name << ": " << (handlers / seconds)
+    << " handlers/s\n";
+}
+
+template <std::size_t Padding>
+void run_all(int session_count, int exchanges)
+{
+  std::cout << Padding << " bytes of handler state:\n";
+  run<Padding, use_recycling_allocator>(
+      "recycling_allocator", session_count, exchanges);
+  run<Padding, use_arena_allocator>(
+      "arena_allocator", session_count, exchanges);
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc != 3)
+  {
+    std::cerr << "Usage: arena_allocator <sessions> <exchanges>\n";
+    return 1;
+  }
+
+  int session_count = std::atoi(argv[1]);
+  int exchanges = std::atoi(argv[2]);
+
+  run_all<16>(session_count, exchanges);
+  run_all<200>(session_count, exchanges);
+  run_all<600>(session_count, exchanges);
+  run_all<1500>(session_count, exchanges);
+
+  return 0;
+}
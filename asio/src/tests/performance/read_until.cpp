@@ -0,0 +1,113 @@
+//
+// read_until.cpp
+// ~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "asio.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "asio/detail/buffer_search.hpp"
+
+typedef std::vector<asio::const_buffer> buffers_type;
+typedef asio::buffers_iterator<buffers_type> iterator;
+
+// Search using iterators over the individual bytes of the buffer sequence.
+std::size_t iterator_search(const buffers_type& buffers,
+    const std::string& delim)
+{
+  iterator begin = iterator::begin(buffers);
+  iterator end = iterator::end(buffers);
+  if (delim.size() == 1)
+    return std::find(begin, end, delim[0]) - begin;
+  return std::search(begin, end, delim.begin(), delim.end()) - begin;
+}
+
+// Search one buffer at a time.
+std::size_t buffer_search(const buffers_type& buffers,
+    const std::string& delim)
+{
+  if (delim.size() == 1)
+    return asio::detail::buffer_find(buffers, 0, delim[0]).first;
+  return asio::detail::buffer_partial_search(
+      buffers, 0, delim.data(), delim.size()).first;
+}
+
+template <typename Search>
+void run(const char* name, Search search, const buffers_type& buffers,
+    const std::string& delim, std::size_t expected, int iterations)
+{
+  typedef std::chrono::steady_clock clock;
+  clock::time_point start = clock::now();
+
+  std::size_t result = 0;
+  for (int i = 0; i < iterations; ++i)
+    result += search(buffers, delim) == expected ? 1 : 0;
+
+  clock::duration elapsed = clock::now() - start;
+  double seconds = std::chrono::duration<double>(elapsed).count();
+  double bytes = static_cast<double>(expected) * iterations;
+
+  std::cout << "  " << name << ": " << (bytes / seconds / 1048576.0)
+    << " MB/s" << (result == std::size_t(iterations) ? "" : " (mismatch)")
+    << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc != 4)
+  {
+    std::cerr << "Usage: read_until <size> <buffer_size> <iterations>\n";
+    return 1;
+  }
+
+  std::size_t size = std::atoi(argv[1]);
+  std::size_t buffer_size = std::atoi(argv[2]);
+  int iterations = std::atoi(argv[3]);
+  if (size == 0 || buffer_size == 0)
+  {
+    std::cerr << "Size and buffer size must be non-zero\n";
+    return 1;
+  }
+
+  // Build a message of header-like lines ending in a blank line, so that the
+  // CRLF delimiter is found early and the CRLFCRLF delimiter at the end.
+  std::string data;
+  while (data.size() < size)
+    data += "X-Header-Field: abcdefghijklmnopqrstuvwxyz0123456789\r\n";
+  data += "\r\n";
+
+  buffers_type buffers;
+  for (std::size_t pos = 0; pos < data.size(); pos += buffer_size)
+  {
+    buffers.push_back(asio::buffer(data.data() + pos,
+          (std::min)(buffer_size, data.size() - pos)));
+  }
+
+  const char* delims[] = { "\n", "\r\n", "\r\n\r\n" };
+  for (std::size_t i = 0; i < sizeof(delims) / sizeof(delims[0]); ++i)
+  {
+    std::string delim = delims[i];
+    std::size_t expected = data.find(delim);
+
+    std::string name;
+    for (std::size_t j = 0; j < delim.size(); ++j)
+      name += delim[j] == '\r' ? "\\r" : "\\n";
+    std::cout << "\"" << name << "\" at offset " << expected << ":\n";
+
+    // Repeat the short searches so that the timings are comparable.
+    int n = static_cast<int>(iterations * (data.size() / (expected + 1)));
+    run("buffers_iterator", iterator_search, buffers, delim, expected, n);
+    run("buffer_search", buffer_search, buffers, delim, expected, n);
+  }
+
+  return 0;
+}
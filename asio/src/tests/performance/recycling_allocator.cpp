@@ -0,0 +1,182 @@
+//
+// recycling_allocator.cpp
+// ~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "asio.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using asio::local::stream_protocol;
+
+struct results
+{
+  int sessions_remaining;
+  asio::recycling_allocator_statistics stats;
+};
+
+// An allocator that always uses the heap, for comparison.
+template <typename T>
+class heap_allocator
+{
+public:
+  typedef T value_type;
+
+  heap_allocator()
+  {
+  }
+
+  template <typename U>
+  heap_allocator(const heap_allocator<U>&)
+  {
+  }
+
+  T* allocate(std::size_t n)
+  {
+    return static_cast<T*>(::operator new(sizeof(T) * n));
+  }
+
+  void deallocate(T* p, std::size_t)
+  {
+    ::operator delete(p);
+  }
+
+  bool operator==(const heap_allocator&) const
+  {
+    return true;
+  }
+
+  bool operator!=(const heap_allocator&) const
+  {
+    return false;
+  }
+};
+
+// One end of an echo session, in the style of the allocation example. The
+// handlers carry Padding bytes of state so that the size of the operations
+// varies between runs.
+template <std::size_t Padding, typename Allocator>
+class session
+  : public std::enable_shared_from_this<session<Padding, Allocator>>
+{
+public:
+  session(stream_protocol::socket socket, const Allocator& allocator,
+      int exchanges, results* r)
+    : socket_(std::move(socket)),
+      allocator_(allocator),
+      exchanges_(exchanges),
+      results_(r)
+  {
+  }
+
+  void start_write()
+  {
+    auto self(this->shared_from_this());
+    char padding[Padding] = {};
+    asio::async_write(socket_, asio::buffer(data_, sizeof(data_)),
+        asio::bind_allocator(allocator_,
+          [this, self, padding](asio::error_code ec, std::size_t)
+          {
+            (void)padding;
+            if (!ec)
+              start_read();
+          }));
+  }
+
+  void start_read()
+  {
+    auto self(this->shared_from_this());
+    char padding[Padding] = {};
+    socket_.async_read_some(asio::buffer(data_),
+        asio::bind_allocator(allocator_,
+          [this, self, padding](asio::error_code ec, std::size_t)
+          {
+            (void)padding;
+            if (!ec && --exchanges_ > 0)
+              start_write();
+            else if (--results_->sessions_remaining == 0)
+              results_->stats =
+                asio::this_thread_recycling_allocator_statistics();
+          }));
+  }
+
+private:
+  stream_protocol::socket socket_;
+  Allocator allocator_;
+  int exchanges_;
+  results* results_;
+  char data_[64];
+};
+
+template <std::size_t Padding, typename Allocator>
+void run(const char* name, const Allocator& allocator,
+    int session_count, int exchanges)
+{
+  asio::io_context io_context(1);
+  results r = { session_count * 2, asio::recycling_allocator_statistics() };
+
+  for (int i = 0; i < session_count; ++i)
+  {
+    stream_protocol::socket s1(io_context);
+    stream_protocol::socket s2(io_context);
+    asio::local::connect_pair(s1, s2);
+
+    auto a = std::make_shared<session<Padding, Allocator>>(
+        std::move(s1), allocator, exchanges, &r);
+    auto b = std::make_shared<session<Padding, Allocator>>(
+        std::move(s2), allocator, exchanges, &r);
+    a->start_write();
+    b->start_read();
+  }
+
+  typedef std::chrono::steady_clock clock;
+  clock::time_point start = clock::now();
+  std::size_t handlers = io_context.run();
+  clock::duration elapsed = clock::now() - start;
+  double seconds = std::chrono::duration<double>(elapsed).count();
+
+  std::cout << "  " << name << ": " << (handlers / seconds)
+    << " handlers/s\n";
+  std::cout << "    " << r.stats.allocations << " allocations, "
+    << r.stats.cache_hits << " cache hits, "
+    << r.stats.depot_refills << " refills, "
+    << r.stats.depot_flushes << " flushes, "
+    << r.stats.heap_allocations << " heap allocations\n";
+}
+
+template <std::size_t Padding>
+void run_all(int session_count, int exchanges)
+{
+  std::cout << Padding << " bytes of handler state:\n";
+  run<Padding>("recycling_allocator",
+      asio::recycling_allocator<void>(), session_count, exchanges);
+  run<Padding>("heap_allocator",
+      heap_allocator<void>(), session_count, exchanges);
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc != 3)
+  {
+    std::cerr << "Usage: recycling_allocator <sessions> <exchanges>\n";
+    return 1;
+  }
+
+  int session_count = std::atoi(argv[1]);
+  int exchanges = std::atoi(argv[2]);
+
+  run_all<16>(session_count, exchanges);
+  run_all<200>(session_count, exchanges);
+  run_all<600>(session_count, exchanges);
+  run_all<1500>(session_count, exchanges);
+
+  return 0;
+}
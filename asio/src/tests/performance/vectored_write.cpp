@@ -0,0 +1,191 @@
+//
+// vectored_write.cpp
+// ~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "asio.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using asio::local::stream_protocol;
+
+// Wraps a socket to count the number of calls to write_some.
+class counting_stream
+{
+public:
+  typedef stream_protocol::socket::executor_type executor_type;
+
+  explicit counting_stream(stream_protocol::socket& socket)
+    : socket_(socket),
+      calls_(0)
+  {
+  }
+
+  executor_type get_executor() noexcept
+  {
+    return socket_.get_executor();
+  }
+
+  template <typename ConstBufferSequence>
+  std::size_t write_some(const ConstBufferSequence& buffers,
+      asio::error_code& ec)
+  {
+    ++calls_;
+    return socket_.write_some(buffers, ec);
+  }
+
+  template <typename ConstBufferSequence>
+  std::size_t write_some(const ConstBufferSequence& buffers)
+  {
+    ++calls_;
+    return socket_.write_some(buffers);
+  }
+
+  template <typename ConstBufferSequence, typename WriteToken>
+  auto async_write_some(const ConstBufferSequence& buffers,
+      WriteToken&& token)
+    -> decltype(
+      std::declval<stream_protocol::socket&>().async_write_some(
+        buffers, static_cast<WriteToken&&>(token)))
+  {
+    ++calls_;
+    return socket_.async_write_some(buffers,
+        static_cast<WriteToken&&>(token));
+  }
+
+  std::size_t calls() const
+  {
+    return calls_;
+  }
+
+private:
+  stream_protocol::socket& socket_;
+  std::size_t calls_;
+};
+
+// Discards everything written to the socket until the peer closes it.
+void drain(stream_protocol::socket& socket)
+{
+  std::vector<char> data(65536);
+  asio::error_code ec;
+  while (!ec)
+    socket.read_some(asio::buffer(data), ec);
+}
+
+void report(const char* name, std::size_t bytes, std::size_t calls,
+    std::chrono::steady_clock::duration elapsed)
+{
+  double seconds = std::chrono::duration<double>(elapsed).count();
+  std::cout << "  " << name << ": " << calls << " write_some calls, "
+    << (bytes / seconds / 1048576) << " MB/s\n";
+}
+
+void run(int fragment_count, std::size_t fragment_size, int repeats)
+{
+  std::vector<char> data(fragment_count * fragment_size, 'x');
+  std::vector<asio::const_buffer> buffers;
+  for (int i = 0; i < fragment_count; ++i)
+    buffers.push_back(asio::buffer(&data[i * fragment_size], fragment_size));
+  std::size_t bytes = data.size() * repeats;
+
+  std::cout << fragment_count << " fragments of "
+    << fragment_size << " bytes:\n";
+
+  typedef std::chrono::steady_clock clock;
+
+  // Synchronous writes of the whole buffer sequence.
+  {
+    asio::io_context io_context;
+    stream_protocol::socket s1(io_context);
+    stream_protocol::socket s2(io_context);
+    asio::local::connect_pair(s1, s2);
+    std::thread reader([&]{ drain(s2); });
+
+    counting_stream stream(s1);
+    clock::time_point start = clock::now();
+    for (int i = 0; i < repeats; ++i)
+      asio::write(stream, buffers);
+    clock::duration elapsed = clock::now() - start;
+    s1.close();
+    reader.join();
+
+    report("write", bytes, stream.calls(), elapsed);
+  }
+
+  // Asynchronous writes of the whole buffer sequence.
+  {
+    asio::io_context io_context;
+    stream_protocol::socket s1(io_context);
+    stream_protocol::socket s2(io_context);
+    asio::local::connect_pair(s1, s2);
+    std::thread reader([&]{ drain(s2); });
+
+    counting_stream stream(s1);
+    int remaining = repeats;
+    std::function<void(asio::error_code, std::size_t)> handler =
+      [&](asio::error_code ec, std::size_t)
+      {
+        if (!ec && --remaining > 0)
+          asio::async_write(stream, buffers, handler);
+      };
+
+    clock::time_point start = clock::now();
+    asio::async_write(stream, buffers, handler);
+    io_context.run();
+    clock::duration elapsed = clock::now() - start;
+    s1.close();
+    reader.join();
+
+    report("async_write", bytes, stream.calls(), elapsed);
+  }
+
+  // Copying the fragments into a single buffer before writing it.
+  {
+    asio::io_context io_context;
+    stream_protocol::socket s1(io_context);
+    stream_protocol::socket s2(io_context);
+    asio::local::connect_pair(s1, s2);
+    std::thread reader([&]{ drain(s2); });
+
+    counting_stream stream(s1);
+    std::vector<char> linear(data.size());
+    clock::time_point start = clock::now();
+    for (int i = 0; i < repeats; ++i)
+    {
+      asio::buffer_copy(asio::buffer(linear), buffers);
+      asio::write(stream, asio::buffer(linear));
+    }
+    clock::duration elapsed = clock::now() - start;
+    s1.close();
+    reader.join();
+
+    report("copy and write", bytes, stream.calls(), elapsed);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc != 3)
+  {
+    std::cerr << "Usage: vectored_write <fragments> <repeats>\n";
+    return 1;
+  }
+
+  int fragment_count = std::atoi(argv[1]);
+  int repeats = std::atoi(argv[2]);
+
+  run(fragment_count, 16, repeats);
+  run(fragment_count, 128, repeats);
+  run(fragment_count, 1024, repeats);
+
+  return 0;
+}
@@ -0,0 +1,150 @@
+//
+// allocation_statistics.cpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Enable the allocation accounting layer.
+#define ASIO_ENABLE_ALLOCATION_ACCOUNTING 1
+
+// Test that header file is self-contained.
+#include "asio/allocation_statistics.hpp"
+
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "asio/post.hpp"
+#include "asio/steady_timer.hpp"
+#include "asio/strand.hpp"
+#include "unit_test.hpp"
+
+typedef asio::allocation_statistics stats;
+
+void handler_test()
+{
+  asio::io_context ioc;
+  asio::io_context other;
+  stats before = stats();
+  stats during = stats();
+  bool called = false;
+
+  asio::post(ioc,
+      [&]()
+      {
+        before = asio::get_allocation_statistics(ioc);
+        asio::post(ioc, [&]{ called = true; });
+        during = asio::get_allocation_statistics(ioc);
+      });
+
+  ioc.run();
+  ASIO_CHECK(called);
+
+  // Handlers allocated while running the context are charged to it.
+  const stats::counters& b = before.categories[stats::handler];
+  const stats::counters& d = during.categories[stats::handler];
+  ASIO_CHECK(d.allocations == b.allocations + 1);
+  ASIO_CHECK(d.bytes_live > b.bytes_live);
+  ASIO_CHECK(during.total.bytes_live >= d.bytes_live);
+
+  stats after = asio::get_allocation_statistics(ioc);
+  const stats::counters& a = after.categories[stats::handler];
+  ASIO_CHECK(a.deallocations == a.allocations);
+  ASIO_CHECK(a.bytes_live == 0);
+  ASIO_CHECK(a.bytes_peak >= d.bytes_live);
+
+  // Other contexts are unaffected.
+  stats o = asio::get_allocation_statistics(other);
+  ASIO_CHECK(o.total.allocations == 0);
+  ASIO_CHECK(o.total.bytes_peak == 0);
+}
+
+void cross_context_test()
+{
+  asio::io_context b;
+  bool called = false;
+
+  {
+    asio::io_context a;
+    asio::post(a,
+        [&]()
+        {
+          // The handler is allocated while running a, and so is charged to a.
+          asio::post(b, [&]{ called = true; });
+        });
+    a.run();
+
+    stats s = asio::get_allocation_statistics(a);
+    ASIO_CHECK(s.categories[stats::handler].bytes_live > 0);
+  }
+
+  // The handler is freed after a has been destroyed.
+  b.run();
+  ASIO_CHECK(called);
+
+  stats s = asio::get_allocation_statistics(b);
+  ASIO_CHECK(s.categories[stats::handler].allocations == 0);
+}
+
+void io_object_test()
+{
+  asio::io_context ioc;
+
+  {
+    asio::ip::tcp::socket socket(ioc);
+    socket.open(asio::ip::tcp::v4());
+    stats s = asio::get_allocation_statistics(ioc);
+    ASIO_CHECK(s.categories[stats::reactor].bytes_live > 0);
+    ASIO_CHECK(s.categories[stats::reactor].allocations == 1);
+  }
+
+  stats s = asio::get_allocation_statistics(ioc);
+  ASIO_CHECK(s.categories[stats::reactor].bytes_live == 0);
+  ASIO_CHECK(s.categories[stats::reactor].bytes_peak > 0);
+
+  {
+    asio::strand<asio::io_context::executor_type> strand =
+      asio::make_strand(ioc);
+    s = asio::get_allocation_statistics(ioc);
+    ASIO_CHECK(s.categories[stats::strand].bytes_live > 0);
+  }
+
+  s = asio::get_allocation_statistics(ioc);
+  ASIO_CHECK(s.categories[stats::strand].bytes_live == 0);
+
+  asio::steady_timer timer(ioc, asio::chrono::hours(1));
+  timer.async_wait([](asio::error_code){});
+  s = asio::get_allocation_statistics(ioc);
+  ASIO_CHECK(s.categories[stats::timer].bytes_live > 0);
+  timer.cancel();
+  ioc.run();
+}
+
+void allocations_per_second_test()
+{
+  asio::io_context ioc;
+  stats s1 = asio::get_allocation_statistics(ioc);
+  stats s2 = s1;
+  s2.total.allocations += 100;
+  s2.time += asio::chrono::milliseconds(500);
+  ASIO_CHECK(asio::allocations_per_second(s1, s2) == 200.0);
+  ASIO_CHECK(asio::allocations_per_second(s1, s1) == 0.0);
+}
+
+//------------------------------------------------------------------------------
+
+ASIO_TEST_SUITE
+(
+  "allocation_statistics",
+  ASIO_TEST_CASE(handler_test)
+  ASIO_TEST_CASE(cross_context_test)
+  ASIO_TEST_CASE(io_object_test)
+  ASIO_TEST_CASE(allocations_per_second_test)
+)
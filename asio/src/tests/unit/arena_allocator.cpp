@@ -0,0 +1,185 @@
+//
+// arena_allocator.cpp
+// ~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/arena_allocator.hpp"
+
+#include <string>
+#include <vector>
+#include "asio/bind_allocator.hpp"
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "asio/read.hpp"
+#include "asio/write.hpp"
+#include "unit_test.hpp"
+
+using asio::ip::tcp;
+
+// A type with a stricter alignment than the blocks obtained from the heap.
+struct alignas(64) over_aligned
+{
+  char data[64];
+};
+
+void arena_test()
+{
+  asio::arena a(256);
+  ASIO_CHECK(a.block_size() == 256);
+  ASIO_CHECK(a.capacity() == 0);
+  ASIO_CHECK(a.allocations() == 0);
+
+  // Allocations are made from a single block, with the requested alignment.
+  char* p1 = static_cast<char*>(a.allocate(10, 1));
+  char* p2 = static_cast<char*>(a.allocate(8, 8));
+  ASIO_CHECK(a.capacity() == 256);
+  ASIO_CHECK(a.allocations() == 2);
+  ASIO_CHECK(p2 >= p1 + 10);
+  ASIO_CHECK(p2 < p1 + 24);
+  ASIO_CHECK(reinterpret_cast<std::size_t>(p2) % 8 == 0);
+
+  // Deallocating the most recent allocation makes its memory available.
+  a.deallocate(p2, 8);
+  char* p3 = static_cast<char*>(a.allocate(8, 8));
+  ASIO_CHECK(p3 == p2);
+
+  // Allocations that do not fit in the current block use a new one.
+  char* p4 = static_cast<char*>(a.allocate(240, 1));
+  (void)p4;
+  ASIO_CHECK(a.capacity() == 512);
+
+  // Large allocations are given a block of their own.
+  char* p5 = static_cast<char*>(a.allocate(1000, 64));
+  ASIO_CHECK(reinterpret_cast<std::size_t>(p5) % 64 == 0);
+  ASIO_CHECK(a.capacity() > 1000 + 512);
+  ASIO_CHECK(a.allocations() == 4);
+
+  // When nothing is in use, all but the current block is freed.
+  a.deallocate(p1, 10);
+  a.deallocate(p3, 8);
+  a.deallocate(p4, 240);
+  a.deallocate(p5, 1000);
+  ASIO_CHECK(a.allocations() == 0);
+  ASIO_CHECK(a.capacity() == 256);
+
+  char* p6 = static_cast<char*>(a.allocate(100, 1));
+  ASIO_CHECK(a.capacity() == 256);
+  (void)p6;
+
+  a.allocate(300, 1);
+  a.reset();
+  ASIO_CHECK(a.allocations() == 0);
+  ASIO_CHECK(a.capacity() == 256);
+}
+
+void arena_allocator_test()
+{
+  asio::arena a;
+  asio::arena b;
+
+  asio::arena_allocator<int> a1(a);
+  asio::arena_allocator<int> a2(a1);
+  asio::arena_allocator<void> a3(a2);
+  asio::arena_allocator<char> a4(a3);
+  asio::arena_allocator<int> b1(b);
+
+  ASIO_CHECK(a1 == a2);
+  ASIO_CHECK(!(a1 != a2));
+  ASIO_CHECK(a1 != b1);
+  ASIO_CHECK(&a3.get_arena() == &a);
+  ASIO_CHECK(&a4.get_arena() == &a);
+
+  int* p = a1.allocate(42);
+  ASIO_CHECK(p != 0);
+  ASIO_CHECK(reinterpret_cast<std::size_t>(p) % alignof(int) == 0);
+  ASIO_CHECK(a.allocations() == 1);
+  a1.deallocate(p, 42);
+  ASIO_CHECK(a.allocations() == 0);
+
+  std::vector<int, asio::arena_allocator<int>> v(a1);
+  v.resize(42);
+  ASIO_CHECK(v.size() == 42);
+  ASIO_CHECK(a.allocations() == 1);
+
+  // Over-aligned types are aligned in memory, and not merely relative to the
+  // start of the block. Several arenas are used, since a given block may
+  // happen to be suitably aligned.
+  for (int i = 0; i < 8; ++i)
+  {
+    asio::arena c(1024);
+    asio::arena_allocator<over_aligned> c1(c);
+    asio::arena_allocator<char> c2(c);
+    char* q1 = c2.allocate(1);
+    over_aligned* q2 = c1.allocate(1);
+    over_aligned* q3 = c1.allocate(2);
+    ASIO_CHECK(reinterpret_cast<std::size_t>(q2) % alignof(over_aligned) == 0);
+    ASIO_CHECK(reinterpret_cast<std::size_t>(q3) % alignof(over_aligned) == 0);
+    ASIO_CHECK(c.capacity() == 1024);
+    c1.deallocate(q3, 2);
+    c1.deallocate(q2, 1);
+    c2.deallocate(q1, 1);
+  }
+}
+
+void arena_allocator_async_test()
+{
+  asio::io_context ioc;
+  tcp::acceptor acceptor(ioc,
+      tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+  tcp::socket client(ioc);
+  tcp::socket server(ioc);
+  client.connect(acceptor.local_endpoint());
+  acceptor.accept(server);
+
+  asio::arena a;
+  char write_data[16] = "0123456789abcde";
+  char read_data[16] = "";
+  int completed = 0;
+
+  asio::async_write(client, asio::buffer(write_data),
+      asio::bind_allocator(asio::arena_allocator<void>(a),
+        [&](asio::error_code ec, std::size_t n)
+        {
+          ASIO_CHECK(!ec);
+          ASIO_CHECK(n == sizeof(write_data));
+          ++completed;
+        }));
+  asio::async_read(server, asio::buffer(read_data),
+      asio::bind_allocator(asio::arena_allocator<void>(a),
+        [&](asio::error_code ec, std::size_t n)
+        {
+          ASIO_CHECK(!ec);
+          ASIO_CHECK(n == sizeof(read_data));
+          ++completed;
+        }));
+
+  // The operations' memory is obtained from the arena.
+  ASIO_CHECK(a.allocations() == 2);
+  ASIO_CHECK(a.capacity() > 0);
+
+  ioc.run();
+  ASIO_CHECK(completed == 2);
+  ASIO_CHECK(a.allocations() == 0);
+  ASIO_CHECK(std::string(read_data) == write_data);
+}
+
+//------------------------------------------------------------------------------
+
+ASIO_TEST_SUITE
+(
+  "arena_allocator",
+  ASIO_TEST_CASE(arena_test)
+  ASIO_TEST_CASE(arena_allocator_test)
+  ASIO_TEST_CASE(arena_allocator_async_test)
+)
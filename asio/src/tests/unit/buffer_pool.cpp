@@ -0,0 +1,196 @@
+//
+// buffer_pool.cpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/buffer_pool.hpp"
+
+#include <string>
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "asio/post.hpp"
+#include "asio/write.hpp"
+#include "unit_test.hpp"
+
+using asio::ip::tcp;
+
+void test_allocate()
+{
+  asio::buffer_pool pool(100, 2);
+  ASIO_CHECK(pool.block_size() == 128);
+  ASIO_CHECK(pool.free_blocks() == 0);
+
+  asio::pooled_buffer empty;
+  ASIO_CHECK(!empty);
+  ASIO_CHECK(empty.capacity() == 0);
+
+  void* p = 0;
+  {
+    asio::pooled_buffer b = pool.allocate();
+    ASIO_CHECK(!!b);
+    ASIO_CHECK(b.size() == 0);
+    ASIO_CHECK(b.capacity() == 128);
+    ASIO_CHECK(reinterpret_cast<std::size_t>(b.data())
+        % asio::buffer_pool::cache_line_size == 0);
+    ASIO_CHECK(b.block().size() == 128);
+    b.resize(10);
+    ASIO_CHECK(b.contents().size() == 10);
+    p = b.data();
+
+    asio::pooled_buffer b2(static_cast<asio::pooled_buffer&&>(b));
+    ASIO_CHECK(!b);
+    ASIO_CHECK(b2.data() == p);
+    ASIO_CHECK(b2.size() == 10);
+    ASIO_CHECK(pool.free_blocks() == 0);
+  }
+  ASIO_CHECK(pool.free_blocks() == 1);
+
+  // A returned block is reused.
+  asio::pooled_buffer b = pool.allocate();
+  ASIO_CHECK(b.data() == p);
+  ASIO_CHECK(b.size() == 0);
+  ASIO_CHECK(pool.free_blocks() == 0);
+  b.reset();
+  ASIO_CHECK(!b);
+  ASIO_CHECK(pool.free_blocks() == 1);
+
+  // Blocks beyond the limit are freed when they are returned.
+  {
+    asio::pooled_buffer b1 = pool.allocate();
+    asio::pooled_buffer b2 = pool.allocate();
+    asio::pooled_buffer b3 = pool.allocate();
+    b1 = static_cast<asio::pooled_buffer&&>(b2);
+    ASIO_CHECK(pool.free_blocks() == 1);
+  }
+  ASIO_CHECK(pool.free_blocks() == 2);
+
+  pool.release();
+  ASIO_CHECK(pool.free_blocks() == 0);
+}
+
+void test_io_context_threads()
+{
+  asio::io_context ioc;
+  asio::buffer_pool pool(64);
+
+  // Blocks returned from within run() are reused by the same thread.
+  void* p = 0;
+  asio::post(ioc,
+      [&]()
+      {
+        asio::pooled_buffer b = pool.allocate();
+        p = b.data();
+      });
+  asio::post(ioc,
+      [&]()
+      {
+        asio::pooled_buffer b = pool.allocate();
+        ASIO_CHECK(b.data() == p);
+      });
+  ioc.run();
+  ASIO_CHECK(pool.free_blocks() == 1);
+}
+
+void test_async_read_some_pooled()
+{
+  asio::io_context ioc;
+  tcp::acceptor acceptor(ioc,
+      tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+  tcp::socket client(ioc);
+  tcp::socket server(ioc);
+  client.connect(acceptor.local_endpoint());
+  acceptor.accept(server);
+
+  // The descriptor's mode is left as it was found.
+  server.native_non_blocking(true);
+
+  asio::buffer_pool pool(4096);
+  std::string received;
+  bool called = false;
+  asio::async_read_some_pooled(server, pool,
+      [&](asio::error_code ec, asio::pooled_buffer b)
+      {
+        called = true;
+        ASIO_CHECK(!ec);
+        ASIO_CHECK(!!b);
+        received.assign(static_cast<const char*>(b.data()), b.size());
+      });
+
+  // No block is held while waiting for data.
+  ioc.poll();
+  ASIO_CHECK(!called);
+  ASIO_CHECK(pool.free_blocks() == 0);
+
+  asio::write(client, asio::buffer("hello", 5));
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(called);
+  ASIO_CHECK(received == "hello");
+  ASIO_CHECK(pool.free_blocks() == 1);
+  ASIO_CHECK(!server.non_blocking());
+  ASIO_CHECK(server.native_non_blocking());
+
+  // End of file is reported with an empty handle.
+  client.close();
+  called = false;
+  asio::async_read_some_pooled(server, pool,
+      [&](asio::error_code ec, asio::pooled_buffer b)
+      {
+        called = true;
+        ASIO_CHECK(ec == asio::error::eof);
+        ASIO_CHECK(!b);
+      });
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(called);
+  ASIO_CHECK(pool.free_blocks() == 1);
+}
+
+void test_async_read_some_pooled_cancel()
+{
+  asio::io_context ioc;
+  tcp::acceptor acceptor(ioc,
+      tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+  tcp::socket client(ioc);
+  tcp::socket server(ioc);
+  client.connect(acceptor.local_endpoint());
+  acceptor.accept(server);
+
+  asio::buffer_pool pool(4096);
+  bool called = false;
+  asio::async_read_some_pooled(server, pool,
+      [&](asio::error_code ec, asio::pooled_buffer b)
+      {
+        called = true;
+        ASIO_CHECK(ec == asio::error::operation_aborted);
+        ASIO_CHECK(!b);
+      });
+  ioc.poll();
+  server.cancel();
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(called);
+  ASIO_CHECK(pool.free_blocks() == 0);
+}
+
+//------------------------------------------------------------------------------
+
+ASIO_TEST_SUITE
+(
+  "buffer_pool",
+  ASIO_TEST_CASE(test_allocate)
+  ASIO_TEST_CASE(test_io_context_threads)
+  ASIO_TEST_CASE(test_async_read_some_pooled)
+  ASIO_TEST_CASE(test_async_read_some_pooled_cancel)
+)
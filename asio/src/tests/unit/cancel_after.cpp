@@ -17,8 +17,12 @@
 #include "asio/cancel_after.hpp"
 
 #include <functional>
+#include "asio/buffer.hpp"
 #include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "asio/random_access_file.hpp"
 #include "asio/steady_timer.hpp"
+#include "asio/write.hpp"
 #include "unit_test.hpp"
 
 using namespace asio;
@@ -501,6 +505,121 @@ void partial_cancel_after_timer_test()
   ASIO_CHECK(count == 1);
 }
 
+void record_read_result(asio::error_code* out_error,
+    std::size_t* out_bytes, const asio::error_code& error,
+    std::size_t bytes_transferred)
+{
+  *out_error = error;
+  *out_bytes = bytes_transferred;
+}
+
+void cancel_after_socket_test()
+{
+  io_context ioc;
+
+  ip::tcp::acceptor acceptor(ioc,
+      ip::tcp::endpoint(ip::address_v4::loopback(), 0));
+  ip::tcp::socket client_socket(ioc);
+  ip::tcp::socket server_socket(ioc);
+  client_socket.connect(acceptor.local_endpoint());
+  acceptor.accept(server_socket);
+
+  char read_data[16];
+  asio::error_code error;
+  std::size_t bytes = 0;
+
+  // No data is available, so the read must be cancelled by the timeout.
+  client_socket.async_read_some(asio::buffer(read_data),
+      cancel_after(chronons::milliseconds(100),
+        bindns::bind(&record_read_result, &error, &bytes,
+          bindns::placeholders::_1, bindns::placeholders::_2)));
+
+  ioc.run();
+
+  ASIO_CHECK(error == asio::error::operation_aborted);
+  ASIO_CHECK(bytes == 0);
+
+  // Data is available, so the read must complete before the timeout.
+  asio::write(server_socket, asio::buffer("hello", 5));
+  client_socket.async_read_some(asio::buffer(read_data),
+      cancel_after(chronons::seconds(5),
+        bindns::bind(&record_read_result, &error, &bytes,
+          bindns::placeholders::_1, bindns::placeholders::_2)));
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(!error);
+  ASIO_CHECK(bytes == 5);
+}
+
+void cancel_after_queued_socket_test()
+{
+  io_context ioc;
+
+  ip::tcp::acceptor acceptor(ioc,
+      ip::tcp::endpoint(ip::address_v4::loopback(), 0));
+  ip::tcp::socket client_socket(ioc);
+  ip::tcp::socket server_socket(ioc);
+  client_socket.connect(acceptor.local_endpoint());
+  acceptor.accept(server_socket);
+
+  char read_data1[16];
+  asio::error_code error1;
+  std::size_t bytes1 = 0;
+  char read_data2[16];
+  asio::error_code error2;
+  std::size_t bytes2 = 0;
+
+  // The second read is queued behind the first, which has no timeout. The
+  // second read's timeout must still cancel it.
+  client_socket.async_read_some(asio::buffer(read_data1),
+      bindns::bind(&record_read_result, &error1, &bytes1,
+        bindns::placeholders::_1, bindns::placeholders::_2));
+  client_socket.async_read_some(asio::buffer(read_data2),
+      cancel_after(chronons::milliseconds(100),
+        bindns::bind(&record_read_result, &error2, &bytes2,
+          bindns::placeholders::_1, bindns::placeholders::_2)));
+
+  ioc.run_for(chronons::seconds(5));
+
+  ASIO_CHECK(error2 == asio::error::operation_aborted);
+  ASIO_CHECK(bytes2 == 0);
+  ASIO_CHECK(!error1);
+
+  client_socket.cancel();
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(error1 == asio::error::operation_aborted);
+  ASIO_CHECK(bytes1 == 0);
+}
+
+void cancel_after_file_test()
+{
+#if defined(ASIO_HAS_IO_URING) && defined(ASIO_HAS_FILE)
+  // File operations on io_uring enforce the timeout using a linked timeout
+  // whether or not io_uring is the default backend.
+  io_context ioc;
+
+  random_access_file file(ioc, "/dev/zero", random_access_file::read_only);
+
+  char read_data[16];
+  asio::error_code error = asio::error::would_block;
+  std::size_t bytes = 0;
+
+  file.async_read_some_at(0, asio::buffer(read_data),
+      cancel_after(chronons::seconds(5),
+        bindns::bind(&record_read_result, &error, &bytes,
+          bindns::placeholders::_1, bindns::placeholders::_2)));
+
+  ioc.run();
+
+  ASIO_CHECK(!error);
+  ASIO_CHECK(bytes == sizeof(read_data));
+#endif // defined(ASIO_HAS_IO_URING) && defined(ASIO_HAS_FILE)
+}
+
 ASIO_TEST_SUITE
 (
   "cancel_after",
@@ -512,4 +631,7 @@ ASIO_TEST_SUITE
   ASIO_TEST_CASE(cancel_after_timer_completion_token_v2_test)
   ASIO_TEST_CASE(partial_cancel_after_test)
   ASIO_TEST_CASE(partial_cancel_after_timer_test)
+  ASIO_TEST_CASE(cancel_after_socket_test)
+  ASIO_TEST_CASE(cancel_after_queued_socket_test)
+  ASIO_TEST_CASE(cancel_after_file_test)
 )
@@ -0,0 +1,296 @@
+//
+// chain_buffer.cpp
+// ~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/chain_buffer.hpp"
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "asio/read.hpp"
+#include "asio/read_until.hpp"
+#include "asio/write.hpp"
+#include "unit_test.hpp"
+
+using asio::ip::tcp;
+
+// An allocator that counts the allocations made through it, and that fails
+// once a limit on the number of allocations has been reached.
+template <typename T>
+class counting_allocator
+{
+public:
+  typedef T value_type;
+
+  explicit counting_allocator(std::size_t* count,
+      std::size_t limit = (std::numeric_limits<std::size_t>::max)())
+    : count_(count),
+      limit_(limit)
+  {
+  }
+
+  template <typename U>
+  counting_allocator(const counting_allocator<U>& other)
+    : count_(other.count_),
+      limit_(other.limit_)
+  {
+  }
+
+  T* allocate(std::size_t n)
+  {
+    if (*count_ >= limit_)
+      throw std::bad_alloc();
+    ++*count_;
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n)
+  {
+    ASIO_CHECK(p != 0);
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  friend bool operator==(const counting_allocator& a,
+      const counting_allocator& b)
+  {
+    return a.count_ == b.count_;
+  }
+
+  friend bool operator!=(const counting_allocator& a,
+      const counting_allocator& b)
+  {
+    return a.count_ != b.count_;
+  }
+
+private:
+  template <typename> friend class counting_allocator;
+  std::size_t* count_;
+  std::size_t limit_;
+};
+
+template <typename Buffers>
+std::size_t buffer_count(const Buffers& buffers)
+{
+  std::size_t count = 0;
+  for (typename Buffers::const_iterator iter = buffers.begin(),
+      end = buffers.end(); iter != end; ++iter)
+    ++count;
+  return count;
+}
+
+template <typename Buffers>
+std::string to_string(const Buffers& buffers)
+{
+  std::string s(asio::buffer_size(buffers), '\0');
+  asio::buffer_copy(asio::buffer(&s[0], s.size()), buffers);
+  return s;
+}
+
+void test_grow_and_consume()
+{
+  asio::chain_buffer b(8);
+  ASIO_CHECK(b.block_size() == 8);
+  ASIO_CHECK(b.size() == 0);
+  ASIO_CHECK(b.capacity() == 0);
+  ASIO_CHECK(buffer_count(b.data(0, b.size())) == 0);
+
+  const char data[] = "abcdefghijklmnopqrstuvwxyz";
+  b.grow(20);
+  ASIO_CHECK(b.size() == 20);
+  ASIO_CHECK(b.capacity() == 24);
+  ASIO_CHECK(asio::buffer_copy(b.data(0, 20),
+        asio::buffer(data, 20)) == 20);
+  ASIO_CHECK(buffer_count(b.data(0, 20)) == 3);
+  ASIO_CHECK(to_string(b.data(0, 20)) == std::string(data, 20));
+  ASIO_CHECK(to_string(b.data(5, 6)) == "fghijk");
+  ASIO_CHECK(buffer_count(b.data(5, 6)) == 2);
+  ASIO_CHECK(to_string(b.data(18, 100)) == "st");
+  ASIO_CHECK(to_string(b.data(100, 100)).empty());
+
+  // Consuming from the front does not move the remaining data.
+  const void* p = (*b.data(10, 1).begin()).data();
+  b.consume(9);
+  ASIO_CHECK(b.size() == 11);
+  ASIO_CHECK(to_string(b.data(0, b.size())) == "jklmnopqrst");
+  ASIO_CHECK((*b.data(1, 1).begin()).data() == p);
+  ASIO_CHECK(buffer_count(b.data(0, b.size())) == 2);
+
+  // Growing does not move the existing data.
+  b.grow(10);
+  ASIO_CHECK((*b.data(1, 1).begin()).data() == p);
+  b.shrink(10);
+  ASIO_CHECK(to_string(b.data(0, b.size())) == "jklmnopqrst");
+
+  b.shrink(5);
+  ASIO_CHECK(to_string(b.data(0, b.size())) == "jklmno");
+
+  b.consume(100);
+  ASIO_CHECK(b.size() == 0);
+  ASIO_CHECK(buffer_count(b.data(0, b.size())) == 0);
+
+  b.shrink_to_fit();
+  ASIO_CHECK(b.capacity() == 0);
+}
+
+void test_block_reuse()
+{
+  std::size_t allocations = 0;
+  counting_allocator<char> allocator(&allocations);
+  asio::basic_chain_buffer<counting_allocator<char>> b(
+      16, (std::numeric_limits<std::size_t>::max)(), allocator);
+
+  // Once the chain has reached its steady state, repeatedly producing and
+  // consuming data does not allocate.
+  b.grow(40);
+  ASIO_CHECK(allocations == 3);
+  for (int i = 0; i < 100; ++i)
+  {
+    b.consume(13);
+    b.grow(13);
+  }
+  ASIO_CHECK(b.size() == 40);
+  ASIO_CHECK(allocations == 4);
+}
+
+void test_allocation_failure()
+{
+  std::size_t allocations = 0;
+  counting_allocator<char> allocator(&allocations, 2);
+  asio::basic_chain_buffer<counting_allocator<char>> b(
+      16, (std::numeric_limits<std::size_t>::max)(), allocator);
+
+  // A failed allocation leaves the buffer unchanged, apart from any blocks
+  // that were added before the failure.
+  bool thrown = false;
+  try
+  {
+    b.grow(40);
+  }
+  catch (std::bad_alloc&)
+  {
+    thrown = true;
+  }
+  ASIO_CHECK(thrown);
+  ASIO_CHECK(allocations == 2);
+  ASIO_CHECK(b.size() == 0);
+  ASIO_CHECK(b.capacity() == 32);
+
+  b.grow(32);
+  ASIO_CHECK(b.size() == 32);
+  ASIO_CHECK(allocations == 2);
+  ASIO_CHECK(buffer_count(b.data(0, b.size())) == 2);
+}
+
+void test_max_size()
+{
+  asio::chain_buffer b(8, 20);
+  ASIO_CHECK(b.max_size() == 20);
+  b.grow(20);
+
+  bool thrown = false;
+  try
+  {
+    b.grow(1);
+  }
+  catch (std::length_error&)
+  {
+    thrown = true;
+  }
+  ASIO_CHECK(thrown);
+  ASIO_CHECK(b.size() == 20);
+
+  b.consume(20);
+  asio::dynamic_chain_buffer<std::allocator<char>> d
+    = asio::dynamic_buffer(b, 10);
+  ASIO_CHECK(d.max_size() == 10);
+  d.grow(10);
+
+  thrown = false;
+  try
+  {
+    d.grow(1);
+  }
+  catch (std::length_error&)
+  {
+    thrown = true;
+  }
+  ASIO_CHECK(thrown);
+  ASIO_CHECK(d.size() == 10);
+}
+
+void test_dynamic_buffer()
+{
+  ASIO_CHECK((asio::is_dynamic_buffer_v2<
+        asio::dynamic_chain_buffer<std::allocator<char>>>::value));
+  ASIO_CHECK((asio::is_const_buffer_sequence<
+        asio::chain_buffer::const_buffers_type>::value));
+  ASIO_CHECK((asio::is_mutable_buffer_sequence<
+        asio::chain_buffer::mutable_buffers_type>::value));
+
+  asio::io_context ioc;
+  tcp::acceptor acceptor(ioc,
+      tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+  tcp::socket client(ioc);
+  tcp::socket server(ioc);
+  client.connect(acceptor.local_endpoint());
+  acceptor.accept(server);
+
+  std::string header = "GET / HTTP/1.1\r\nHost: example.com\r\n\r\n";
+  std::string body(100, 'x');
+  asio::write(client, asio::buffer(header + body));
+
+  asio::chain_buffer b(7);
+  std::size_t n = asio::read_until(server,
+      asio::dynamic_buffer(b), "\r\n\r\n");
+  ASIO_CHECK(n == header.size());
+  ASIO_CHECK(to_string(b.data(0, n)) == header);
+  b.consume(n);
+
+  asio::read(server, asio::dynamic_buffer(b),
+      asio::transfer_exactly(body.size() - b.size()));
+  ASIO_CHECK(to_string(b.data(0, b.size())) == body);
+
+  std::size_t written = 0;
+  asio::async_write(server, asio::dynamic_buffer(b),
+      [&](asio::error_code ec, std::size_t bytes_transferred)
+      {
+        ASIO_CHECK(!ec);
+        written = bytes_transferred;
+      });
+  ioc.run();
+  ASIO_CHECK(written == body.size());
+  ASIO_CHECK(b.size() == 0);
+
+  std::string echoed(body.size(), '\0');
+  asio::read(client, asio::buffer(&echoed[0], echoed.size()));
+  ASIO_CHECK(echoed == body);
+}
+
+//------------------------------------------------------------------------------
+
+ASIO_TEST_SUITE
+(
+  "chain_buffer",
+  ASIO_TEST_CASE(test_grow_and_consume)
+  ASIO_TEST_CASE(test_block_reuse)
+  ASIO_TEST_CASE(test_allocation_failure)
+  ASIO_TEST_CASE(test_max_size)
+  ASIO_TEST_CASE(test_dynamic_buffer)
+)
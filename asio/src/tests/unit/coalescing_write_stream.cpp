@@ -0,0 +1,411 @@
+//
+// coalescing_write_stream.cpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/coalescing_write_stream.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "archetypes/async_result.hpp"
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "asio/read.hpp"
+#include "asio/steady_timer.hpp"
+#include "asio/write.hpp"
+#include "unit_test.hpp"
+
+#if defined(ASIO_HAS_BOOST_ARRAY)
+# include <boost/array.hpp>
+#else // defined(ASIO_HAS_BOOST_ARRAY)
+# include <array>
+#endif // defined(ASIO_HAS_BOOST_ARRAY)
+
+using asio::ip::tcp;
+
+void write_some_handler(const asio::error_code&, std::size_t)
+{
+}
+
+void flush_handler(const asio::error_code&, std::size_t)
+{
+}
+
+void read_some_handler(const asio::error_code&, std::size_t)
+{
+}
+
+void test_compile()
+{
+#if defined(ASIO_HAS_BOOST_ARRAY)
+  using boost::array;
+#else // defined(ASIO_HAS_BOOST_ARRAY)
+  using std::array;
+#endif // defined(ASIO_HAS_BOOST_ARRAY)
+
+  using namespace asio;
+
+  try
+  {
+    io_context ioc;
+    char mutable_char_buffer[128] = "";
+    const char const_char_buffer[128] = "";
+    array<asio::const_buffer, 2> const_buffers = {{
+        asio::buffer(const_char_buffer, 10),
+        asio::buffer(const_char_buffer + 10, 10) }};
+    archetypes::lazy_handler lazy;
+    asio::error_code ec;
+
+    tcp::socket socket1(ioc);
+    coalescing_write_stream<tcp::socket&> stream1(socket1);
+    coalescing_write_stream<tcp::socket> stream2(ioc, 4096,
+        asio::chrono::milliseconds(1));
+
+    coalescing_write_stream<tcp::socket>::executor_type ex
+      = stream2.get_executor();
+    (void)ex;
+
+    tcp::socket& next_layer = stream1.next_layer();
+    (void)next_layer;
+
+    std::size_t threshold = stream1.flush_threshold();
+    (void)threshold;
+
+    coalescing_write_stream<tcp::socket>::duration latency
+      = stream1.max_latency();
+    (void)latency;
+
+    std::size_t pending = stream1.pending();
+    (void)pending;
+
+    stream1.async_write_some(buffer(const_char_buffer), &write_some_handler);
+    stream1.async_write_some(const_buffers, &write_some_handler);
+    int i1 = stream1.async_write_some(buffer(const_char_buffer), lazy);
+    (void)i1;
+
+    stream1.async_flush(&flush_handler);
+    int i2 = stream1.async_flush(lazy);
+    (void)i2;
+
+    stream1.read_some(buffer(mutable_char_buffer));
+    stream1.read_some(buffer(mutable_char_buffer), ec);
+    stream1.async_read_some(buffer(mutable_char_buffer), &read_some_handler);
+    int i3 = stream1.async_read_some(buffer(mutable_char_buffer), lazy);
+    (void)i3;
+
+    stream1.close();
+    stream2.close(ec);
+  }
+  catch (std::exception&)
+  {
+  }
+}
+
+void test_flush_threshold()
+{
+  asio::io_context ioc;
+
+  tcp::acceptor acceptor(ioc, tcp::endpoint(tcp::v4(), 0));
+  tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(asio::ip::address_v4::loopback());
+
+  tcp::socket client_socket(ioc);
+  client_socket.connect(server_endpoint);
+
+  tcp::socket server_socket(ioc);
+  acceptor.accept(server_socket);
+
+  asio::coalescing_write_stream<tcp::socket&> stream(
+      client_socket, 100, asio::chrono::hours(1));
+
+  // Reaching the threshold writes the buffer, and each write operation
+  // completes as soon as its data has been copied. Once the buffers are
+  // full, write operations wait for the write in progress to complete.
+  const std::size_t message_count = 25;
+  std::vector<std::string> messages;
+  std::string expected;
+  for (std::size_t i = 0; i < message_count; ++i)
+  {
+    messages.push_back(std::string(10, static_cast<char>('a' + i)));
+    expected += messages.back();
+  }
+
+  std::size_t completed = 0;
+  std::size_t flushed = 0;
+  for (std::size_t i = 0; i < message_count; ++i)
+  {
+    asio::async_write(stream, asio::buffer(messages[i]),
+        [&](asio::error_code ec, std::size_t n)
+        {
+          ASIO_CHECK(!ec);
+          ASIO_CHECK(n == 10);
+          if (++completed == message_count)
+          {
+            // The remainder is written by a flush.
+            flushed = stream.pending();
+            ASIO_CHECK(flushed > 0);
+            stream.async_flush(
+                [&](asio::error_code ec2, std::size_t n2)
+                {
+                  ASIO_CHECK(!ec2);
+                  ASIO_CHECK(n2 == flushed);
+                  stream.close();
+                });
+          }
+        });
+  }
+
+  ASIO_CHECK(stream.pending() == 200);
+
+  std::string received(expected.size(), '\0');
+  asio::async_read(server_socket, asio::buffer(&received[0], received.size()),
+      [](asio::error_code ec, std::size_t) { ASIO_CHECK(!ec); });
+
+  ioc.run();
+
+  ASIO_CHECK(completed == message_count);
+  ASIO_CHECK(received == expected);
+  ASIO_CHECK(stream.pending() == 0);
+}
+
+void test_max_latency()
+{
+  asio::io_context ioc;
+
+  tcp::acceptor acceptor(ioc, tcp::endpoint(tcp::v4(), 0));
+  tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(asio::ip::address_v4::loopback());
+
+  tcp::socket client_socket(ioc);
+  client_socket.connect(server_endpoint);
+
+  tcp::socket server_socket(ioc);
+  acceptor.accept(server_socket);
+
+  asio::coalescing_write_stream<tcp::socket&> stream(
+      client_socket, 1024, asio::chrono::milliseconds(50));
+
+  // Data that does not reach the threshold is held until the latency bound
+  // is reached, and is then written together.
+  std::vector<std::string> messages;
+  std::string expected;
+  for (int i = 0; i < 10; ++i)
+  {
+    messages.push_back(std::string(5, static_cast<char>('a' + i)));
+    expected += messages.back();
+    asio::async_write(stream, asio::buffer(messages.back()),
+        [](asio::error_code ec, std::size_t) { ASIO_CHECK(!ec); });
+  }
+
+  asio::chrono::steady_clock::time_point start
+    = asio::chrono::steady_clock::now();
+  asio::chrono::steady_clock::time_point end = start;
+
+  bool checked = false;
+  asio::steady_timer timer(ioc, asio::chrono::milliseconds(10));
+  timer.async_wait(
+      [&](asio::error_code ec)
+      {
+        ASIO_CHECK(!ec);
+        ASIO_CHECK(stream.pending() == expected.size());
+        ASIO_CHECK(server_socket.available() == 0);
+        checked = true;
+      });
+
+  std::string received(expected.size(), '\0');
+  asio::async_read(server_socket, asio::buffer(&received[0], received.size()),
+      [&](asio::error_code ec, std::size_t)
+      {
+        ASIO_CHECK(!ec);
+        end = asio::chrono::steady_clock::now();
+      });
+
+  ioc.run();
+
+  ASIO_CHECK(checked);
+  ASIO_CHECK(received == expected);
+  ASIO_CHECK(end - start >= asio::chrono::milliseconds(40));
+  ASIO_CHECK(stream.pending() == 0);
+}
+
+void test_overlapping_flushes()
+{
+  asio::io_context ioc;
+
+  tcp::acceptor acceptor(ioc, tcp::endpoint(tcp::v4(), 0));
+  tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(asio::ip::address_v4::loopback());
+
+  tcp::socket client_socket(ioc);
+  client_socket.connect(server_endpoint);
+
+  tcp::socket server_socket(ioc);
+  acceptor.accept(server_socket);
+
+  asio::coalescing_write_stream<tcp::socket&> stream(
+      client_socket, 1024, asio::chrono::hours(1));
+
+  // Each flush completes once the data buffered before it has been written,
+  // including data that an earlier flush is also waiting for.
+  char data1[] = "hello";
+  char data2[] = "abc";
+  std::size_t flushed1 = 0;
+  std::size_t flushed2 = 0;
+  std::size_t flushed3 = 0;
+  asio::async_write(stream, asio::buffer(data1, 5),
+      [](asio::error_code ec, std::size_t) { ASIO_CHECK(!ec); });
+  stream.async_flush(
+      [&](asio::error_code ec, std::size_t n)
+      {
+        ASIO_CHECK(!ec);
+        flushed1 = n;
+      });
+  stream.async_flush(
+      [&](asio::error_code ec, std::size_t n)
+      {
+        ASIO_CHECK(!ec);
+        flushed2 = n;
+      });
+  asio::async_write(stream, asio::buffer(data2, 3),
+      [](asio::error_code ec, std::size_t) { ASIO_CHECK(!ec); });
+  stream.async_flush(
+      [&](asio::error_code ec, std::size_t n)
+      {
+        ASIO_CHECK(!ec);
+        flushed3 = n;
+        stream.close();
+      });
+
+  std::string received(8, '\0');
+  asio::async_read(server_socket, asio::buffer(&received[0], received.size()),
+      [](asio::error_code ec, std::size_t) { ASIO_CHECK(!ec); });
+
+  ioc.run();
+
+  ASIO_CHECK(flushed1 == 5);
+  ASIO_CHECK(flushed2 == 5);
+  ASIO_CHECK(flushed3 == 8);
+  ASIO_CHECK(received == "helloabc");
+  ASIO_CHECK(stream.pending() == 0);
+}
+
+void test_destroy_while_writing()
+{
+  asio::io_context ioc;
+
+  tcp::acceptor acceptor(ioc, tcp::endpoint(tcp::v4(), 0));
+  tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(asio::ip::address_v4::loopback());
+
+  tcp::socket client_socket(ioc);
+  client_socket.connect(server_endpoint);
+
+  tcp::socket server_socket(ioc);
+  acceptor.accept(server_socket);
+
+  // Fill the buffer so that it is written at once, and destroy the stream
+  // before the peer reads the data. The write continues to completion.
+  const std::size_t length = 4 * 1024 * 1024;
+  std::string data(length, 'x');
+  for (std::size_t i = 0; i < length; ++i)
+    data[i] = static_cast<char>('a' + i % 26);
+
+  std::unique_ptr<asio::coalescing_write_stream<tcp::socket&>> stream(
+      new asio::coalescing_write_stream<tcp::socket&>(
+        client_socket, length, asio::chrono::hours(1)));
+  stream->async_write_some(asio::buffer(data),
+      [](asio::error_code ec, std::size_t n)
+      {
+        ASIO_CHECK(!ec);
+        ASIO_CHECK(n == length);
+      });
+  ioc.poll();
+  stream.reset();
+
+  std::string received(length, '\0');
+  asio::async_read(server_socket, asio::buffer(&received[0], received.size()),
+      [](asio::error_code ec, std::size_t) { ASIO_CHECK(!ec); });
+
+  ioc.run();
+
+  ASIO_CHECK(received == data);
+}
+
+void test_error()
+{
+  asio::io_context ioc;
+
+  tcp::acceptor acceptor(ioc, tcp::endpoint(tcp::v4(), 0));
+  tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(asio::ip::address_v4::loopback());
+
+  tcp::socket client_socket(ioc);
+  client_socket.connect(server_endpoint);
+
+  tcp::socket server_socket(ioc);
+  acceptor.accept(server_socket);
+
+  asio::coalescing_write_stream<tcp::socket&> stream(
+      client_socket, 1024, asio::chrono::hours(1));
+  client_socket.close();
+
+  // Writes are buffered without error, but the flush fails, as do all later
+  // writes.
+  char data[] = "data";
+  bool written = false;
+  stream.async_write_some(asio::buffer(data),
+      [&](asio::error_code ec, std::size_t n)
+      {
+        ASIO_CHECK(!ec);
+        ASIO_CHECK(n == sizeof(data));
+        written = true;
+      });
+
+  bool flushed = false;
+  bool failed = false;
+  stream.async_flush(
+      [&](asio::error_code ec, std::size_t)
+      {
+        ASIO_CHECK(!!ec);
+        flushed = true;
+        stream.async_write_some(asio::buffer(data),
+            [&, ec](asio::error_code ec2, std::size_t n)
+            {
+              ASIO_CHECK(ec2 == ec);
+              ASIO_CHECK(n == 0);
+              failed = true;
+            });
+      });
+
+  ioc.run();
+
+  ASIO_CHECK(written);
+  ASIO_CHECK(flushed);
+  ASIO_CHECK(failed);
+  ASIO_CHECK(stream.pending() == 0);
+}
+
+//------------------------------------------------------------------------------
+
+ASIO_TEST_SUITE
+(
+  "coalescing_write_stream",
+  ASIO_COMPILE_TEST_CASE(test_compile)
+  ASIO_TEST_CASE(test_flush_threshold)
+  ASIO_TEST_CASE(test_max_latency)
+  ASIO_TEST_CASE(test_overlapping_flushes)
+  ASIO_TEST_CASE(test_destroy_while_writing)
+  ASIO_TEST_CASE(test_error)
+)
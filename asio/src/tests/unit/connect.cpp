@@ -117,6 +117,20 @@ void range_handler(const asio::error_code& ec,
   *out_endpoint = endpoint;
 }
 
+#if defined(ASIO_HAS_TCP_FASTOPEN)
+void range_data_handler(const asio::error_code& ec,
+    const asio::ip::tcp::endpoint& endpoint,
+    std::size_t bytes_transferred,
+    asio::error_code* out_ec,
+    asio::ip::tcp::endpoint* out_endpoint,
+    std::size_t* out_bytes_transferred)
+{
+  *out_ec = ec;
+  *out_endpoint = endpoint;
+  *out_bytes_transferred = bytes_transferred;
+}
+#endif // defined(ASIO_HAS_TCP_FASTOPEN)
+
 void iter_handler(const asio::error_code& ec,
     std::vector<asio::ip::tcp::endpoint>::const_iterator iter,
     asio::error_code* out_ec,
@@ -811,6 +825,53 @@ void test_async_connect_range()
   ASIO_CHECK(!ec);
 }
 
+void test_async_connect_range_data()
+{
+#if defined(ASIO_HAS_TCP_FASTOPEN)
+  using bindns::placeholders::_3;
+
+  connection_sink sink;
+  asio::io_context io_context;
+  asio::ip::tcp::socket socket(io_context);
+  std::vector<asio::ip::tcp::endpoint> endpoints;
+  asio::ip::tcp::endpoint result;
+  asio::error_code ec;
+  std::size_t bytes_transferred = 0;
+  const char data[] = "hello";
+
+  asio::async_connect(socket, endpoints, asio::buffer(data),
+      bindns::bind(range_data_handler, _1, _2, _3,
+        &ec, &result, &bytes_transferred));
+  io_context.restart();
+  io_context.run();
+  ASIO_CHECK(result == asio::ip::tcp::endpoint());
+  ASIO_CHECK(ec == asio::error::not_found);
+  ASIO_CHECK(bytes_transferred == 0);
+
+  endpoints.push_back(sink.target_endpoint());
+
+  asio::async_connect(socket, endpoints, asio::buffer(data),
+      bindns::bind(range_data_handler, _1, _2, _3,
+        &ec, &result, &bytes_transferred));
+  io_context.restart();
+  io_context.run();
+  ASIO_CHECK(result == endpoints[0]);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(bytes_transferred == sizeof(data));
+
+  endpoints.insert(endpoints.begin(), asio::ip::tcp::endpoint());
+
+  asio::async_connect(socket, endpoints, asio::buffer(data))(
+      bindns::bind(range_data_handler, _1, _2, _3,
+        &ec, &result, &bytes_transferred));
+  io_context.restart();
+  io_context.run();
+  ASIO_CHECK(result == endpoints[1]);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(bytes_transferred == sizeof(data));
+#endif // defined(ASIO_HAS_TCP_FASTOPEN)
+}
+
 void test_async_connect_range_cond()
 {
   connection_sink sink;
@@ -1203,6 +1264,7 @@ ASIO_TEST_SUITE
   ASIO_TEST_CASE(test_connect_iter_cond)
   ASIO_TEST_CASE(test_connect_iter_cond_ec)
   ASIO_TEST_CASE(test_async_connect_range)
+  ASIO_TEST_CASE(test_async_connect_range_data)
   ASIO_TEST_CASE(test_async_connect_range_cond)
   ASIO_TEST_CASE(test_async_connect_iter)
   ASIO_TEST_CASE(test_async_connect_iter_cond)
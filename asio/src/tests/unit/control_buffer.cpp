@@ -0,0 +1,124 @@
+//
+// control_buffer.cpp
+// ~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/control_buffer.hpp"
+
+#include "unit_test.hpp"
+
+//------------------------------------------------------------------------------
+
+// control_buffer_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks the runtime operation of the control_buffer and
+// control_message classes.
+
+namespace control_buffer_runtime {
+
+void test()
+{
+#if defined(ASIO_HAS_ANCILLARY_DATA)
+  using namespace asio;
+
+  control_buffer empty;
+  ASIO_CHECK(empty.size() == 0);
+  ASIO_CHECK(empty.capacity() == 0);
+  ASIO_CHECK(empty.begin() == empty.end());
+  ASIO_CHECK(!empty.push_back(SOL_SOCKET, 1, 0));
+
+  union
+  {
+    cmsghdr align;
+    char buf[64 + sizeof(cmsghdr)];
+  } storage;
+
+  // Misaligned storage is adjusted to the alignment of a message header.
+  control_buffer misaligned(storage.buf + 1, 64);
+  ASIO_CHECK(misaligned.capacity() <= 63);
+  ASIO_CHECK(reinterpret_cast<asio::uintptr_t>(
+        misaligned.data()) % alignof(cmsghdr) == 0);
+
+  control_buffer control(&storage, sizeof(storage));
+  ASIO_CHECK(control.data() == &storage);
+  ASIO_CHECK(control.capacity() == sizeof(storage));
+  ASIO_CHECK(control.begin() == control.end());
+
+  int value1 = 1234;
+  ASIO_CHECK(control.push_back(SOL_SOCKET, 10, value1));
+  ASIO_CHECK(control.size() == control_buffer::space(sizeof(int)));
+
+  short value2 = 56;
+  ASIO_CHECK(control.push_back(IPPROTO_IP, 20, &value2, sizeof(value2)));
+  ASIO_CHECK(control.size() == control_buffer::space(sizeof(int))
+      + control_buffer::space(sizeof(short)));
+
+  // A message that does not fit is rejected without modifying the buffer.
+  std::size_t size_before = control.size();
+  char large[sizeof(storage)] = { 0 };
+  ASIO_CHECK(!control.push_back(SOL_SOCKET, 30, large));
+  ASIO_CHECK(control.size() == size_before);
+
+  control_buffer::const_iterator iter = control.begin();
+  ASIO_CHECK(iter != control.end());
+  ASIO_CHECK(iter->level() == SOL_SOCKET);
+  ASIO_CHECK(iter->type() == 10);
+  ASIO_CHECK(iter->size() == sizeof(int));
+  ASIO_CHECK(iter->is(SOL_SOCKET, 10));
+  ASIO_CHECK(!iter->is(SOL_SOCKET, 20));
+  ASIO_CHECK(iter->value<int>() == 1234);
+
+  control_buffer::const_iterator prev = iter++;
+  ASIO_CHECK(prev->type() == 10);
+  ASIO_CHECK(iter != control.end());
+  ASIO_CHECK((*iter).level() == IPPROTO_IP);
+  ASIO_CHECK((*iter).type() == 20);
+  ASIO_CHECK((*iter).size() == sizeof(short));
+  ASIO_CHECK((*iter).value<short>() == 56);
+
+  // Reading a value larger than the payload leaves the excess zeroed.
+  struct { short first; short second; } pair_value
+    = iter->value<decltype(pair_value)>();
+  ASIO_CHECK(pair_value.first == 56);
+  ASIO_CHECK(pair_value.second == 0);
+
+  ++iter;
+  ASIO_CHECK(iter == control.end());
+
+  int count = 0;
+  for (control_buffer::const_iterator i = control.begin();
+      i != control.end(); ++i)
+    ++count;
+  ASIO_CHECK(count == 2);
+
+  control.resize(0);
+  ASIO_CHECK(control.begin() == control.end());
+
+  control.resize(sizeof(storage) * 2);
+  ASIO_CHECK(control.size() == control.capacity());
+
+  control.clear();
+  ASIO_CHECK(control.size() == 0);
+#endif // defined(ASIO_HAS_ANCILLARY_DATA)
+}
+
+} // namespace control_buffer_runtime
+
+//------------------------------------------------------------------------------
+
+ASIO_TEST_SUITE
+(
+  "control_buffer",
+  ASIO_TEST_CASE(control_buffer_runtime::test)
+)
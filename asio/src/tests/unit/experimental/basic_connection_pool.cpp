@@ -0,0 +1,243 @@
+//
+// experimental/basic_connection_pool.cpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/experimental/basic_connection_pool.hpp"
+
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "../unit_test.hpp"
+
+using asio::ip::tcp;
+using std::chrono::steady_clock;
+
+typedef asio::experimental::basic_connection_pool<tcp,
+    asio::io_context::executor_type> pool_type;
+
+struct checkout_result
+{
+  asio::error_code ec;
+  pool_type::socket_type socket;
+  bool called;
+
+  explicit checkout_result(asio::io_context& ctx)
+    : socket(ctx.get_executor()),
+      called(false)
+  {
+  }
+};
+
+struct checkout_handler
+{
+  checkout_result* result;
+
+  void operator()(asio::error_code ec, pool_type::socket_type socket)
+  {
+    result->ec = ec;
+    result->socket = std::move(socket);
+    result->called = true;
+  }
+};
+
+void pool_reuses_idle_connection()
+{
+  asio::io_context ctx;
+  tcp::acceptor acceptor(ctx,
+      tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+  tcp::endpoint endpoint = acceptor.local_endpoint();
+  pool_type pool(ctx.get_executor());
+
+  // A checkout with no idle connection establishes a new one.
+  pool_type::socket_type server(ctx.get_executor());
+  acceptor.async_accept(server, [](asio::error_code) {});
+  checkout_result r1(ctx);
+  pool.async_checkout(endpoint, checkout_handler{&r1});
+  ASIO_CHECK(!r1.called);
+  ctx.run();
+
+  ASIO_CHECK(r1.called);
+  ASIO_CHECK(!r1.ec);
+  ASIO_CHECK(r1.socket.is_open());
+  ASIO_CHECK(server.is_open());
+  tcp::socket::native_handle_type handle = r1.socket.native_handle();
+
+  pool.checkin(std::move(r1.socket));
+  ASIO_CHECK(!r1.socket.is_open());
+  ASIO_CHECK(pool.idle_size() == 1);
+  ASIO_CHECK(pool.idle_size(endpoint) == 1);
+
+  // A second checkout reuses the idle connection without connecting.
+  checkout_result r2(ctx);
+  pool.async_checkout(endpoint, checkout_handler{&r2});
+  ASIO_CHECK(!r2.called);
+  ASIO_CHECK(pool.idle_size() == 0);
+  ctx.restart();
+  ctx.run();
+
+  ASIO_CHECK(r2.called);
+  ASIO_CHECK(!r2.ec);
+  ASIO_CHECK(r2.socket.native_handle() == handle);
+}
+
+void pool_discards_closed_connection()
+{
+  asio::io_context ctx;
+  tcp::acceptor acceptor(ctx,
+      tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+  tcp::endpoint endpoint = acceptor.local_endpoint();
+  pool_type pool(ctx);
+
+  pool_type::socket_type server1(ctx.get_executor());
+  acceptor.async_accept(server1, [](asio::error_code) {});
+  checkout_result r1(ctx);
+  pool.async_checkout(endpoint, checkout_handler{&r1});
+  ctx.run();
+  ASIO_CHECK(!r1.ec);
+  pool.checkin(std::move(r1.socket));
+  ASIO_CHECK(pool.idle_size() == 1);
+
+  // Once the peer has closed the connection, it is not handed out again.
+  server1.close();
+
+  pool_type::socket_type server2(ctx.get_executor());
+  bool accepted = false;
+  acceptor.async_accept(server2,
+      [&](asio::error_code ec) { accepted = !ec; });
+  checkout_result r2(ctx);
+  pool.async_checkout(endpoint, checkout_handler{&r2});
+  ASIO_CHECK(pool.idle_size() == 0);
+  ctx.restart();
+  ctx.run();
+
+  ASIO_CHECK(r2.called);
+  ASIO_CHECK(!r2.ec);
+  ASIO_CHECK(accepted);
+  ASIO_CHECK(r2.socket.local_endpoint() == server2.remote_endpoint());
+}
+
+void pool_limits_idle_connections()
+{
+  asio::io_context ctx;
+  tcp::acceptor acceptor(ctx,
+      tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+  tcp::endpoint endpoint = acceptor.local_endpoint();
+  pool_type pool(ctx.get_executor());
+  pool.max_idle(1);
+  ASIO_CHECK(pool.max_idle() == 1);
+
+  pool_type::socket_type s1(ctx.get_executor());
+  pool_type::socket_type s2(ctx.get_executor());
+  s1.connect(endpoint);
+  s2.connect(endpoint);
+  tcp::socket::native_handle_type handle = s2.native_handle();
+
+  pool.checkin(std::move(s1));
+  pool.checkin(std::move(s2));
+  ASIO_CHECK(pool.idle_size() == 1);
+
+  // Only the most recently used connection was kept.
+  checkout_result r(ctx);
+  pool.async_checkout(endpoint, checkout_handler{&r});
+  ctx.run();
+  ASIO_CHECK(!r.ec);
+  ASIO_CHECK(r.socket.native_handle() == handle);
+
+  // Unconnected sockets are not pooled.
+  pool_type::socket_type unconnected(ctx.get_executor());
+  unconnected.open(tcp::v4());
+  pool.checkin(std::move(unconnected));
+  ASIO_CHECK(pool.idle_size() == 0);
+
+  // A limit of zero disables pooling.
+  pool.max_idle(0);
+  pool.checkin(std::move(r.socket));
+  ASIO_CHECK(pool.idle_size() == 0);
+}
+
+void pool_closes_expired_connections()
+{
+  asio::io_context ctx;
+  tcp::acceptor acceptor(ctx,
+      tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+  tcp::endpoint endpoint = acceptor.local_endpoint();
+  pool_type pool(ctx.get_executor());
+  pool.idle_timeout(std::chrono::milliseconds(50));
+
+  pool_type::socket_type s1(ctx.get_executor());
+  pool_type::socket_type s2(ctx.get_executor());
+  s1.connect(endpoint);
+  s2.connect(endpoint);
+  pool.checkin(std::move(s1));
+  pool.checkin(std::move(s2));
+  ASIO_CHECK(pool.idle_size() == 2);
+
+  // The reaper timer is the only outstanding work, and completes once all
+  // idle connections have expired.
+  steady_clock::time_point start = steady_clock::now();
+  ctx.run();
+  ASIO_CHECK(steady_clock::now() - start >= std::chrono::milliseconds(50));
+  ASIO_CHECK(pool.idle_size() == 0);
+  ASIO_CHECK(pool.idle_size(endpoint) == 0);
+}
+
+void pool_reports_connect_failure()
+{
+  asio::io_context ctx;
+  tcp::endpoint endpoint;
+  {
+    tcp::acceptor acceptor(ctx,
+        tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+    endpoint = acceptor.local_endpoint();
+  }
+
+  pool_type pool(ctx.get_executor());
+  checkout_result r(ctx);
+  pool.async_checkout(endpoint, checkout_handler{&r});
+  ctx.run();
+
+  ASIO_CHECK(r.called);
+  ASIO_CHECK(r.ec == asio::error::connection_refused);
+  ASIO_CHECK(!r.socket.is_open());
+}
+
+void pool_destroyed_with_idle_connections()
+{
+  asio::io_context ctx;
+  tcp::acceptor acceptor(ctx,
+      tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+  tcp::endpoint endpoint = acceptor.local_endpoint();
+
+  {
+    pool_type pool(ctx.get_executor());
+    pool_type::socket_type s(ctx.get_executor());
+    s.connect(endpoint);
+    pool.checkin(std::move(s));
+    ASIO_CHECK(pool.idle_size() == 1);
+  }
+
+  // The reaper's wait is cancelled and its handler ignores the dead pool.
+  ctx.run();
+}
+
+ASIO_TEST_SUITE
+(
+  "experimental/basic_connection_pool",
+  ASIO_TEST_CASE(pool_reuses_idle_connection)
+  ASIO_TEST_CASE(pool_discards_closed_connection)
+  ASIO_TEST_CASE(pool_limits_idle_connections)
+  ASIO_TEST_CASE(pool_closes_expired_connections)
+  ASIO_TEST_CASE(pool_reports_connect_failure)
+  ASIO_TEST_CASE(pool_destroyed_with_idle_connections)
+)
@@ -0,0 +1,222 @@
+//
+// experimental/connect_parallel.cpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/experimental/connect_parallel.hpp"
+
+#include <chrono>
+#include <vector>
+#include "asio/bind_cancellation_slot.hpp"
+#include "asio/cancellation_signal.hpp"
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "asio/thread_pool.hpp"
+#include "../unit_test.hpp"
+
+using namespace asio;
+using asio::experimental::async_connect_parallel;
+using std::chrono::steady_clock;
+
+struct connect_handler
+{
+  connect_handler(asio::error_code* ec, ip::tcp::endpoint* endpoint)
+    : ec_(ec),
+      endpoint_(endpoint)
+  {
+  }
+
+  void operator()(const asio::error_code& ec,
+      const ip::tcp::endpoint& endpoint)
+  {
+    *ec_ = ec;
+    *endpoint_ = endpoint;
+  }
+
+  asio::error_code* ec_;
+  ip::tcp::endpoint* endpoint_;
+};
+
+ip::tcp::endpoint loopback_endpoint(const ip::tcp::acceptor& acceptor)
+{
+  return ip::tcp::endpoint(ip::address_v4::loopback(),
+      acceptor.local_endpoint().port());
+}
+
+ip::tcp::endpoint refused_endpoint(io_context& ioc)
+{
+  // Bind a socket to obtain a free port, but do not listen on it.
+  ip::tcp::acceptor acceptor(ioc, ip::tcp::endpoint(ip::tcp::v4(), 0));
+  return loopback_endpoint(acceptor);
+}
+
+void test_first_endpoint_wins()
+{
+  io_context ioc;
+  ip::tcp::acceptor acceptor1(ioc, ip::tcp::endpoint(ip::tcp::v4(), 0));
+  ip::tcp::acceptor acceptor2(ioc, ip::tcp::endpoint(ip::tcp::v4(), 0));
+
+  std::vector<ip::tcp::endpoint> endpoints;
+  endpoints.push_back(loopback_endpoint(acceptor1));
+  endpoints.push_back(loopback_endpoint(acceptor2));
+
+  ip::tcp::socket socket(ioc);
+  asio::error_code ec = asio::error::would_block;
+  ip::tcp::endpoint endpoint;
+
+  // With a long attempt delay, the second attempt is never started.
+  steady_clock::time_point start = steady_clock::now();
+  async_connect_parallel(socket, endpoints,
+      std::chrono::seconds(10), connect_handler(&ec, &endpoint));
+  ioc.run();
+
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(endpoint == endpoints[0]);
+  ASIO_CHECK(socket.is_open());
+  ASIO_CHECK(socket.remote_endpoint() == endpoints[0]);
+  ASIO_CHECK(steady_clock::now() - start < std::chrono::seconds(5));
+
+  ip::tcp::socket server_socket(ioc);
+  acceptor1.accept(server_socket);
+  ASIO_CHECK(server_socket.remote_endpoint() == socket.local_endpoint());
+}
+
+void test_failed_attempt_starts_next()
+{
+  io_context ioc;
+  ip::tcp::acceptor acceptor(ioc, ip::tcp::endpoint(ip::tcp::v4(), 0));
+
+  std::vector<ip::tcp::endpoint> endpoints;
+  endpoints.push_back(refused_endpoint(ioc));
+  endpoints.push_back(loopback_endpoint(acceptor));
+
+  ip::tcp::socket socket(ioc);
+  asio::error_code ec = asio::error::would_block;
+  ip::tcp::endpoint endpoint;
+
+  // The refused attempt causes the next attempt to start without waiting for
+  // the attempt delay.
+  steady_clock::time_point start = steady_clock::now();
+  async_connect_parallel(socket, endpoints,
+      std::chrono::seconds(10), connect_handler(&ec, &endpoint));
+  ioc.run();
+
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(endpoint == endpoints[1]);
+  ASIO_CHECK(socket.is_open());
+  ASIO_CHECK(steady_clock::now() - start < std::chrono::seconds(5));
+}
+
+void test_all_attempts_fail()
+{
+  io_context ioc;
+
+  std::vector<ip::tcp::endpoint> endpoints;
+  endpoints.push_back(refused_endpoint(ioc));
+  endpoints.push_back(refused_endpoint(ioc));
+
+  ip::tcp::socket socket(ioc);
+  asio::error_code ec;
+  ip::tcp::endpoint endpoint;
+
+  async_connect_parallel(socket, endpoints, connect_handler(&ec, &endpoint));
+  ioc.run();
+
+  ASIO_CHECK(ec == asio::error::connection_refused);
+  ASIO_CHECK(endpoint == ip::tcp::endpoint());
+  ASIO_CHECK(!socket.is_open());
+}
+
+void test_empty_sequence()
+{
+  io_context ioc;
+  std::vector<ip::tcp::endpoint> endpoints;
+
+  ip::tcp::socket socket(ioc);
+  asio::error_code ec;
+  ip::tcp::endpoint endpoint;
+
+  async_connect_parallel(socket, endpoints, connect_handler(&ec, &endpoint));
+
+  // The handler is not invoked from within the initiating function.
+  ASIO_CHECK(!ec);
+
+  ioc.run();
+
+  ASIO_CHECK(ec == asio::error::not_found);
+}
+
+void test_cancellation()
+{
+  io_context ioc;
+
+  // A connection attempt that is waiting for its turn to start can be
+  // cancelled, even though the attempt before it is still pending.
+  std::vector<ip::tcp::endpoint> endpoints;
+  endpoints.push_back(refused_endpoint(ioc));
+  endpoints.push_back(refused_endpoint(ioc));
+
+  ip::tcp::socket socket(ioc);
+  asio::error_code ec;
+  ip::tcp::endpoint endpoint;
+  asio::cancellation_signal signal;
+
+  async_connect_parallel(socket, endpoints, std::chrono::seconds(10),
+      asio::bind_cancellation_slot(signal.slot(),
+        connect_handler(&ec, &endpoint)));
+  signal.emit(asio::cancellation_type::terminal);
+  ioc.run();
+
+  ASIO_CHECK(ec == asio::error::operation_aborted);
+  ASIO_CHECK(!socket.is_open());
+}
+
+void test_multithreaded_executor()
+{
+  io_context ioc;
+  ip::tcp::acceptor acceptor(ioc, ip::tcp::endpoint(ip::tcp::v4(), 0));
+
+  // Many short-lived attempts whose completions race with one another.
+  std::vector<ip::tcp::endpoint> endpoints;
+  for (int i = 0; i < 16; ++i)
+    endpoints.push_back(refused_endpoint(ioc));
+  endpoints.push_back(loopback_endpoint(acceptor));
+
+  for (int i = 0; i < 20; ++i)
+  {
+    asio::thread_pool pool(4);
+    ip::tcp::socket socket(pool);
+    asio::error_code ec = asio::error::would_block;
+    ip::tcp::endpoint endpoint;
+
+    async_connect_parallel(socket, endpoints, std::chrono::milliseconds(1),
+        connect_handler(&ec, &endpoint));
+    pool.join();
+
+    ASIO_CHECK(!ec);
+    ASIO_CHECK(endpoint == endpoints.back());
+    ASIO_CHECK(socket.is_open());
+  }
+}
+
+ASIO_TEST_SUITE
+(
+  "experimental/connect_parallel",
+  ASIO_TEST_CASE(test_first_endpoint_wins)
+  ASIO_TEST_CASE(test_failed_attempt_starts_next)
+  ASIO_TEST_CASE(test_all_attempts_fail)
+  ASIO_TEST_CASE(test_empty_sequence)
+  ASIO_TEST_CASE(test_cancellation)
+  ASIO_TEST_CASE(test_multithreaded_executor)
+)
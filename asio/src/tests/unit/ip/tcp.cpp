@@ -21,8 +21,13 @@
 
 #include <cstring>
 #include <functional>
+#include "asio/config.hpp"
+#include "asio/executor_work_guard.hpp"
 #include "asio/io_context.hpp"
+#include "asio/post.hpp"
 #include "asio/read.hpp"
+#include "asio/thread.hpp"
+#include "asio/use_future.hpp"
 #include "asio/write.hpp"
 #include "../unit_test.hpp"
 #include "../archetypes/async_result.hpp"
@@ -66,6 +71,28 @@ void test()
     (void)static_cast<bool>(!no_delay1);
     (void)static_cast<bool>(no_delay1.value());
 
+#if defined(ASIO_HAS_TCP_FASTOPEN)
+    // fast_open class.
+
+    ip::tcp::fast_open fast_open1(5);
+    sock.set_option(fast_open1);
+    ip::tcp::fast_open fast_open2;
+    sock.get_option(fast_open2);
+    fast_open1 = 5;
+    (void)static_cast<int>(fast_open1.value());
+
+    // fast_open_connect class.
+
+    ip::tcp::fast_open_connect fast_open_connect1(true);
+    sock.set_option(fast_open_connect1);
+    ip::tcp::fast_open_connect fast_open_connect2;
+    sock.get_option(fast_open_connect2);
+    fast_open_connect1 = true;
+    (void)static_cast<bool>(fast_open_connect1);
+    (void)static_cast<bool>(!fast_open_connect1);
+    (void)static_cast<bool>(fast_open_connect1.value());
+#endif // defined(ASIO_HAS_TCP_FASTOPEN)
+
     ip::tcp::endpoint ep;
     (void)static_cast<std::size_t>(std::hash<ip::tcp::endpoint>()(ep));
   }
@@ -526,6 +553,36 @@ void test()
     (void)i26;
     int i27 = socket1.async_read_some(null_buffers(), lazy);
     (void)i27;
+
+#if defined(ASIO_HAS_ANCILLARY_DATA)
+    control_buffer control;
+    socket_base::message_flags out_flags = 0;
+
+    socket1.async_send_msg(buffer(const_char_buffer),
+        control, in_flags, send_handler());
+    socket1.async_send_msg(const_buffers, control, in_flags, immediate);
+    int i28 = socket1.async_send_msg(buffer(const_char_buffer),
+        control, in_flags, lazy);
+    (void)i28;
+
+    socket1.async_receive_msg(buffer(mutable_char_buffer),
+        control, in_flags, out_flags, receive_handler());
+    socket1.async_receive_msg(mutable_buffers,
+        control, in_flags, out_flags, immediate);
+    int i29 = socket1.async_receive_msg(buffer(mutable_char_buffer),
+        control, in_flags, out_flags, lazy);
+    (void)i29;
+#endif // defined(ASIO_HAS_ANCILLARY_DATA)
+
+#if defined(ASIO_HAS_TCP_FASTOPEN)
+    socket1.async_connect(ip::tcp::endpoint(ip::tcp::v4(), 0),
+        buffer(const_char_buffer), send_handler());
+    socket1.async_connect(ip::tcp::endpoint(ip::tcp::v6(), 0),
+        const_buffers, immediate);
+    int i30 = socket1.async_connect(ip::tcp::endpoint(ip::tcp::v4(), 0),
+        buffer(mutable_char_buffer), lazy);
+    (void)i30;
+#endif // defined(ASIO_HAS_TCP_FASTOPEN)
   }
   catch (std::exception&)
   {
@@ -690,12 +747,165 @@ void test()
   ioc.restart();
   ioc.run();
   ASIO_CHECK(read_eof_completed);
+
+#if defined(ASIO_HAS_TCP_FASTOPEN)
+  // Connect with initial data. Server-side Fast Open may be disabled on the
+  // host, in which case the data is sent after the connection is established.
+
+  ip::tcp::acceptor fast_open_acceptor(ioc, ip::tcp::v4());
+  fast_open_acceptor.bind(ip::tcp::endpoint(ip::address_v4::loopback(), 0));
+  asio::error_code fast_open_ec;
+  fast_open_acceptor.set_option(ip::tcp::fast_open(5), fast_open_ec);
+  fast_open_acceptor.listen();
+  ip::tcp::endpoint fast_open_endpoint = fast_open_acceptor.local_endpoint();
+
+  ip::tcp::socket fast_open_client(ioc);
+  bool connect_completed = false;
+  fast_open_client.async_connect(fast_open_endpoint,
+      asio::buffer(write_data),
+      bindns::bind(handle_write,
+        _1, _2, &connect_completed));
+
+  ip::tcp::socket fast_open_server(ioc);
+  memset(read_buffer, 0, sizeof(read_buffer));
+  read_completed = false;
+  fast_open_acceptor.async_accept(fast_open_server,
+      [&](const asio::error_code& err)
+      {
+        ASIO_CHECK(!err);
+        asio::async_read(fast_open_server,
+            asio::buffer(read_buffer),
+            bindns::bind(handle_read,
+              _1, _2, &read_completed));
+      });
+
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(connect_completed);
+  ASIO_CHECK(read_completed);
+  ASIO_CHECK(memcmp(read_buffer, write_data, sizeof(write_data)) == 0);
+#endif // defined(ASIO_HAS_TCP_FASTOPEN)
 }
 
 } // namespace ip_tcp_socket_runtime
 
 //------------------------------------------------------------------------------
 
+// ip_tcp_socket_thread_rings_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks that operations on an ip::tcp::socket can be
+// cancelled from other threads when per-thread io_uring rings are enabled.
+// The configuration option is ignored by other backends.
+
+namespace ip_tcp_socket_thread_rings_runtime {
+
+void handle_read_cancel(const asio::error_code& err,
+    size_t bytes_transferred, bool* called)
+{
+  *called = true;
+  ASIO_CHECK(err == asio::error::operation_aborted);
+  ASIO_CHECK(bytes_transferred == 0);
+}
+
+void start_read(asio::ip::tcp::socket* socket,
+    char* data, size_t length, bool* called)
+{
+  namespace bindns = std;
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+
+  socket->async_read_some(asio::buffer(data, length),
+      bindns::bind(handle_read_cancel, _1, _2, called));
+}
+
+void cancel(asio::ip::tcp::socket* socket)
+{
+  socket->cancel();
+}
+
+void post_chain(asio::io_context* ioc, int* count)
+{
+  if (++*count < 1000)
+  {
+    namespace bindns = std;
+    asio::post(*ioc, bindns::bind(post_chain, ioc, count));
+  }
+}
+
+void io_context_run(asio::io_context* ioc)
+{
+  ioc->run();
+}
+
+void test()
+{
+#if defined(ASIO_HAS_STD_FUTURE_CLASS)
+  using namespace asio;
+  namespace ip = asio::ip;
+  namespace bindns = std;
+
+  io_context ioc(config_from_string("reactor.io_uring_thread_rings=1"));
+  executor_work_guard<io_context::executor_type> work
+    = make_work_guard(ioc);
+
+  ip::tcp::acceptor acceptor(ioc, ip::tcp::endpoint(ip::tcp::v4(), 0));
+  ip::tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(ip::address_v4::loopback());
+
+  ip::tcp::socket client_side_socket(ioc);
+  ip::tcp::socket server_side_socket(ioc);
+
+  client_side_socket.connect(server_endpoint);
+  acceptor.accept(server_side_socket);
+
+  asio::thread thread1(bindns::bind(io_context_run, &ioc));
+  asio::thread thread2(bindns::bind(io_context_run, &ioc));
+
+  enum { iterations = 20 };
+  char read_data[iterations][16];
+  bool read1_called[iterations] = { false };
+  bool read2_called[iterations] = { false };
+
+  for (int i = 0; i < iterations; ++i)
+  {
+    // A read started by a thread that runs the io_context, and cancelled by a
+    // thread that does not.
+    asio::post(ioc, use_future(bindns::bind(start_read,
+            &client_side_socket, read_data[i],
+            sizeof(read_data[i]), &read1_called[i]))).get();
+    client_side_socket.cancel();
+
+    // A read started and cancelled by threads that run the io_context, which
+    // need not be the same thread.
+    asio::post(ioc, use_future(bindns::bind(start_read,
+            &client_side_socket, read_data[i],
+            sizeof(read_data[i]), &read2_called[i]))).get();
+    asio::post(ioc, use_future(
+          bindns::bind(cancel, &client_side_socket))).get();
+  }
+
+  // Handlers that post further handlers wake the other thread running the
+  // io_context.
+  int count = 0;
+  asio::post(ioc, bindns::bind(post_chain, &ioc, &count));
+
+  work.reset();
+  thread1.join();
+  thread2.join();
+
+  for (int i = 0; i < iterations; ++i)
+  {
+    ASIO_CHECK(read1_called[i]);
+    ASIO_CHECK(read2_called[i]);
+  }
+  ASIO_CHECK(count == 1000);
+#endif // defined(ASIO_HAS_STD_FUTURE_CLASS)
+}
+
+} // namespace ip_tcp_socket_thread_rings_runtime
+
+//------------------------------------------------------------------------------
+
 // ip_tcp_acceptor_compile test
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // The following test checks that all public member functions on the class
@@ -721,6 +931,15 @@ private:
   accept_handler(const accept_handler&);
 };
 
+struct accept_batch_handler
+{
+  accept_batch_handler() {}
+  void operator()(const asio::error_code&, std::size_t) {}
+  accept_batch_handler(accept_batch_handler&&) {}
+private:
+  accept_batch_handler(const accept_batch_handler&);
+};
+
 struct move_accept_handler
 {
   move_accept_handler() {}
@@ -935,6 +1154,19 @@ void test()
     acceptor1.async_accept(peer_endpoint, immediate);
     acceptor1.async_accept(ioc, peer_endpoint, immediate);
     acceptor1.async_accept(ioc_ex, peer_endpoint, immediate);
+
+#if defined(ASIO_HAS_INCOMING_CPU)
+    acceptor1.attach_cpu_steering(4);
+    acceptor1.attach_cpu_steering(4, ec);
+#endif // defined(ASIO_HAS_INCOMING_CPU)
+
+#if !defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME)
+    acceptor1.async_accept_batch(&peer_socket1, 1, accept_batch_handler());
+    acceptor1.async_accept_batch(&peer_socket2, 1, accept_batch_handler());
+    acceptor1.async_accept_batch(&peer_socket1, 1, immediate);
+    int i6 = acceptor1.async_accept_batch(&peer_socket1, 1, lazy);
+    (void)i6;
+#endif // !defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME)
   }
   catch (std::exception&)
   {
@@ -1018,6 +1250,153 @@ void test()
   server_side_remote_endpoint = server_side_socket.remote_endpoint();
   ASIO_CHECK(server_side_remote_endpoint.port()
       == client_endpoint.port());
+
+#if defined(ASIO_HAS_ACCEPT4) && !defined(ASIO_HAS_IO_URING_AS_DEFAULT)
+  // Sockets accepted asynchronously are already in non-blocking mode.
+  ASIO_CHECK(server_side_socket.native_non_blocking());
+#endif // defined(ASIO_HAS_ACCEPT4) && !defined(ASIO_HAS_IO_URING_AS_DEFAULT)
+
+  client_side_socket.close();
+  server_side_socket.close();
+
+#if !defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME)
+  const std::size_t batch_size = 4;
+  ip::tcp::socket batch_clients[batch_size] =
+    { ip::tcp::socket(ioc), ip::tcp::socket(ioc),
+      ip::tcp::socket(ioc), ip::tcp::socket(ioc) };
+  ip::tcp::socket batch_servers[batch_size] =
+    { ip::tcp::socket(ioc), ip::tcp::socket(ioc),
+      ip::tcp::socket(ioc), ip::tcp::socket(ioc) };
+
+  for (std::size_t i = 0; i < batch_size; ++i)
+    batch_clients[i].connect(server_endpoint);
+
+  std::size_t accepted = 0;
+  std::size_t total_accepted = 0;
+  while (total_accepted < batch_size)
+  {
+    accepted = 0;
+    acceptor.async_accept_batch(batch_servers + total_accepted,
+        batch_size - total_accepted,
+        [&](const asio::error_code& err, std::size_t n)
+        {
+          ASIO_CHECK(!err);
+          accepted = n;
+        });
+
+    ioc.restart();
+    ioc.run();
+
+    ASIO_CHECK(accepted > 0);
+    if (accepted == 0)
+      break;
+    total_accepted += accepted;
+  }
+  ASIO_CHECK(total_accepted == batch_size);
+
+  for (std::size_t i = 0; i < total_accepted; ++i)
+  {
+    ASIO_CHECK(batch_servers[i].is_open());
+    char data = static_cast<char>(i);
+    asio::write(batch_servers[i], asio::buffer(&data, 1));
+  }
+
+  // Connections are accepted in order, so each client receives its index.
+  for (std::size_t i = 0; i < total_accepted; ++i)
+  {
+    char data = 0;
+    asio::read(batch_clients[i], asio::buffer(&data, 1));
+    ASIO_CHECK(data == static_cast<char>(i));
+  }
+
+  // Attempting to accept into an open socket fails immediately.
+  accepted = batch_size;
+  acceptor.async_accept_batch(batch_servers, 1,
+      [&](const asio::error_code& err, std::size_t n)
+      {
+        ASIO_CHECK(err == asio::error::already_open);
+        accepted = n;
+      });
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(accepted == 0);
+
+  // A connection that cannot be assigned to its socket is closed, and the
+  // failure is reported along with the connections that were assigned.
+  for (std::size_t i = 0; i < batch_size; ++i)
+  {
+    batch_clients[i].close();
+    batch_servers[i].close();
+  }
+
+  batch_clients[0].connect(server_endpoint);
+  batch_clients[1].connect(server_endpoint);
+
+  asio::error_code batch_ec;
+  accepted = 0;
+  acceptor.async_accept_batch(batch_servers, 2,
+      [&](const asio::error_code& err, std::size_t n)
+      {
+        batch_ec = err;
+        accepted = n;
+      });
+  batch_servers[1].open(ip::tcp::v4());
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(batch_ec == asio::error::already_open);
+  ASIO_CHECK(accepted == 1);
+  ASIO_CHECK(batch_servers[0].is_open());
+
+  batch_clients[0].close();
+  batch_clients[1].close();
+  batch_servers[0].close();
+  batch_servers[1].close();
+#endif // !defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME)
+
+#if defined(ASIO_HAS_INCOMING_CPU)
+  // Build a SO_REUSEPORT group of two acceptors and steer connections between
+  // them by the receiving CPU.
+  ip::tcp::acceptor steered1(ioc, ip::tcp::v4());
+  steered1.set_option(socket_base::reuse_port(true));
+  steered1.bind(ip::tcp::endpoint(ip::address_v4::loopback(), 0));
+  steered1.listen();
+
+  ip::tcp::acceptor steered2(ioc, ip::tcp::v4());
+  steered2.set_option(socket_base::reuse_port(true));
+  steered2.bind(steered1.local_endpoint());
+  steered2.listen();
+
+  asio::error_code ec;
+  steered1.attach_cpu_steering(0, ec);
+  ASIO_CHECK(ec == asio::error::invalid_argument);
+
+  steered1.attach_cpu_steering(2, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  client_side_socket.close();
+  client_side_socket.connect(steered1.local_endpoint());
+
+  // The connection is queued on exactly one of the acceptors.
+  steered1.non_blocking(true);
+  steered2.non_blocking(true);
+  ip::tcp::socket steered_socket(ioc);
+  for (int i = 0; i < 100 && !steered_socket.is_open(); ++i)
+  {
+    steered1.accept(steered_socket, ec);
+    if (!steered_socket.is_open())
+      steered2.accept(steered_socket, ec);
+  }
+  ASIO_CHECK(steered_socket.is_open());
+
+  socket_base::incoming_cpu cpu;
+  steered_socket.get_option(cpu, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  ASIO_CHECK(cpu.value() >= 0);
+#endif // defined(ASIO_HAS_INCOMING_CPU)
 }
 
 } // namespace ip_tcp_acceptor_runtime
@@ -1280,6 +1659,7 @@ ASIO_TEST_SUITE
   ASIO_TEST_CASE(ip_tcp_runtime::test)
   ASIO_COMPILE_TEST_CASE(ip_tcp_socket_compile::test)
   ASIO_TEST_CASE(ip_tcp_socket_runtime::test)
+  ASIO_TEST_CASE(ip_tcp_socket_thread_rings_runtime::test)
   ASIO_COMPILE_TEST_CASE(ip_tcp_acceptor_compile::test)
   ASIO_TEST_CASE(ip_tcp_acceptor_runtime::test)
   ASIO_COMPILE_TEST_CASE(ip_tcp_resolver_compile::test)
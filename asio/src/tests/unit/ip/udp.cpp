@@ -27,6 +27,54 @@
 
 //------------------------------------------------------------------------------
 
+// ip_udp_compile test
+// ~~~~~~~~~~~~~~~~~~~
+// The following test checks that all nested classes, enums and constants in
+// ip::udp compile and link correctly. Runtime failures are ignored.
+
+namespace ip_udp_compile {
+
+void test()
+{
+#if defined(ASIO_HAS_UDP_GSO)
+  using namespace asio;
+  namespace ip = asio::ip;
+
+  try
+  {
+    io_context ioc;
+    ip::udp::socket sock(ioc);
+
+    // segment_size class.
+
+    ip::udp::segment_size segment_size1(1200);
+    sock.set_option(segment_size1);
+    ip::udp::segment_size segment_size2;
+    sock.get_option(segment_size2);
+    segment_size1 = 1400;
+    (void)static_cast<int>(segment_size1.value());
+
+    // generic_receive_offload class.
+
+    ip::udp::generic_receive_offload generic_receive_offload1(true);
+    sock.set_option(generic_receive_offload1);
+    ip::udp::generic_receive_offload generic_receive_offload2;
+    sock.get_option(generic_receive_offload2);
+    generic_receive_offload1 = true;
+    (void)static_cast<bool>(generic_receive_offload1);
+    (void)static_cast<bool>(!generic_receive_offload1);
+    (void)static_cast<bool>(generic_receive_offload1.value());
+  }
+  catch (std::exception&)
+  {
+  }
+#endif // defined(ASIO_HAS_UDP_GSO)
+}
+
+} // namespace ip_udp_compile
+
+//------------------------------------------------------------------------------
+
 // ip_udp_socket_compile test
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~
 // The following test checks that all public member functions on the class
@@ -469,6 +517,51 @@ void test()
     int i29 = socket1.async_receive_from(null_buffers(),
         endpoint, in_flags, lazy);
     (void)i29;
+
+#if defined(ASIO_HAS_MMSG)
+    ip::udp::socket::send_message_type send_messages[2] = {
+      ip::udp::socket::send_message_type(buffer(const_char_buffer), endpoint),
+      ip::udp::socket::send_message_type(buffer(const_char_buffer), endpoint)
+    };
+
+    socket1.async_send_batch(send_messages, 2, in_flags, send_handler());
+    socket1.async_send_batch(send_messages, 2, in_flags, immediate);
+    int i30 = socket1.async_send_batch(send_messages, 2, in_flags, lazy);
+    (void)i30;
+
+    ip::udp::socket::receive_message_type receive_messages[2] = {
+      ip::udp::socket::receive_message_type(buffer(mutable_char_buffer)),
+      ip::udp::socket::receive_message_type(buffer(mutable_char_buffer))
+    };
+
+    socket1.async_receive_batch(receive_messages, 2,
+        in_flags, receive_handler());
+    socket1.async_receive_batch(receive_messages, 2, in_flags, immediate);
+    int i31 = socket1.async_receive_batch(receive_messages, 2,
+        in_flags, lazy);
+    (void)i31;
+#endif // defined(ASIO_HAS_MMSG)
+
+#if defined(ASIO_HAS_ANCILLARY_DATA)
+    control_buffer control;
+    socket_base::message_flags out_flags = 0;
+
+    socket1.async_send_msg(buffer(const_char_buffer),
+        endpoint, control, in_flags, send_handler());
+    socket1.async_send_msg(buffer(const_char_buffer),
+        endpoint, control, in_flags, immediate);
+    int i32 = socket1.async_send_msg(buffer(const_char_buffer),
+        endpoint, control, in_flags, lazy);
+    (void)i32;
+
+    socket1.async_receive_msg(buffer(mutable_char_buffer),
+        endpoint, control, in_flags, out_flags, receive_handler());
+    socket1.async_receive_msg(buffer(mutable_char_buffer),
+        endpoint, control, in_flags, out_flags, immediate);
+    int i33 = socket1.async_receive_msg(buffer(mutable_char_buffer),
+        endpoint, control, in_flags, out_flags, lazy);
+    (void)i33;
+#endif // defined(ASIO_HAS_ANCILLARY_DATA)
   }
   catch (std::exception&)
   {
@@ -499,6 +592,13 @@ void handle_recv(size_t expected_bytes_recvd,
   ASIO_CHECK(expected_bytes_recvd == bytes_recvd);
 }
 
+void handle_batch(const asio::error_code& err, size_t messages_transferred,
+    asio::error_code* out_err, size_t* out_messages_transferred)
+{
+  *out_err = err;
+  *out_messages_transferred = messages_transferred;
+}
+
 void test()
 {
   using namespace std; // For memcmp and memset.
@@ -540,6 +640,216 @@ void test()
   ioc.run();
 
   ASIO_CHECK(memcmp(send_msg, recv_msg, sizeof(send_msg)) == 0);
+
+#if defined(ASIO_HAS_MMSG)
+  // Send and receive a batch of datagrams.
+
+  target_endpoint = s1.local_endpoint();
+  target_endpoint.address(ip::address_v4::loopback());
+
+  ip::udp::socket::send_message_type send_messages[3] = {
+    ip::udp::socket::send_message_type(
+        buffer(send_msg, 10), target_endpoint),
+    ip::udp::socket::send_message_type(
+        buffer(send_msg + 10, 20), target_endpoint),
+    ip::udp::socket::send_message_type(
+        buffer(send_msg + 30, 5), target_endpoint)
+  };
+
+  char recv_msgs[4][sizeof(send_msg)];
+  memset(recv_msgs, 0, sizeof(recv_msgs));
+  ip::udp::socket::receive_message_type receive_messages[4] = {
+    ip::udp::socket::receive_message_type(buffer(recv_msgs[0])),
+    ip::udp::socket::receive_message_type(buffer(recv_msgs[1])),
+    ip::udp::socket::receive_message_type(buffer(recv_msgs[2])),
+    ip::udp::socket::receive_message_type(buffer(recv_msgs[3]))
+  };
+
+  s2.async_send_batch(send_messages, 3, 0,
+      bindns::bind(handle_send, 3, _1, _2));
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(send_messages[0].length() == 10);
+  ASIO_CHECK(send_messages[1].length() == 20);
+  ASIO_CHECK(send_messages[2].length() == 5);
+
+  // All datagrams are queued on the loopback interface, so they are received
+  // by a single batch operation.
+  s1.async_receive_batch(receive_messages, 4, 0,
+      bindns::bind(handle_recv, 3, _1, _2));
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(receive_messages[0].length() == 10);
+  ASIO_CHECK(receive_messages[1].length() == 20);
+  ASIO_CHECK(receive_messages[2].length() == 5);
+  ASIO_CHECK(receive_messages[3].length() == 0);
+  ASIO_CHECK(receive_messages[0].endpoint().port()
+      == s2.local_endpoint().port());
+  ASIO_CHECK(memcmp(recv_msgs[0], send_msg, 10) == 0);
+  ASIO_CHECK(memcmp(recv_msgs[1], send_msg + 10, 20) == 0);
+  ASIO_CHECK(memcmp(recv_msgs[2], send_msg + 30, 5) == 0);
+
+#if defined(ASIO_HAS_UDP_GSO)
+  // Send a single buffer as a train of segments. Segmentation offload may be
+  // unavailable in the environment running the test, in which case the
+  // remaining checks are skipped.
+
+  asio::error_code ec;
+  s1.set_option(ip::udp::generic_receive_offload(true), ec);
+  if (!ec)
+  {
+    send_messages[0] = ip::udp::socket::send_message_type(
+        buffer(send_msg, 30), target_endpoint);
+    send_messages[0].segment_size(10);
+
+    std::size_t messages_sent = 0;
+    s2.async_send_batch(send_messages, 1, 0,
+        bindns::bind(handle_batch, _1, _2, &ec, &messages_sent));
+
+    ioc.restart();
+    ioc.run();
+
+    if (!ec)
+    {
+      ASIO_CHECK(messages_sent == 1);
+      ASIO_CHECK(send_messages[0].length() == 30);
+
+      // The segments are either delivered as a single coalesced buffer, or
+      // as separate datagrams of the segment size. Other ancillary data
+      // received alongside the segment size must not displace it.
+# if defined(SO_TIMESTAMPNS)
+      typedef asio::detail::socket_option::boolean<
+        SOL_SOCKET, SO_TIMESTAMPNS> timestamp_ns;
+      s1.set_option(timestamp_ns(true));
+# endif // defined(SO_TIMESTAMPNS)
+      memset(recv_msgs, 0, sizeof(recv_msgs));
+      std::size_t bytes_recvd = 0;
+      while (bytes_recvd < 30)
+      {
+        std::size_t messages_recvd = 0;
+        s1.async_receive_batch(receive_messages, 4, 0,
+            bindns::bind(handle_batch, _1, _2, &ec, &messages_recvd));
+
+        ioc.restart();
+        ioc.run();
+
+        ASIO_CHECK(!ec);
+        if (ec)
+          break;
+
+        for (std::size_t i = 0; i < messages_recvd; ++i)
+        {
+          ASIO_CHECK(memcmp(recv_msgs[i], send_msg + bytes_recvd,
+                receive_messages[i].length()) == 0);
+          if (receive_messages[i].length() > 10)
+            ASIO_CHECK(receive_messages[i].segment_size() == 10);
+          else
+            ASIO_CHECK(receive_messages[i].length() == 10);
+          ASIO_CHECK((receive_messages[i].flags() & MSG_CTRUNC) == 0);
+          bytes_recvd += receive_messages[i].length();
+        }
+      }
+      ASIO_CHECK(bytes_recvd == 30);
+# if defined(SO_TIMESTAMPNS)
+      s1.set_option(timestamp_ns(false));
+# endif // defined(SO_TIMESTAMPNS)
+    }
+  }
+
+  // A segment size that does not fit in a UDP_SEGMENT message is rejected.
+
+  send_messages[0] = ip::udp::socket::send_message_type(
+      buffer(send_msg, 30), target_endpoint);
+  send_messages[0].segment_size(65536);
+
+  std::size_t messages_sent = 0;
+  s2.async_send_batch(send_messages, 1, 0,
+      bindns::bind(handle_batch, _1, _2, &ec, &messages_sent));
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(ec == asio::error::invalid_argument);
+  ASIO_CHECK(messages_sent == 0);
+#endif // defined(ASIO_HAS_UDP_GSO)
+
+  // A message without an endpoint is sent to the connected peer.
+
+  ip::udp::socket s3(ioc, ip::udp::endpoint(ip::udp::v4(), 0));
+  s3.connect(target_endpoint);
+
+  send_messages[0] = ip::udp::socket::send_message_type(buffer(send_msg, 10));
+  s3.async_send_batch(send_messages, 1, 0,
+      bindns::bind(handle_send, 1, _1, _2));
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(send_messages[0].length() == 10);
+
+  memset(recv_msgs, 0, sizeof(recv_msgs));
+  s1.async_receive_batch(receive_messages, 1, 0,
+      bindns::bind(handle_recv, 1, _1, _2));
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(receive_messages[0].length() == 10);
+  ASIO_CHECK(receive_messages[0].endpoint().port()
+      == s3.local_endpoint().port());
+  ASIO_CHECK(memcmp(recv_msgs[0], send_msg, 10) == 0);
+#endif // defined(ASIO_HAS_MMSG)
+
+#if defined(ASIO_HAS_ANCILLARY_DATA) \
+  && defined(__linux__) && defined(IP_PKTINFO)
+  // Receive a datagram together with the address to which it was sent.
+
+  typedef asio::detail::socket_option::boolean<
+    IPPROTO_IP, IP_PKTINFO> packet_info;
+  s1.set_option(packet_info(true));
+
+  target_endpoint = s1.local_endpoint();
+  target_endpoint.address(ip::address_v4::loopback());
+
+  union
+  {
+    cmsghdr align;
+    char buf[CMSG_SPACE(sizeof(in_pktinfo))];
+  } control_storage;
+  control_buffer control(&control_storage, sizeof(control_storage));
+  socket_base::message_flags out_flags = 0;
+  memset(recv_msg, 0, sizeof(recv_msg));
+
+  s2.async_send_msg(buffer(send_msg, 10), target_endpoint,
+      control_buffer(), 0, bindns::bind(handle_send, 10, _1, _2));
+  s1.async_receive_msg(buffer(recv_msg, sizeof(recv_msg)), sender_endpoint,
+      control, 0, out_flags, bindns::bind(handle_recv, 10, _1, _2));
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(memcmp(send_msg, recv_msg, 10) == 0);
+  ASIO_CHECK(sender_endpoint.port() == s2.local_endpoint().port());
+  ASIO_CHECK((out_flags & MSG_CTRUNC) == 0);
+
+  int packet_info_count = 0;
+  for (control_buffer::const_iterator iter = control.begin();
+      iter != control.end(); ++iter)
+  {
+    if (iter->is(IPPROTO_IP, IP_PKTINFO))
+    {
+      in_pktinfo info = iter->value<in_pktinfo>();
+      ASIO_CHECK(ntohl(info.ipi_addr.s_addr) == 0x7F000001);
+      ++packet_info_count;
+    }
+  }
+  ASIO_CHECK(packet_info_count == 1);
+#endif // defined(ASIO_HAS_ANCILLARY_DATA)
+       //   && defined(__linux__) && defined(IP_PKTINFO)
 }
 
 } // namespace ip_udp_socket_runtime
@@ -669,6 +979,7 @@ void test()
 ASIO_TEST_SUITE
 (
   "ip/udp",
+  ASIO_COMPILE_TEST_CASE(ip_udp_compile::test)
   ASIO_COMPILE_TEST_CASE(ip_udp_socket_compile::test)
   ASIO_TEST_CASE(ip_udp_socket_runtime::test)
   ASIO_COMPILE_TEST_CASE(ip_udp_resolver_compile::test)
@@ -0,0 +1,207 @@
+//
+// fd_passing.cpp
+// ~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/local/fd_passing.hpp"
+
+#include <cstring>
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "asio/local/connect_pair.hpp"
+#include "asio/read.hpp"
+#include "asio/write.hpp"
+#include "../unit_test.hpp"
+
+//------------------------------------------------------------------------------
+
+// local_fd_passing_compile test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks that all descriptor passing functions compile and
+// link correctly. Runtime failures are ignored.
+
+namespace local_fd_passing_compile {
+
+struct send_handler
+{
+  send_handler() {}
+  void operator()(const asio::error_code&, std::size_t) {}
+  send_handler(send_handler&&) {}
+private:
+  send_handler(const send_handler&);
+};
+
+struct receive_handler
+{
+  receive_handler() {}
+  void operator()(const asio::error_code&, std::size_t, std::size_t) {}
+  receive_handler(receive_handler&&) {}
+private:
+  receive_handler(const receive_handler&);
+};
+
+void test()
+{
+#if defined(ASIO_HAS_LOCAL_SOCKETS) && defined(ASIO_HAS_ANCILLARY_DATA)
+  using namespace asio;
+  namespace local = asio::local;
+  typedef local::stream_protocol sp;
+
+  try
+  {
+    io_context ioc;
+    char data[16] = "";
+    sp::socket::native_handle_type handles[4] = { 0, 0, 0, 0 };
+    asio::error_code ec;
+
+    sp::socket s1(ioc);
+    sp::socket s2(ioc);
+
+    local::async_send_with_fds(s1, buffer(data), handles, 4, send_handler());
+    local::async_receive_with_fds(s1, buffer(data),
+        handles, 4, receive_handler());
+
+    ip::tcp::socket s3(ioc);
+    local::adopt_socket(s3, handles[0]);
+    local::adopt_socket(s2, handles[1], ec);
+  }
+  catch (std::exception&)
+  {
+  }
+#endif // defined(ASIO_HAS_LOCAL_SOCKETS) && defined(ASIO_HAS_ANCILLARY_DATA)
+}
+
+} // namespace local_fd_passing_compile
+
+//------------------------------------------------------------------------------
+
+// local_fd_passing_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks the runtime operation of passing a connected TCP
+// socket over a UNIX domain stream socket and adopting it on the other side.
+
+namespace local_fd_passing_runtime {
+
+#if defined(ASIO_HAS_LOCAL_SOCKETS) && defined(ASIO_HAS_ANCILLARY_DATA)
+
+void test()
+{
+  using namespace asio;
+  namespace local = asio::local;
+  typedef local::stream_protocol sp;
+
+  io_context ioc;
+
+  sp::socket channel1(ioc);
+  sp::socket channel2(ioc);
+  local::connect_pair(channel1, channel2);
+
+  ip::tcp::acceptor acceptor(ioc,
+      ip::tcp::endpoint(ip::address_v4::loopback(), 0));
+  ip::tcp::socket client(ioc);
+  client.connect(acceptor.local_endpoint());
+  ip::tcp::socket server(ioc);
+  acceptor.accept(server);
+
+  // Send the accepted connection, together with an unrelated socket that the
+  // receiver has no room for.
+  sp::socket::native_handle_type sent[2] =
+    { server.native_handle(), channel1.native_handle() };
+  const char message[] = "handoff";
+  asio::error_code send_ec;
+  std::size_t bytes_sent = 0;
+  local::async_send_with_fds(channel1, buffer(message, sizeof(message)),
+      sent, 2, [&](asio::error_code ec, std::size_t n)
+      {
+        send_ec = ec;
+        bytes_sent = n;
+      });
+
+  char received_data[32] = "";
+  sp::socket::native_handle_type received[1] = { -1 };
+  asio::error_code receive_ec;
+  std::size_t bytes_received = 0;
+  std::size_t handles_received = 0;
+  local::async_receive_with_fds(channel2, buffer(received_data),
+      received, 1, [&](asio::error_code ec, std::size_t n, std::size_t h)
+      {
+        receive_ec = ec;
+        bytes_received = n;
+        handles_received = h;
+      });
+
+  ioc.run();
+
+  ASIO_CHECK(!send_ec);
+  ASIO_CHECK(bytes_sent == sizeof(message));
+  ASIO_CHECK(!receive_ec);
+  ASIO_CHECK(bytes_received == sizeof(message));
+  ASIO_CHECK(std::memcmp(received_data, message, sizeof(message)) == 0);
+  ASIO_CHECK(handles_received == 1);
+  ASIO_CHECK(received[0] != -1);
+  ASIO_CHECK(received[0] != server.native_handle());
+
+  // A TCP socket cannot be adopted as a UNIX domain socket.
+  sp::socket wrong_family(ioc);
+  asio::error_code adopt_ec;
+  local::adopt_socket(wrong_family, received[0], adopt_ec);
+  ASIO_CHECK(adopt_ec == asio::error::invalid_argument);
+  ASIO_CHECK(!wrong_family.is_open());
+
+  ip::tcp::socket adopted(ioc);
+  local::adopt_socket(adopted, received[0], adopt_ec);
+  ASIO_CHECK(!adopt_ec);
+  ASIO_CHECK(adopted.is_open());
+  ASIO_CHECK(adopted.remote_endpoint() == client.local_endpoint());
+
+  // The connection survives the sender closing its own descriptor.
+  server.close();
+
+  const char reply[] = "adopted";
+  char client_data[sizeof(reply)] = "";
+  std::size_t client_bytes = 0;
+  async_write(adopted, buffer(reply, sizeof(reply)),
+      [](asio::error_code, std::size_t) {});
+  async_read(client, buffer(client_data),
+      [&](asio::error_code ec, std::size_t n)
+      {
+        ASIO_CHECK(!ec);
+        client_bytes = n;
+      });
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(client_bytes == sizeof(reply));
+  ASIO_CHECK(std::memcmp(client_data, reply, sizeof(reply)) == 0);
+}
+
+#else // defined(ASIO_HAS_LOCAL_SOCKETS) && defined(ASIO_HAS_ANCILLARY_DATA)
+
+void test()
+{
+}
+
+#endif // defined(ASIO_HAS_LOCAL_SOCKETS) && defined(ASIO_HAS_ANCILLARY_DATA)
+
+} // namespace local_fd_passing_runtime
+
+//------------------------------------------------------------------------------
+
+ASIO_TEST_SUITE
+(
+  "local/fd_passing",
+  ASIO_COMPILE_TEST_CASE(local_fd_passing_compile::test)
+  ASIO_TEST_CASE(local_fd_passing_runtime::test)
+)
@@ -45,6 +45,24 @@ private:
   read_some_at_handler(const read_some_at_handler&);
 };
 
+struct file_op_handler
+{
+  file_op_handler() {}
+  void operator()(const asio::error_code&) {}
+  file_op_handler(file_op_handler&&) {}
+private:
+  file_op_handler(const file_op_handler&);
+};
+
+struct size_handler
+{
+  size_handler() {}
+  void operator()(const asio::error_code&, asio::uint64_t) {}
+  size_handler(size_handler&&) {}
+private:
+  size_handler(const size_handler&);
+};
+
 void test()
 {
 #if defined(ASIO_HAS_FILE)
@@ -134,6 +152,27 @@ void test()
     file1.sync_data();
     file1.sync_data(ec);
 
+    file1.async_open("", random_access_file::read_only, file_op_handler());
+    file1.async_open(path, random_access_file::read_only, file_op_handler());
+    int i4 = file1.async_open(path, random_access_file::read_only, lazy);
+    (void)i4;
+
+    file1.async_size(size_handler());
+    int i5 = file1.async_size(lazy);
+    (void)i5;
+
+    file1.async_resize(asio::uint64_t(0), file_op_handler());
+    int i6 = file1.async_resize(asio::uint64_t(0), lazy);
+    (void)i6;
+
+    file1.async_sync_all(file_op_handler());
+    int i7 = file1.async_sync_all(lazy);
+    (void)i7;
+
+    file1.async_sync_data(file_op_handler());
+    int i8 = file1.async_sync_data(lazy);
+    (void)i8;
+
     file1.write_some_at(0, buffer(mutable_char_buffer));
     file1.write_some_at(0, buffer(const_char_buffer));
     file1.write_some_at(0, buffer(mutable_char_buffer), ec);
@@ -18,6 +18,8 @@
 
 #include <cstring>
 #include <functional>
+#include <string>
+#include <vector>
 #include "archetypes/async_result.hpp"
 #include "asio/io_context.hpp"
 #include "asio/post.hpp"
@@ -1701,6 +1703,160 @@ void test_streambuf_async_read_until_match_condition()
 #endif // !defined(ASIO_NO_DYNAMIC_BUFFER_V1)
 }
 
+// A dynamic buffer whose data is presented as a sequence of small buffers, so
+// that delimiters may span buffer boundaries. Each buffer is followed by an
+// empty buffer with a null data pointer.
+class chunked_buffer
+{
+public:
+  typedef std::vector<asio::const_buffer> const_buffers_type;
+  typedef std::vector<asio::mutable_buffer> mutable_buffers_type;
+
+  chunked_buffer(std::string& data, std::size_t chunk_size)
+    : data_(data),
+      chunk_size_(chunk_size)
+  {
+  }
+
+  std::size_t size() const
+  {
+    return data_.size();
+  }
+
+  std::size_t max_size() const
+  {
+    return data_.max_size();
+  }
+
+  std::size_t capacity() const
+  {
+    return data_.capacity();
+  }
+
+  const_buffers_type data(std::size_t pos, std::size_t n) const
+  {
+    const_buffers_type buffers;
+    for (std::size_t end = pos + (std::min)(n, data_.size() - pos);
+        pos < end; pos += chunk_size_)
+    {
+      buffers.push_back(asio::const_buffer(data_.data() + pos,
+            (std::min)(chunk_size_, end - pos)));
+      buffers.push_back(asio::const_buffer());
+    }
+    return buffers;
+  }
+
+  mutable_buffers_type data(std::size_t pos, std::size_t n)
+  {
+    mutable_buffers_type buffers;
+    for (std::size_t end = pos + (std::min)(n, data_.size() - pos);
+        pos < end; pos += chunk_size_)
+    {
+      buffers.push_back(asio::mutable_buffer(&data_[0] + pos,
+            (std::min)(chunk_size_, end - pos)));
+    }
+    return buffers;
+  }
+
+  void grow(std::size_t n)
+  {
+    data_.resize(data_.size() + n);
+  }
+
+  void shrink(std::size_t n)
+  {
+    data_.resize(data_.size() - n);
+  }
+
+  void consume(std::size_t n)
+  {
+    data_.erase(0, n);
+  }
+
+private:
+  std::string& data_;
+  std::size_t chunk_size_;
+};
+
+static const char chunked_read_data[]
+  = "GET / HTTP/1.1\r\nHost: x\r\n\r\r\n\r\n\r\nbody";
+
+void test_chunked_read_until()
+{
+  namespace bindns = std;
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+
+  asio::io_context ioc;
+  test_stream s(ioc);
+  asio::error_code ec;
+  std::size_t length;
+  bool called;
+
+  for (std::size_t chunk_size = 1; chunk_size <= 8; ++chunk_size)
+  {
+    for (std::size_t read_length = 1; read_length <= 8; ++read_length)
+    {
+      std::string data;
+
+      s.reset(chunked_read_data, sizeof(chunked_read_data) - 1);
+      s.next_read_length(read_length);
+      length = asio::read_until(s, chunked_buffer(data, chunk_size), '\n');
+      ASIO_CHECK(length == 16);
+
+      s.reset(chunked_read_data, sizeof(chunked_read_data) - 1);
+      s.next_read_length(read_length);
+      data.clear();
+      length = asio::read_until(s, chunked_buffer(data, chunk_size), "\r\n");
+      ASIO_CHECK(length == 16);
+
+      s.reset(chunked_read_data, sizeof(chunked_read_data) - 1);
+      s.next_read_length(read_length);
+      data.clear();
+      length = asio::read_until(s,
+          chunked_buffer(data, chunk_size), "\r\n\r\n", ec);
+      ASIO_CHECK(!ec);
+      ASIO_CHECK(length == 30);
+
+      s.reset(chunked_read_data, sizeof(chunked_read_data) - 1);
+      s.next_read_length(read_length);
+      data.clear();
+      length = asio::read_until(s,
+          chunked_buffer(data, chunk_size), "\r\n\r\nbody", ec);
+      ASIO_CHECK(!ec);
+      ASIO_CHECK(length == 36);
+
+      s.reset(chunked_read_data, sizeof(chunked_read_data) - 1);
+      s.next_read_length(read_length);
+      data.clear();
+      length = 0;
+      called = false;
+      asio::async_read_until(s, chunked_buffer(data, chunk_size), "\r\n\r\n",
+          bindns::bind(async_read_handler, _1, &ec,
+            _2, &length, &called));
+      ioc.restart();
+      ioc.run();
+      ASIO_CHECK(called);
+      ASIO_CHECK(!ec);
+      ASIO_CHECK(length == 30);
+
+      s.reset(chunked_read_data, sizeof(chunked_read_data) - 1);
+      s.next_read_length(read_length);
+      data.clear();
+      length = 0;
+      called = false;
+      asio::async_read_until(s, chunked_buffer(data, chunk_size), 'y',
+          bindns::bind(async_read_handler, _1, &ec,
+            _2, &length, &called));
+      ioc.restart();
+      ioc.run();
+      ASIO_CHECK(called);
+      ASIO_CHECK(!ec);
+      ASIO_CHECK(length == 36);
+    }
+  }
+}
+
 ASIO_TEST_SUITE
 (
   "read_until",
@@ -1716,4 +1872,5 @@ ASIO_TEST_SUITE
   ASIO_TEST_CASE(test_streambuf_async_read_until_string)
   ASIO_TEST_CASE(test_dynamic_string_async_read_until_match_condition)
   ASIO_TEST_CASE(test_streambuf_async_read_until_match_condition)
+  ASIO_TEST_CASE(test_chunked_read_until)
 )
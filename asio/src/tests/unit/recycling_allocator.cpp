@@ -19,6 +19,9 @@
 #include "unit_test.hpp"
 #include <vector>
 #include "asio/detail/type_traits.hpp"
+#include "asio/io_context.hpp"
+#include "asio/post.hpp"
+#include "asio/thread.hpp"
 
 void recycling_allocator_test()
 {
@@ -73,8 +76,129 @@ void recycling_allocator_test()
   ASIO_CHECK(v.size() == 42);
 }
 
+void recycling_allocator_size_class_test()
+{
+  asio::recycling_allocator<char> a;
+
+  asio::recycling_allocator_statistics s0 =
+    asio::this_thread_recycling_allocator_statistics();
+  ASIO_CHECK(s0.allocations == 0);
+
+  asio::io_context ioc;
+  asio::post(ioc,
+      [&]()
+      {
+        asio::recycling_allocator_statistics s =
+          asio::this_thread_recycling_allocator_statistics();
+
+        // Blocks of similar sizes share a size class, and are reused.
+        char* p1 = a.allocate(100);
+        a.deallocate(p1, 100);
+        char* p2 = a.allocate(104);
+        ASIO_CHECK(p2 == p1);
+        a.deallocate(p2, 104);
+
+        // Blocks of a different size class are not.
+        char* p3 = a.allocate(300);
+        ASIO_CHECK(p3 != p1);
+        a.deallocate(p3, 300);
+
+        // Large blocks are not cached.
+        char* p4 = a.allocate(100000);
+        a.deallocate(p4, 100000);
+
+        asio::recycling_allocator_statistics s1 =
+          asio::this_thread_recycling_allocator_statistics();
+        ASIO_CHECK(s1.allocations - s.allocations == 4);
+        ASIO_CHECK(s1.deallocations - s.deallocations == 4);
+        ASIO_CHECK(s1.cache_hits - s.cache_hits >= 1);
+        ASIO_CHECK(s1.heap_deallocations - s.heap_deallocations == 1);
+
+        // Freeing more blocks than fit in the cache moves them to the depot,
+        // from where they can be reused.
+        std::vector<char*> blocks;
+        for (int i = 0; i < 100; ++i)
+          blocks.push_back(a.allocate(64));
+        for (std::size_t i = 0; i < blocks.size(); ++i)
+          a.deallocate(blocks[i], 64);
+        for (std::size_t i = 0; i < blocks.size(); ++i)
+          blocks[i] = a.allocate(64);
+        for (std::size_t i = 0; i < blocks.size(); ++i)
+          a.deallocate(blocks[i], 64);
+
+        asio::recycling_allocator_statistics s2 =
+          asio::this_thread_recycling_allocator_statistics();
+        ASIO_CHECK(s2.allocations - s.allocations == 204);
+        ASIO_CHECK(s2.deallocations - s.deallocations == 204);
+        ASIO_CHECK(s2.depot_flushes > 0);
+        ASIO_CHECK(s2.depot_refills > 0);
+        ASIO_CHECK(s2.cache_hits > s1.cache_hits + 50);
+      });
+  ioc.run();
+}
+
+void recycling_allocator_cross_thread_test()
+{
+  asio::recycling_allocator<char> a;
+  std::vector<char*> blocks;
+
+  // Blocks that are allocated on one thread and freed on another are returned
+  // to the depot, and so can be reused by the allocating thread.
+  asio::io_context producer;
+  asio::post(producer,
+      [&]()
+      {
+        for (int i = 0; i < 100; ++i)
+          blocks.push_back(a.allocate(500));
+      });
+  producer.run();
+
+  asio::io_context consumer;
+  asio::post(consumer,
+      [&]()
+      {
+        for (std::size_t i = 0; i < blocks.size(); ++i)
+          a.deallocate(blocks[i], 500);
+        blocks.clear();
+
+        asio::recycling_allocator_statistics s =
+          asio::this_thread_recycling_allocator_statistics();
+        ASIO_CHECK(s.depot_flushes > 0);
+      });
+  asio::thread consumer_thread(
+      [&]()
+      {
+        consumer.run();
+      });
+  consumer_thread.join();
+
+  producer.restart();
+  asio::post(producer,
+      [&]()
+      {
+        asio::recycling_allocator_statistics s0 =
+          asio::this_thread_recycling_allocator_statistics();
+
+        for (int i = 0; i < 80; ++i)
+          blocks.push_back(a.allocate(500));
+
+        asio::recycling_allocator_statistics s1 =
+          asio::this_thread_recycling_allocator_statistics();
+        ASIO_CHECK(s1.allocations - s0.allocations == 80);
+        ASIO_CHECK(s1.cache_hits - s0.cache_hits == 80);
+        ASIO_CHECK(s1.heap_allocations == s0.heap_allocations);
+        ASIO_CHECK(s1.depot_refills > s0.depot_refills);
+
+        for (std::size_t i = 0; i < blocks.size(); ++i)
+          a.deallocate(blocks[i], 500);
+      });
+  producer.run();
+}
+
 ASIO_TEST_SUITE
 (
   "recycling_allocator",
   ASIO_TEST_CASE(recycling_allocator_test)
+  ASIO_TEST_CASE(recycling_allocator_size_class_test)
+  ASIO_TEST_CASE(recycling_allocator_cross_thread_test)
 )
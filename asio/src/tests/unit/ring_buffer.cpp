@@ -0,0 +1,192 @@
+//
+// ring_buffer.cpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/ring_buffer.hpp"
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "asio/read.hpp"
+#include "asio/read_until.hpp"
+#include "asio/write.hpp"
+#include "unit_test.hpp"
+
+#if defined(ASIO_HAS_MEMFD)
+
+using asio::ip::tcp;
+
+std::string to_string(const asio::const_buffer& b)
+{
+  return std::string(static_cast<const char*>(b.data()), b.size());
+}
+
+void test_wrap_around()
+{
+  asio::ring_buffer b(1);
+  std::size_t capacity = b.capacity();
+  ASIO_CHECK(capacity > 0);
+  ASIO_CHECK(b.max_size() == capacity);
+  ASIO_CHECK(b.size() == 0);
+
+  const char* start = static_cast<const char*>(b.data(0, 0).data());
+
+  // Move the start of the data close to the end of the buffer.
+  b.grow(capacity);
+  b.consume(capacity - 4);
+  ASIO_CHECK(b.size() == 4);
+  ASIO_CHECK(b.data(0, 4).data() == start + capacity - 4);
+
+  // Data that wraps around the end of the buffer is contiguous.
+  b.grow(4);
+  asio::mutable_buffer m = b.data(0, 8);
+  ASIO_CHECK(m.size() == 8);
+  std::memcpy(m.data(), "abcdefgh", 8);
+  ASIO_CHECK(to_string(b.data(0, 8)) == "abcdefgh");
+  ASIO_CHECK(to_string(b.data(2, 4)) == "cdef");
+  ASIO_CHECK(to_string(b.data(6, 100)) == "gh");
+  ASIO_CHECK(to_string(b.data(100, 100)).empty());
+
+  // The wrapped part of the data is also visible at the beginning of the
+  // buffer.
+  b.consume(4);
+  ASIO_CHECK(b.data(0, 4).data() == start);
+  ASIO_CHECK(to_string(b.data(0, 4)) == "efgh");
+
+  b.consume(100);
+  ASIO_CHECK(b.size() == 0);
+}
+
+void test_max_size()
+{
+  asio::ring_buffer b(1);
+  std::size_t capacity = b.capacity();
+  b.grow(capacity);
+
+  bool thrown = false;
+  try
+  {
+    b.grow(1);
+  }
+  catch (std::length_error&)
+  {
+    thrown = true;
+  }
+  ASIO_CHECK(thrown);
+  ASIO_CHECK(b.size() == capacity);
+
+  b.consume(capacity);
+  asio::dynamic_ring_buffer d = asio::dynamic_buffer(b, 10);
+  ASIO_CHECK(d.max_size() == 10);
+  ASIO_CHECK(d.capacity() == 10);
+  d.grow(10);
+
+  thrown = false;
+  try
+  {
+    d.grow(1);
+  }
+  catch (std::length_error&)
+  {
+    thrown = true;
+  }
+  ASIO_CHECK(thrown);
+  ASIO_CHECK(d.size() == 10);
+}
+
+void test_dynamic_buffer()
+{
+  ASIO_CHECK(asio::is_dynamic_buffer_v2<asio::dynamic_ring_buffer>::value);
+
+  asio::io_context ioc;
+  tcp::acceptor acceptor(ioc,
+      tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+  tcp::socket client(ioc);
+  tcp::socket server(ioc);
+  client.connect(acceptor.local_endpoint());
+  acceptor.accept(server);
+
+  asio::ring_buffer b(1);
+  std::size_t capacity = b.capacity();
+
+  // Send enough messages that the data wraps around the end of the buffer.
+  std::string message = "0123456789abcdef0123456789abcdef\r\n";
+  std::size_t message_count = capacity / message.size() * 3;
+  std::size_t received = 0;
+  std::size_t sent = 0;
+  while (received < message_count)
+  {
+    if (sent < message_count)
+    {
+      asio::write(client, asio::buffer(message));
+      ++sent;
+    }
+
+    std::size_t n = asio::read_until(server,
+        asio::dynamic_buffer(b), "\r\n");
+    ASIO_CHECK(n == message.size());
+    ASIO_CHECK(to_string(b.data(0, n)) == message);
+    b.consume(n);
+    ++received;
+  }
+
+  // Echo the remaining data back using a composed write operation.
+  asio::write(client, asio::buffer(message));
+  std::size_t n = asio::read_until(server, asio::dynamic_buffer(b), "\r\n");
+  ASIO_CHECK(n == message.size());
+
+  std::size_t written = 0;
+  asio::async_write(server, asio::dynamic_buffer(b),
+      [&](asio::error_code ec, std::size_t bytes_transferred)
+      {
+        ASIO_CHECK(!ec);
+        written = bytes_transferred;
+      });
+  ioc.run();
+  ASIO_CHECK(written == message.size());
+  ASIO_CHECK(b.size() == 0);
+
+  std::string echoed(message.size(), '\0');
+  asio::read(client, asio::buffer(&echoed[0], echoed.size()));
+  ASIO_CHECK(echoed == message);
+}
+
+#else // defined(ASIO_HAS_MEMFD)
+
+void test_wrap_around()
+{
+}
+
+void test_max_size()
+{
+}
+
+void test_dynamic_buffer()
+{
+}
+
+#endif // defined(ASIO_HAS_MEMFD)
+
+//------------------------------------------------------------------------------
+
+ASIO_TEST_SUITE
+(
+  "ring_buffer",
+  ASIO_TEST_CASE(test_wrap_around)
+  ASIO_TEST_CASE(test_max_size)
+  ASIO_TEST_CASE(test_dynamic_buffer)
+)
@@ -144,6 +144,30 @@ void test()
     (void)static_cast<bool>(!reuse_address1);
     (void)static_cast<bool>(reuse_address1.value());
 
+#if defined(ASIO_HAS_REUSE_PORT)
+    // reuse_port class.
+
+    socket_base::reuse_port reuse_port1(true);
+    sock.set_option(reuse_port1);
+    socket_base::reuse_port reuse_port2;
+    sock.get_option(reuse_port2);
+    reuse_port1 = true;
+    (void)static_cast<bool>(reuse_port1);
+    (void)static_cast<bool>(!reuse_port1);
+    (void)static_cast<bool>(reuse_port1.value());
+#endif // defined(ASIO_HAS_REUSE_PORT)
+
+#if defined(ASIO_HAS_INCOMING_CPU)
+    // incoming_cpu class.
+
+    socket_base::incoming_cpu incoming_cpu1(0);
+    sock.set_option(incoming_cpu1);
+    socket_base::incoming_cpu incoming_cpu2;
+    sock.get_option(incoming_cpu2);
+    incoming_cpu1 = 1;
+    (void)static_cast<int>(incoming_cpu1.value());
+#endif // defined(ASIO_HAS_INCOMING_CPU)
+
     // linger class.
 
     socket_base::linger linger1(true, 30);
@@ -576,6 +600,46 @@ void test()
   ASIO_CHECK(!static_cast<bool>(reuse_address4));
   ASIO_CHECK(!reuse_address4);
 
+#if defined(ASIO_HAS_INCOMING_CPU)
+  // reuse_port class.
+
+  socket_base::reuse_port reuse_port1(true);
+  ASIO_CHECK(reuse_port1.value());
+  ASIO_CHECK(static_cast<bool>(reuse_port1));
+  ASIO_CHECK(!!reuse_port1);
+  udp_sock.set_option(reuse_port1, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  socket_base::reuse_port reuse_port2;
+  udp_sock.get_option(reuse_port2, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  ASIO_CHECK(reuse_port2.value());
+  ASIO_CHECK(static_cast<bool>(reuse_port2));
+  ASIO_CHECK(!!reuse_port2);
+
+  socket_base::reuse_port reuse_port3(false);
+  ASIO_CHECK(!reuse_port3.value());
+  udp_sock.set_option(reuse_port3, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  socket_base::reuse_port reuse_port4;
+  udp_sock.get_option(reuse_port4, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  ASIO_CHECK(!reuse_port4.value());
+
+  // incoming_cpu class.
+
+  socket_base::incoming_cpu incoming_cpu1(0);
+  ASIO_CHECK(incoming_cpu1.value() == 0);
+  udp_sock.set_option(incoming_cpu1, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  socket_base::incoming_cpu incoming_cpu2;
+  udp_sock.get_option(incoming_cpu2, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  ASIO_CHECK(incoming_cpu2.value() == 0);
+#endif // defined(ASIO_HAS_INCOMING_CPU)
+
   // linger class.
 
   socket_base::linger linger1(true, 60);
@@ -0,0 +1,215 @@
+//
+// splice.cpp
+// ~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/splice.hpp"
+
+#include <cstring>
+#include <functional>
+#include <limits>
+#include "archetypes/async_result.hpp"
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "asio/read.hpp"
+#include "asio/readable_pipe.hpp"
+#include "asio/writable_pipe.hpp"
+#include "asio/write.hpp"
+#include "unit_test.hpp"
+
+//------------------------------------------------------------------------------
+
+// splice_compile test
+// ~~~~~~~~~~~~~~~~~~~
+// The following test checks that the async_splice function and the pipe
+// splicing member functions of stream sockets compile and link correctly.
+// Runtime failures are ignored.
+
+namespace splice_compile {
+
+struct splice_handler
+{
+  splice_handler() {}
+  void operator()(const asio::error_code&, std::size_t) {}
+  splice_handler(splice_handler&&) {}
+private:
+  splice_handler(const splice_handler&);
+};
+
+void test()
+{
+#if defined(ASIO_HAS_SPLICE)
+  using namespace asio;
+  namespace ip = asio::ip;
+
+  try
+  {
+    io_context ioc;
+    archetypes::lazy_handler lazy;
+
+    ip::tcp::socket socket1(ioc);
+    ip::tcp::socket socket2(ioc);
+    readable_pipe pipe1(ioc);
+    writable_pipe pipe2(ioc);
+
+    socket1.async_splice_to_pipe(pipe2, 1024, splice_handler());
+    int i1 = socket1.async_splice_to_pipe(pipe2, 1024, lazy);
+    (void)i1;
+
+    socket1.async_splice_from_pipe(pipe1, 1024, splice_handler());
+    int i2 = socket1.async_splice_from_pipe(pipe1, 1024, lazy);
+    (void)i2;
+
+    async_splice(socket1, socket2, 1024, splice_handler());
+    int i3 = async_splice(socket1, socket2, 1024, lazy);
+    (void)i3;
+  }
+  catch (std::exception&)
+  {
+  }
+#endif // defined(ASIO_HAS_SPLICE)
+}
+
+} // namespace splice_compile
+
+//------------------------------------------------------------------------------
+
+// splice_runtime test
+// ~~~~~~~~~~~~~~~~~~~
+// The following test checks the runtime operation of the async_splice
+// function.
+
+namespace splice_runtime {
+
+#if defined(ASIO_HAS_SPLICE)
+
+void handle_splice(const asio::error_code& err,
+    std::size_t bytes_transferred, asio::error_code* out_err,
+    std::size_t* out_bytes_transferred)
+{
+  *out_err = err;
+  *out_bytes_transferred = bytes_transferred;
+}
+
+void handle_write(const asio::error_code& err,
+    asio::ip::tcp::socket* socket)
+{
+  ASIO_CHECK(!err);
+  socket->shutdown(asio::ip::tcp::socket::shutdown_send);
+}
+
+void test()
+{
+  using namespace std; // For memcmp and memset.
+  using namespace asio;
+  namespace ip = asio::ip;
+
+  namespace bindns = std;
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+
+  io_context ioc;
+
+  ip::tcp::acceptor acceptor(ioc, ip::tcp::endpoint(ip::tcp::v4(), 0));
+  ip::tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(ip::address_v4::loopback());
+
+  ip::tcp::socket source_client(ioc);
+  ip::tcp::socket source_server(ioc);
+  source_client.connect(server_endpoint);
+  acceptor.accept(source_server);
+
+  ip::tcp::socket target_client(ioc);
+  ip::tcp::socket target_server(ioc);
+  target_client.connect(server_endpoint);
+  acceptor.accept(target_server);
+
+  static char write_data[200000];
+  for (std::size_t i = 0; i < sizeof(write_data); ++i)
+    write_data[i] = static_cast<char>(i % 251);
+
+  static char read_data[sizeof(write_data)];
+  memset(read_data, 0, sizeof(read_data));
+
+  // Move a limited number of bytes.
+
+  asio::write(source_client, asio::buffer(write_data, 1000));
+
+  asio::error_code ec;
+  std::size_t bytes_transferred = 0;
+  async_splice(source_server, target_client, 600,
+      bindns::bind(handle_splice, _1, _2, &ec, &bytes_transferred));
+
+  ioc.run();
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(bytes_transferred == 600);
+
+  asio::read(target_server, asio::buffer(read_data, 600));
+  ASIO_CHECK(memcmp(read_data, write_data, 600) == 0);
+
+  // Move everything until the source connection is closed.
+
+  asio::async_write(source_client,
+      asio::buffer(write_data + 1000, sizeof(write_data) - 1000),
+      bindns::bind(handle_write, _1, &source_client));
+
+  async_splice(source_server, target_client,
+      (std::numeric_limits<std::size_t>::max)(),
+      bindns::bind(handle_splice, _1, _2, &ec, &bytes_transferred));
+
+  asio::error_code read_ec;
+  std::size_t read_bytes = 0;
+  asio::async_read(target_server,
+      asio::buffer(read_data + 600, sizeof(read_data) - 600),
+      bindns::bind(handle_splice, _1, _2, &read_ec, &read_bytes));
+
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(ec == asio::error::eof);
+  ASIO_CHECK(bytes_transferred == sizeof(write_data) - 600);
+  ASIO_CHECK(!read_ec);
+  ASIO_CHECK(read_bytes == sizeof(write_data) - 600);
+  ASIO_CHECK(memcmp(read_data, write_data, sizeof(write_data)) == 0);
+
+  // A zero-length splice completes immediately.
+
+  ec = asio::error::would_block;
+  bytes_transferred = 1;
+  async_splice(source_server, target_client, 0,
+      bindns::bind(handle_splice, _1, _2, &ec, &bytes_transferred));
+
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(bytes_transferred == 0);
+}
+
+#else // defined(ASIO_HAS_SPLICE)
+
+void test()
+{
+}
+
+#endif // defined(ASIO_HAS_SPLICE)
+
+} // namespace splice_runtime
+
+//------------------------------------------------------------------------------
+
+ASIO_TEST_SUITE
+(
+  "splice",
+  ASIO_COMPILE_TEST_CASE(splice_compile::test)
+  ASIO_TEST_CASE(splice_runtime::test)
+)
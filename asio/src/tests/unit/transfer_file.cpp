@@ -0,0 +1,76 @@
+//
+// transfer_file.cpp
+// ~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/transfer_file.hpp"
+
+#include "archetypes/async_result.hpp"
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "asio/random_access_file.hpp"
+#include "unit_test.hpp"
+
+// transfer_file_compile test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks that the async_transfer_file function and the
+// async_send_file member function of stream sockets compile and link
+// correctly. Runtime failures are ignored.
+
+namespace transfer_file_compile {
+
+struct transfer_handler
+{
+  transfer_handler() {}
+  void operator()(const asio::error_code&, std::size_t) {}
+  transfer_handler(transfer_handler&&) {}
+private:
+  transfer_handler(const transfer_handler&);
+};
+
+void test()
+{
+#if defined(ASIO_HAS_SENDFILE)
+  using namespace asio;
+  namespace ip = asio::ip;
+
+  try
+  {
+    io_context ioc;
+    archetypes::lazy_handler lazy;
+
+    ip::tcp::socket socket1(ioc);
+    random_access_file file1(ioc);
+
+    socket1.async_send_file(file1, 0, 1024, transfer_handler());
+    int i1 = socket1.async_send_file(file1, 0, 1024, lazy);
+    (void)i1;
+
+    async_transfer_file(socket1, file1, 0, 1024, transfer_handler());
+    int i2 = async_transfer_file(socket1, file1, 0, 1024, lazy);
+    (void)i2;
+  }
+  catch (std::exception&)
+  {
+  }
+#endif // defined(ASIO_HAS_SENDFILE)
+}
+
+} // namespace transfer_file_compile
+
+ASIO_TEST_SUITE
+(
+  "transfer_file",
+  ASIO_COMPILE_TEST_CASE(transfer_file_compile::test)
+)
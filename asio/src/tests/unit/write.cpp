@@ -21,6 +21,7 @@
 #include <functional>
 #include <vector>
 #include "archetypes/async_result.hpp"
+#include "asio/bind_allocator.hpp"
 #include "asio/io_context.hpp"
 #include "asio/post.hpp"
 #include "asio/streambuf.hpp"
@@ -131,6 +132,58 @@ private:
   size_t next_write_length_;
 };
 
+// An allocator that counts the array allocations and the live allocations.
+template <typename T>
+class counting_allocator
+{
+public:
+  typedef T value_type;
+
+  counting_allocator(size_t* array_allocations, size_t* live_allocations)
+    : array_allocations_(array_allocations),
+      live_allocations_(live_allocations)
+  {
+  }
+
+  template <typename U>
+  counting_allocator(const counting_allocator<U>& other)
+    : array_allocations_(other.array_allocations_),
+      live_allocations_(other.live_allocations_)
+  {
+  }
+
+  T* allocate(size_t n)
+  {
+    if (n > 1)
+      ++*array_allocations_;
+    ++*live_allocations_;
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p, size_t n)
+  {
+    --*live_allocations_;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  friend bool operator==(const counting_allocator& a,
+      const counting_allocator& b)
+  {
+    return a.live_allocations_ == b.live_allocations_;
+  }
+
+  friend bool operator!=(const counting_allocator& a,
+      const counting_allocator& b)
+  {
+    return a.live_allocations_ != b.live_allocations_;
+  }
+
+private:
+  template <typename> friend class counting_allocator;
+  size_t* array_allocations_;
+  size_t* live_allocations_;
+};
+
 static const char write_data[]
   = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
 static char mutable_write_data[]
@@ -223,6 +276,36 @@ void test_2_arg_vector_buffers_write()
   ASIO_CHECK(s.check_buffers(buffers, sizeof(write_data)));
 }
 
+void test_2_arg_long_vector_buffers_write()
+{
+  asio::io_context ioc;
+  test_stream s(ioc);
+  std::vector<asio::const_buffer> buffers;
+  size_t total_length = 0;
+  for (size_t i = 0; i < 2000; ++i)
+  {
+    buffers.push_back(asio::buffer(write_data + i % 40, 1 + i % 5));
+    total_length += 1 + i % 5;
+  }
+
+  s.reset();
+  size_t bytes_transferred = asio::write(s, buffers);
+  ASIO_CHECK(bytes_transferred == total_length);
+  ASIO_CHECK(s.check_buffers(buffers, total_length));
+
+  s.reset();
+  s.next_write_length(1);
+  bytes_transferred = asio::write(s, buffers);
+  ASIO_CHECK(bytes_transferred == total_length);
+  ASIO_CHECK(s.check_buffers(buffers, total_length));
+
+  s.reset();
+  s.next_write_length(100);
+  bytes_transferred = asio::write(s, buffers);
+  ASIO_CHECK(bytes_transferred == total_length);
+  ASIO_CHECK(s.check_buffers(buffers, total_length));
+}
+
 void test_2_arg_dynamic_string_write()
 {
   asio::io_context ioc;
@@ -2470,6 +2553,92 @@ void test_3_arg_vector_buffers_async_write()
   ASIO_CHECK(s.check_buffers(buffers, sizeof(write_data)));
 }
 
+void test_3_arg_long_vector_buffers_async_write()
+{
+  namespace bindns = std;
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+
+  asio::io_context ioc;
+  test_stream s(ioc);
+  std::vector<asio::const_buffer> buffers;
+  size_t total_length = 0;
+  for (size_t i = 0; i < 2000; ++i)
+  {
+    buffers.push_back(asio::buffer(write_data + i % 40, 1 + i % 5));
+    total_length += 1 + i % 5;
+  }
+
+  s.reset();
+  bool called = false;
+  asio::async_write(s, buffers,
+      bindns::bind(async_write_handler,
+        _1, _2, total_length, &called));
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(called);
+  ASIO_CHECK(s.check_buffers(buffers, total_length));
+
+  s.reset();
+  s.next_write_length(1);
+  called = false;
+  asio::async_write(s, buffers,
+      bindns::bind(async_write_handler,
+        _1, _2, total_length, &called));
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(called);
+  ASIO_CHECK(s.check_buffers(buffers, total_length));
+
+  s.reset();
+  s.next_write_length(100);
+  called = false;
+  asio::async_write(s, buffers,
+      bindns::bind(async_write_handler,
+        _1, _2, total_length, &called));
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(called);
+  ASIO_CHECK(s.check_buffers(buffers, total_length));
+}
+
+void test_3_arg_long_vector_buffers_async_write_allocation()
+{
+  asio::io_context ioc;
+  test_stream s(ioc);
+  std::vector<asio::const_buffer> buffers;
+  size_t total_length = 0;
+  for (size_t i = 0; i < 2000; ++i)
+  {
+    buffers.push_back(asio::buffer(write_data + i % 40, 1 + i % 5));
+    total_length += 1 + i % 5;
+  }
+
+  // The storage for long windows is allocated once per operation using the
+  // handler's allocator, and is freed before the handler is called.
+  size_t array_allocations = 0;
+  size_t live_allocations = 0;
+  s.reset();
+  s.next_write_length(1);
+  bool called = false;
+  asio::async_write(s, buffers,
+      asio::bind_allocator(
+        counting_allocator<int>(&array_allocations, &live_allocations),
+        [&](const asio::error_code& e, size_t bytes_transferred)
+        {
+          called = true;
+          ASIO_CHECK(!e);
+          ASIO_CHECK(bytes_transferred == total_length);
+          ASIO_CHECK(live_allocations == 0);
+        }));
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(called);
+  ASIO_CHECK(array_allocations == 2);
+  ASIO_CHECK(live_allocations == 0);
+  ASIO_CHECK(s.check_buffers(buffers, total_length));
+}
+
 void test_3_arg_dynamic_string_async_write()
 {
   namespace bindns = std;
@@ -4948,6 +5117,7 @@ ASIO_TEST_SUITE
   ASIO_TEST_CASE(test_2_arg_const_buffer_write)
   ASIO_TEST_CASE(test_2_arg_mutable_buffer_write)
   ASIO_TEST_CASE(test_2_arg_vector_buffers_write)
+  ASIO_TEST_CASE(test_2_arg_long_vector_buffers_write)
   ASIO_TEST_CASE(test_2_arg_dynamic_string_write)
   ASIO_TEST_CASE(test_3_arg_nothrow_zero_buffers_write)
   ASIO_TEST_CASE(test_3_arg_nothrow_const_buffer_write)
@@ -4967,6 +5137,8 @@ ASIO_TEST_SUITE
   ASIO_TEST_CASE(test_3_arg_boost_array_buffers_async_write)
   ASIO_TEST_CASE(test_3_arg_std_array_buffers_async_write)
   ASIO_TEST_CASE(test_3_arg_vector_buffers_async_write)
+  ASIO_TEST_CASE(test_3_arg_long_vector_buffers_async_write)
+  ASIO_TEST_CASE(test_3_arg_long_vector_buffers_async_write_allocation)
   ASIO_TEST_CASE(test_3_arg_dynamic_string_async_write)
   ASIO_TEST_CASE(test_3_arg_streambuf_async_write)
   ASIO_TEST_CASE(test_4_arg_const_buffer_async_write)
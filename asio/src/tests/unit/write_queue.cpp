@@ -0,0 +1,321 @@
+//
+// write_queue.cpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2025 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/write_queue.hpp"
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include "archetypes/async_result.hpp"
+#include "asio/executor_work_guard.hpp"
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "asio/post.hpp"
+#include "asio/read.hpp"
+#include "asio/thread.hpp"
+#include "asio/thread_pool.hpp"
+#include "unit_test.hpp"
+
+#if defined(ASIO_HAS_BOOST_ARRAY)
+# include <boost/array.hpp>
+#else // defined(ASIO_HAS_BOOST_ARRAY)
+# include <array>
+#endif // defined(ASIO_HAS_BOOST_ARRAY)
+
+using asio::ip::tcp;
+
+// A stream that counts the writes made to an underlying socket.
+class counting_stream
+{
+public:
+  typedef tcp::socket::executor_type executor_type;
+
+  explicit counting_stream(tcp::socket& s)
+    : socket_(s),
+      writes_(0),
+      max_buffers_(0)
+  {
+  }
+
+  executor_type get_executor() noexcept
+  {
+    return socket_.get_executor();
+  }
+
+  template <typename ConstBufferSequence, typename WriteHandler>
+  void async_write_some(const ConstBufferSequence& buffers,
+      WriteHandler&& handler)
+  {
+    std::size_t count = 0;
+    for (auto iter = asio::buffer_sequence_begin(buffers),
+        end = asio::buffer_sequence_end(buffers); iter != end; ++iter)
+      ++count;
+    if (count > max_buffers_)
+      max_buffers_ = count;
+    ++writes_;
+    socket_.async_write_some(buffers,
+        static_cast<WriteHandler&&>(handler));
+  }
+
+  std::size_t writes() const
+  {
+    return writes_;
+  }
+
+  std::size_t max_buffers() const
+  {
+    return max_buffers_;
+  }
+
+private:
+  tcp::socket& socket_;
+  std::size_t writes_;
+  std::size_t max_buffers_;
+};
+
+void write_handler(const asio::error_code&, std::size_t)
+{
+}
+
+void test_compile()
+{
+#if defined(ASIO_HAS_BOOST_ARRAY)
+  using boost::array;
+#else // defined(ASIO_HAS_BOOST_ARRAY)
+  using std::array;
+#endif // defined(ASIO_HAS_BOOST_ARRAY)
+
+  using namespace asio;
+
+  try
+  {
+    io_context ioc;
+    const char const_char_buffer[128] = "";
+    array<asio::const_buffer, 2> const_buffers = {{
+        asio::buffer(const_char_buffer, 10),
+        asio::buffer(const_char_buffer + 10, 10) }};
+    archetypes::lazy_handler lazy;
+
+    tcp::socket socket1(ioc);
+    write_queue<tcp::socket&> queue1(socket1);
+    write_queue<tcp::socket> queue2(ioc);
+
+    write_queue<tcp::socket>::executor_type ex = queue2.get_executor();
+    (void)ex;
+
+    tcp::socket& next_layer = queue1.next_layer();
+    (void)next_layer;
+
+    std::size_t pending = queue1.pending();
+    (void)pending;
+
+    queue1.async_write(buffer(const_char_buffer), &write_handler);
+    queue1.async_write(const_buffers, &write_handler);
+    int i1 = queue1.async_write(buffer(const_char_buffer), lazy);
+    (void)i1;
+  }
+  catch (std::exception&)
+  {
+  }
+}
+
+struct connected_pair
+{
+  asio::io_context ioc;
+  tcp::socket client;
+  tcp::socket server;
+
+  connected_pair()
+    : client(ioc),
+      server(ioc)
+  {
+    tcp::acceptor acceptor(ioc,
+        tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+    client.connect(acceptor.local_endpoint());
+    acceptor.accept(server);
+  }
+};
+
+void test_coalescing()
+{
+  connected_pair p;
+  asio::write_queue<counting_stream> queue(p.client);
+
+  // Messages submitted together are gathered into a single write, and each
+  // message's handler is called with the message's size.
+  const std::size_t message_count = 20;
+  std::vector<std::string> messages;
+  for (std::size_t i = 0; i < message_count; ++i)
+    messages.push_back(std::string(i + 1, static_cast<char>('a' + i)));
+
+  std::vector<std::size_t> completed;
+  for (std::size_t i = 0; i < message_count; ++i)
+  {
+    queue.async_write(asio::buffer(messages[i]),
+        [&, i](asio::error_code ec, std::size_t n)
+        {
+          ASIO_CHECK(!ec);
+          ASIO_CHECK(n == messages[i].size());
+          completed.push_back(i);
+        });
+  }
+
+  // Zero-length messages complete in order with the others.
+  queue.async_write(asio::const_buffer(),
+      [&](asio::error_code ec, std::size_t n)
+      {
+        ASIO_CHECK(!ec);
+        ASIO_CHECK(n == 0);
+        completed.push_back(message_count);
+      });
+
+  ASIO_CHECK(queue.pending() == message_count + 1);
+  ASIO_CHECK(completed.empty());
+
+  std::string expected;
+  for (std::size_t i = 0; i < message_count; ++i)
+    expected += messages[i];
+  std::string received(expected.size(), '\0');
+  asio::async_read(p.server, asio::buffer(&received[0], received.size()),
+      [](asio::error_code ec, std::size_t) { ASIO_CHECK(!ec); });
+
+  p.ioc.run();
+
+  ASIO_CHECK(received == expected);
+  ASIO_CHECK(completed.size() == message_count + 1);
+  for (std::size_t i = 0; i < completed.size(); ++i)
+    ASIO_CHECK(completed[i] == i);
+  ASIO_CHECK(queue.pending() == 0);
+  ASIO_CHECK(queue.next_layer().writes() == 1);
+}
+
+void test_max_buffers()
+{
+  connected_pair p;
+  asio::write_queue<counting_stream> queue(p.client);
+
+  // More buffers than fit into a single write need several writes.
+  const std::size_t message_count =
+    asio::write_queue<counting_stream>::max_buffers * 2 + 1;
+  char data[] = "x";
+  std::size_t completed = 0;
+  for (std::size_t i = 0; i < message_count; ++i)
+  {
+    queue.async_write(asio::buffer(data, 1),
+        [&](asio::error_code ec, std::size_t n)
+        {
+          ASIO_CHECK(!ec);
+          ASIO_CHECK(n == 1);
+          ++completed;
+        });
+  }
+
+  std::string received(message_count, '\0');
+  asio::async_read(p.server, asio::buffer(&received[0], received.size()),
+      [](asio::error_code ec, std::size_t) { ASIO_CHECK(!ec); });
+
+  p.ioc.run();
+
+  ASIO_CHECK(completed == message_count);
+  ASIO_CHECK(received == std::string(message_count, 'x'));
+  ASIO_CHECK(queue.next_layer().writes() == 3);
+  ASIO_CHECK(queue.next_layer().max_buffers()
+      == asio::write_queue<counting_stream>::max_buffers);
+}
+
+void test_error()
+{
+  connected_pair p;
+  asio::write_queue<tcp::socket&> queue(p.client);
+  p.client.close();
+
+  int failed = 0;
+  char data[] = "data";
+  for (int i = 0; i < 3; ++i)
+  {
+    queue.async_write(asio::buffer(data),
+        [&](asio::error_code ec, std::size_t n)
+        {
+          ASIO_CHECK(!!ec);
+          ASIO_CHECK(n == 0);
+          ++failed;
+        });
+  }
+
+  p.ioc.run();
+
+  ASIO_CHECK(failed == 3);
+  ASIO_CHECK(queue.pending() == 0);
+}
+
+void test_multiple_threads()
+{
+  connected_pair p;
+  asio::write_queue<tcp::socket&> queue(p.client);
+
+  const int thread_count = 4;
+  const int messages_per_thread = 100;
+  const std::size_t total = thread_count * messages_per_thread;
+  char data[] = "y";
+
+  std::string received(total, '\0');
+  asio::async_read(p.server, asio::buffer(&received[0], received.size()),
+      [](asio::error_code ec, std::size_t) { ASIO_CHECK(!ec); });
+
+  // Keep the io_context running while messages are being submitted.
+  asio::executor_work_guard<asio::io_context::executor_type> work
+    = asio::make_work_guard(p.ioc);
+  asio::thread runner([&]{ p.ioc.run(); });
+
+  asio::thread_pool writers(thread_count);
+  asio::detail::mutex mutex;
+  std::size_t completed = 0;
+  for (int t = 0; t < thread_count; ++t)
+  {
+    asio::post(writers, [&]
+        {
+          for (int i = 0; i < messages_per_thread; ++i)
+          {
+            queue.async_write(asio::buffer(data, 1),
+                [&](asio::error_code ec, std::size_t)
+                {
+                  ASIO_CHECK(!ec);
+                  asio::detail::mutex::scoped_lock lock(mutex);
+                  ++completed;
+                });
+          }
+        });
+  }
+
+  writers.join();
+  work.reset();
+  runner.join();
+
+  ASIO_CHECK(completed == total);
+  ASIO_CHECK(received == std::string(total, 'y'));
+}
+
+//------------------------------------------------------------------------------
+
+ASIO_TEST_SUITE
+(
+  "write_queue",
+  ASIO_COMPILE_TEST_CASE(test_compile)
+  ASIO_TEST_CASE(test_coalescing)
+  ASIO_TEST_CASE(test_max_buffers)
+  ASIO_TEST_CASE(test_error)
+  ASIO_TEST_CASE(test_multiple_threads)
+)